@@ -0,0 +1,58 @@
+/*
+ *  Copyright (C) 2019, NogDB <https://nogdb.org>
+ *  <nogdb at throughwave dot co dot th>
+ *
+ *  This file is part of libnogdb, the NogDB core library in C++.
+ *
+ *  libnogdb is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "nogdb/nogdb.h"
+
+namespace benchmark {
+
+inline void clearDatabase(const std::string& dbPath)
+{
+    auto command = "rm -rf \"" + dbPath + "\"";
+    if (std::system(command.c_str()) != 0) {
+        std::cerr << "cannot remove " << dbPath << std::endl;
+    }
+}
+
+// runs a function once and reports its elapsed time along with the number of results it produced
+inline size_t measure(const std::string& name, const std::function<size_t()>& func)
+{
+    auto start = std::chrono::steady_clock::now();
+    auto result = func();
+    auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << std::left << std::setw(48) << name
+              << std::right << std::setw(12) << std::fixed << std::setprecision(3) << elapsed << " ms"
+              << std::setw(12) << result << " results" << std::endl;
+    return result;
+}
+
+}
@@ -0,0 +1,99 @@
+/*
+ *  Copyright (C) 2019, NogDB <https://nogdb.org>
+ *  <nogdb at throughwave dot co dot th>
+ *
+ *  This file is part of libnogdb, the NogDB core library in C++.
+ *
+ *  libnogdb is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "benchmark.h"
+
+/**
+ * Compares substring searches (CONTAIN, LIKE '%x%') answered by a full class scan
+ * against the same searches answered by a full-text index.
+ *
+ * Usage: benchmark_fulltext_index [number of records]
+ */
+int main(int argc, char* argv[])
+{
+    const auto numOfRecords = (argc > 1) ? std::stoul(argv[1]) : 100000UL;
+    const auto dbPath = std::string { "benchmark_fulltext_index.db" };
+    const auto words = std::vector<std::string> {
+        "graph", "vertex", "edge", "index", "record", "cursor", "lightning", "memory", "mapped", "database",
+        "traversal", "shortest", "path", "property", "schema", "transaction", "commit", "rollback", "query", "token"
+    };
+
+    benchmark::clearDatabase(dbPath);
+    auto ctx = nogdb::ContextInitializer(dbPath).init();
+    {
+        auto txn = ctx.beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addClass("documents", nogdb::ClassType::VERTEX);
+        txn.addProperty("documents", "content", nogdb::PropertyType::TEXT);
+        auto random = std::mt19937 { 42 };
+        auto pick = std::uniform_int_distribution<size_t> { 0, words.size() - 1 };
+        for (auto i = 0UL; i < numOfRecords; ++i) {
+            auto content = std::string {};
+            for (auto w = 0; w < 8; ++w) {
+                content += words[pick(random)] + " ";
+            }
+            content += "doc" + std::to_string(i);
+            txn.addVertex("documents", nogdb::Record {}.set("content", content));
+        }
+        txn.commit();
+    }
+
+    const auto conditions = std::vector<std::pair<std::string, nogdb::Condition>> {
+        { "contain 'lightning'", nogdb::Condition("content").contain("lightning") },
+        { "contain 'doc4242'", nogdb::Condition("content").contain("doc4242") },
+        { "contain 'VERTEX' ignore case", nogdb::Condition("content").contain("VERTEX").ignoreCase() },
+        { "like '%shortest path%'", nogdb::Condition("content").like("%shortest path%") },
+        { "like '%doc4242_'", nogdb::Condition("content").like("%doc4242_") }
+    };
+
+    // an existing index is always preferred, so the scans have to be measured before it is created
+    auto scanned = std::vector<size_t> {};
+    {
+        auto txn = ctx.beginTxn(nogdb::TxnMode::READ_ONLY);
+        for (const auto& condition : conditions) {
+            scanned.emplace_back(benchmark::measure("scan    " + condition.first, [&]() {
+                return txn.find("documents").where(condition.second).count();
+            }));
+        }
+    }
+
+    benchmark::measure("create full-text index", [&]() {
+        auto txn = ctx.beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addIndex("documents", "content", nogdb::IndexType::FULLTEXT);
+        txn.commit();
+        return size_t { 1 };
+    });
+
+    {
+        auto txn = ctx.beginTxn(nogdb::TxnMode::READ_ONLY);
+        for (auto i = size_t { 0 }; i < conditions.size(); ++i) {
+            auto indexed = benchmark::measure("indexed " + conditions[i].first, [&]() {
+                return txn.find("documents").indexed().where(conditions[i].second).count();
+            });
+            if (indexed != scanned[i]) {
+                std::cerr << "mismatched results: " << scanned[i] << " != " << indexed << std::endl;
+                return 1;
+            }
+        }
+    }
+
+    benchmark::clearDatabase(dbPath);
+    return 0;
+}
@@ -83,6 +83,20 @@ public:
 
     Transaction beginTxn(const TxnMode& txnMode = TxnMode::READ_WRITE);
 
+    // keeps a copy of all edges in memory for the traversals of read-only transactions, which is taken again
+    // by the first traversal after each commit; copies of the context share the same cache
+    Context& enableAdjacencyCache();
+
+    void disableAdjacencyCache();
+
+    bool isAdjacencyCacheEnabled() const { return _adjacencyCache != nullptr; }
+
+    // the most worker threads a breadth-first traversal of a read-only transaction may use, or 0 for one per core;
+    // a traversal of a read-write transaction always runs on the calling thread
+    Context& setTraversalThreads(unsigned int numThreads) noexcept;
+
+    unsigned int getTraversalThreads() const { return _traversalThreads; }
+
 private:
     friend class ContextInitializer;
     friend class Transaction;
@@ -96,6 +110,10 @@ private:
 
     storage_engine::LMDBEnv* _envHandler;
 
+    std::shared_ptr<algorithm::AdjacencyCache> _adjacencyCache {};
+
+    unsigned int _traversalThreads {};
+
     struct LMDBInstance {
         storage_engine::LMDBEnv* _handler;
         unsigned int _refCount;
@@ -144,12 +162,25 @@ public:
 
     void dropProperty(const std::string& className, const std::string& propertyName);
 
+    // a unique index of a text property is a hash index, which only answers equality conditions;
+    // any other index is ordered
     const IndexDescriptor addIndex(const std::string& className,
         const std::string& propertyName,
         bool isUnique = false);
 
+    const IndexDescriptor addIndex(const std::string& className,
+        const std::string& propertyName,
+        const IndexType& type);
+
+    const IndexDescriptor addIndex(const std::string& className,
+        const std::string& propertyName,
+        bool isUnique,
+        const IndexType& type);
+
     void dropIndex(const std::string& className, const std::string& propertyName);
 
+    void analyze(const std::string& className);
+
     const DBInfo getDBInfo() const;
 
     const std::vector<ClassDescriptor> getClasses() const;
@@ -177,14 +208,28 @@ public:
         const RecordDescriptor& dstVertexRecordDescriptor,
         const Record& record = Record {});
 
+    // index keys of the records are sorted and written in runs of a bounded number of records,
+    // so that neighbouring keys are written together without sorting the whole batch at once
+    const std::vector<RecordDescriptor> addVertices(const std::string& className, const std::vector<Record>& records);
+
+    // index keys are written in sorted runs as with addVertices
+    const std::vector<RecordDescriptor> addEdges(const std::string& className,
+        const std::vector<std::pair<RecordDescriptor, RecordDescriptor>>& srcDstVertexRecordDescriptors,
+        const Record& record = Record {});
+
     void update(const RecordDescriptor& recordDescriptor, const Record& record);
 
+    // set the given properties of every record and keep the rest, maintaining only the indexes of those properties
+    void updateProperties(const std::vector<RecordDescriptor>& recordDescriptors, const Record& properties);
+
     void updateSrc(const RecordDescriptor& recordDescriptor, const RecordDescriptor& newSrcVertexRecordDescriptor);
 
     void updateDst(const RecordDescriptor& recordDescriptor, const RecordDescriptor& newDstVertexRecordDescriptor);
 
     void remove(const RecordDescriptor& recordDescriptor);
 
+    void remove(const std::vector<RecordDescriptor>& recordDescriptors);
+
     void removeAll(const std::string& className);
 
     FindOperationBuilder find(const std::string& className) const;
@@ -212,16 +257,23 @@ public:
     ShortestPathOperationBuilder shortestPath(const RecordDescriptor& srcVertexRecordDescriptor,
         const RecordDescriptor& dstVertexRecordDescriptor) const;
 
+    // reads the edges between all vertices once, then runs graph algorithms over them in memory
+    GraphAnalytics analytics() const;
+
 private:
     friend class ResultSetCursor;
     friend class compare::RecordCompare;
     friend class validate::Validator;
     friend class algorithm::GraphTraversal;
+    friend class algorithm::AdjacencyCache;
+    friend class algorithm::TraversalState;
     friend class FindOperationBuilder;
     friend class FindEdgeOperationBuilder;
     friend class TraverseOperationBuilder;
     friend class ShortestPathOperationBuilder;
+    friend class GraphAnalytics;
 
+    friend struct algorithm::AdjacencySnapshot;
     friend struct schema::SchemaUtils;
     friend struct datarecord::DataRecordUtils;
     friend struct index::IndexUtils;
@@ -253,12 +305,26 @@ private:
         adapter::schema::IndexAccess* _index;
     };
 
+    // raise the version of a vertex once per transaction
+    void updateVersion(const RecordId& recordId);
+
     TxnMode _txnMode;
     const Context* _txnCtx;
     storage_engine::LMDBTxn* _txnBase;
     Adapter* _adapter;
     relation::GraphUtils* _graph;
 
+    // the cached adjacency of the context, looked up by the first traversal of a read-only transaction,
+    // which takes a snapshot if the cached one is older
+    const algorithm::AdjacencySnapshot* getAdjacencySnapshot() const;
+
+    // the cached adjacency only if it already holds the data of the transaction, for edge lookups too small
+    // to be worth a snapshot of the whole graph
+    const algorithm::AdjacencySnapshot* findAdjacencySnapshot() const;
+
+    mutable std::shared_ptr<const algorithm::AdjacencySnapshot> _adjacencySnapshot {};
+    mutable bool _isAdjacencySnapshotResolved { false };
+
     std::unordered_set<RecordId, RecordIdHash> _updatedRecords {};
 };
 
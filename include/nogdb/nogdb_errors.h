@@ -92,6 +92,9 @@
 #define NOGDB_SQL_INVALID_TRAVERSE_MAX_DEPTH 0xa00c
 #define NOGDB_SQL_INVALID_TRAVERSE_STRATEGY 0xa00d
 #define NOGDB_SQL_INVALID_PROJECTION_METHOD 0xa00e
+#define NOGDB_SQL_INVALID_PARAMETER 0xa00f
+#define NOGDB_SQL_UNBOUND_PARAMETER 0xa010
+#define NOGDB_SQL_INVALID_VALUES 0xa011
 #define NOGDB_SQL_NOT_IMPLEMENTED 0xaf01
 #define NOGDB_SQL_UNKNOWN_ERR 0xafff
 
@@ -383,6 +386,12 @@ public:
             return "NOGDB_SQL_INVALID_TRAVERSE_STRATEGY: Traverse strategy must be DEPTH_FIRST or BREADTH_FIRST.";
         case NOGDB_SQL_INVALID_PROJECTION_METHOD:
             return "NOGDB_SQL_INVALID_PROJECTION_METHOD: Projection method has some problem (invalid results).";
+        case NOGDB_SQL_INVALID_PARAMETER:
+            return "NOGDB_SQL_INVALID_PARAMETER: A parameter index or name does not exist in the statement.";
+        case NOGDB_SQL_UNBOUND_PARAMETER:
+            return "NOGDB_SQL_UNBOUND_PARAMETER: A parameter of the statement has not been bound to a value.";
+        case NOGDB_SQL_INVALID_VALUES:
+            return "NOGDB_SQL_INVALID_VALUES: A row of values does not have one value for each property.";
         case NOGDB_SQL_NOT_IMPLEMENTED:
             return "NOGDB_SQL_NOT_IMPLEMENTED: A function has not been implemented yet.";
         case NOGDB_SQL_UNKNOWN_ERR:
@@ -21,8 +21,12 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "nogdb_errors.h"
 #include "nogdb_types.h"
@@ -31,6 +35,10 @@ namespace nogdb {
 
 namespace sql_parser {
     class Context;
+
+    class TokenList;
+
+    class RowSource;
 }
 
 struct SQL {
@@ -40,6 +48,35 @@ struct SQL {
 
     SQL& operator=(const SQL& _) = delete;
 
+    /*
+     * Rows of a streamed SELECT or TRAVERSE statement, pulled one at a time. The where condition,
+     * skip, limit and projections are applied to each row as it is pulled, so the rows are never
+     * held in memory together. It reads through the transaction which the statement was executed in,
+     * so it must not be used after that transaction is completed.
+     */
+    class Cursor {
+    public:
+        friend class sql_parser::Context;
+
+        ~Cursor() noexcept;
+
+        Cursor(Cursor&& cursor) noexcept;
+
+        Cursor& operator=(Cursor&& cursor) noexcept;
+
+        bool next();
+
+        const nogdb::Result& operator*() const;
+
+        const nogdb::Result* operator->() const;
+
+    private:
+        explicit Cursor(std::unique_ptr<sql_parser::RowSource> source);
+
+        std::unique_ptr<sql_parser::RowSource> _source;
+        nogdb::Result _result {};
+    };
+
     class Result {
     public:
         friend class sql_parser::Context;
@@ -56,7 +93,9 @@ struct SQL {
             CLASS_DESCRIPTOR,
             PROPERTY_DESCRIPTOR,
             RECORD_DESCRIPTORS,
-            RESULT_SET
+            RESULT_SET,
+            RESULT_CURSOR,
+            QUERY_PLAN
         };
 
         inline Type type() const
@@ -107,10 +146,115 @@ struct SQL {
         {
         }
 
+        Result(Cursor* cursor)
+            : t(RESULT_CURSOR)
+            , value(cursor)
+        {
+        }
+
+        Result(QueryPlanNode* plan)
+            : t(QUERY_PLAN)
+            , value(plan)
+        {
+        }
+
         Type t;
         std::shared_ptr<void> value;
     };
 
+    /*
+     * A statement with placeholders, executed with the values bound to them: '?' by a zero-based
+     * position or ':name' by a name. Values are kept until they are bound again. Only the tokens
+     * of the statement are kept, so each execution parses it and looks up its classes again.
+     */
+    class Statement {
+    public:
+        friend struct SQL;
+
+        template <typename T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, int>::type = 0>
+        Statement& bind(size_t index, T value)
+        {
+            return setValue(positionalSlot(index), literal(static_cast<long long>(value)));
+        }
+
+        template <typename T, typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value, int>::type = 0>
+        Statement& bind(size_t index, T value)
+        {
+            return setValue(positionalSlot(index), literal(static_cast<unsigned long long>(value)));
+        }
+
+        Statement& bind(size_t index, double value);
+
+        Statement& bind(size_t index, const std::string& value);
+
+        Statement& bind(size_t index, const char* value);
+
+        Statement& bind(size_t index, const RecordDescriptor& value);
+
+        Statement& bind(size_t index, std::nullptr_t);
+
+        template <typename T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, int>::type = 0>
+        Statement& bind(const std::string& name, T value)
+        {
+            return setValue(namedSlot(name), literal(static_cast<long long>(value)));
+        }
+
+        template <typename T, typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value, int>::type = 0>
+        Statement& bind(const std::string& name, T value)
+        {
+            return setValue(namedSlot(name), literal(static_cast<unsigned long long>(value)));
+        }
+
+        Statement& bind(const std::string& name, double value);
+
+        Statement& bind(const std::string& name, const std::string& value);
+
+        Statement& bind(const std::string& name, const char* value);
+
+        Statement& bind(const std::string& name, const RecordDescriptor& value);
+
+        Statement& bind(const std::string& name, std::nullptr_t);
+
+        const Result execute(Transaction& txn) const;
+
+        // executes as execute(), except that SELECT and TRAVERSE statements return a RESULT_CURSOR
+        const Result stream(Transaction& txn) const;
+
+    private:
+        // the tokens (type and text) that a bound value is substituted with
+        using Literal = std::vector<std::pair<int, std::string>>;
+
+        explicit Statement(std::shared_ptr<const sql_parser::TokenList> tokens);
+
+        const Result execute(Transaction& txn, bool streaming) const;
+
+        size_t positionalSlot(size_t index) const;
+
+        size_t namedSlot(const std::string& name) const;
+
+        Statement& setValue(size_t slot, Literal&& value);
+
+        static Literal literal(long long value);
+
+        static Literal literal(unsigned long long value);
+
+        static Literal literal(double value);
+
+        static Literal literal(const std::string& value);
+
+        static Literal literal(const RecordDescriptor& value);
+
+        static Literal literal(std::nullptr_t);
+
+        std::shared_ptr<const sql_parser::TokenList> _tokens;
+        std::vector<Literal> _values;
+    };
+
     static const Result execute(Transaction& txn, const std::string& sql);
+
+    static const Result stream(Transaction& txn, const std::string& sql);
+
+    // splits the statement into tokens, or takes them from the token cache shared with execute()
+    static Statement prepare(const std::string& sql);
 };
 }
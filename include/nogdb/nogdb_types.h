@@ -25,6 +25,8 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <functional>
+#include <limits>
 #include <list>
 #include <map>
 #include <memory>
@@ -50,12 +52,19 @@ namespace parser {
 
 namespace compare {
     class RecordCompare;
+
+    class ConditionMatcher;
+
+    class MultiConditionMatcher;
 }
 
 namespace adapter {
     namespace metadata {
         class DBInfoAccess;
     }
+    namespace relation {
+        enum class Direction;
+    }
     namespace schema {
         class ClassAccess;
 
@@ -87,6 +96,12 @@ namespace validate {
 
 namespace algorithm {
     class GraphTraversal;
+
+    class TraversalState;
+
+    struct AdjacencySnapshot;
+
+    class AdjacencyCache;
 }
 
 namespace sql_parser {
@@ -97,6 +112,8 @@ class Condition;
 
 class MultiCondition;
 
+class CompiledCondition;
+
 class GraphFilter;
 
 enum class PropertyType {
@@ -120,6 +137,12 @@ enum class ClassType {
     UNDEFINED = 'n'
 };
 
+enum class IndexType {
+    ORDERED = 'o',
+    FULLTEXT = 'f',
+    HASH = 'h'
+};
+
 enum class TxnMode {
     READ_ONLY,
     READ_WRITE
@@ -554,6 +577,8 @@ public:
 
 class ResultSetCursor;
 
+class TraverseCursor;
+
 class Record {
 public:
     using PropertyToBytesMap = std::map<std::string, Bytes>;
@@ -627,6 +652,7 @@ private:
     friend class algorithm::GraphTraversal;
     friend class sql_parser::Record;
     friend class ResultSetCursor;
+    friend class TraverseCursor;
 
     Record(PropertyToBytesMap properties);
 
@@ -694,7 +720,9 @@ struct RecordDescriptor {
 
 private:
     friend class algorithm::GraphTraversal;
+    friend class algorithm::TraversalState;
     friend class ResultSetCursor;
+    friend class TraverseCursor;
 
     unsigned int _depth { 0 };
 };
@@ -702,11 +730,16 @@ private:
 struct IndexDescriptor {
     IndexDescriptor() = default;
 
-    IndexDescriptor(const IndexId& _id, const ClassId& _classId, const PropertyId& _propertyId, bool _isUnique)
+    IndexDescriptor(const IndexId& _id,
+        const ClassId& _classId,
+        const PropertyId& _propertyId,
+        bool _isUnique,
+        const IndexType& _type = IndexType::ORDERED)
         : id { _id }
         , classId { _classId }
         , propertyId { _propertyId }
         , unique { _isUnique }
+        , type { _type }
     {
     }
 
@@ -714,6 +747,7 @@ struct IndexDescriptor {
     ClassId classId { 0 };
     PropertyId propertyId { 0 };
     bool unique { true };
+    IndexType type { IndexType::ORDERED };
 };
 
 struct PropertyDescriptor {
@@ -833,6 +867,64 @@ private:
     }
 };
 
+class TraverseCursor {
+public:
+    friend class TraverseOperationBuilder;
+
+    ~TraverseCursor() noexcept;
+
+    TraverseCursor(TraverseCursor&& tc) noexcept;
+
+    TraverseCursor& operator=(TraverseCursor&& tc) noexcept;
+
+    bool next();
+
+    const Result& operator*() const;
+
+    const Result* operator->() const;
+
+private:
+    TraverseCursor(const Transaction& txn_, std::unique_ptr<algorithm::TraversalState> state_);
+
+    const Transaction* txn;
+    std::unique_ptr<algorithm::TraversalState> state;
+    Result result;
+};
+
+class TraversalPaths {
+public:
+    // the parent of a source vertex
+    static constexpr size_t NO_PARENT = std::numeric_limits<size_t>::max();
+
+    size_t size() const;
+
+    bool empty() const;
+
+    RecordDescriptor getVertex(size_t index) const;
+
+    // an empty record descriptor for a source vertex
+    RecordDescriptor getEdge(size_t index) const;
+
+    size_t getParent(size_t index) const;
+
+    unsigned int getDepth(size_t index) const;
+
+    // vertices and edges in turn, from the source vertex to the vertex at the index
+    std::vector<RecordDescriptor> getPath(size_t index) const;
+
+private:
+    friend class TraverseOperationBuilder;
+
+    struct Node {
+        RecordId vertex;
+        RecordId edge;
+        size_t parent;
+        unsigned int depth;
+    };
+
+    std::vector<Node> nodes {};
+};
+
 class GraphFilter {
 public:
     friend class compare::RecordCompare;
@@ -982,6 +1074,8 @@ private:
 public:
     friend class MultiCondition;
     friend class compare::RecordCompare;
+    friend class compare::ConditionMatcher;
+    friend class compare::MultiConditionMatcher;
 
     Condition(const std::string& _propName);
 
@@ -1180,6 +1274,9 @@ public:
 
     Condition operator!() const;
 
+    // prepares the condition for values of one property type, which is done once before testing many records
+    CompiledCondition compile(const PropertyType& type) const;
+
 private:
     friend struct datarecord::DataRecordUtils;
     friend struct index::IndexUtils;
@@ -1212,6 +1309,25 @@ private:
     };
 };
 
+// a condition whose operands are decoded, case-folded and turned into a regex only once
+class CompiledCondition {
+public:
+    CompiledCondition() = default;
+
+    ~CompiledCondition() noexcept = default;
+
+    // the value is empty when a record has no value of the property
+    bool operator()(const Bytes& value) const;
+
+    bool operator()(const Record& record) const;
+
+private:
+    friend class Condition;
+
+    std::string _propName {};
+    std::shared_ptr<const compare::ConditionMatcher> _matcher {};
+};
+
 class MultiCondition {
 private:
     enum Operator {
@@ -1228,6 +1344,7 @@ private:
 public:
     friend class Condition;
     friend class compare::RecordCompare;
+    friend class compare::MultiConditionMatcher;
     friend struct index::IndexUtils;
 
     MultiCondition() = delete;
@@ -1336,6 +1453,38 @@ private:
     };
 };
 
+struct QueryPlan {
+    enum class Strategy {
+        // read every record of the class and evaluate the condition on it
+        FULL_SCAN,
+        // answer a single condition from its index
+        INDEX_SCAN,
+        // answer every condition from its index and merge the position ids
+        INDEX_INTERSECTION,
+        // answer the most selective condition from its index and evaluate the rest on the fetched records
+        INDEX_WITH_FILTER
+    };
+
+    std::string className {};
+    Strategy strategy { Strategy::FULL_SCAN };
+    std::vector<std::string> indexedProperties {};
+    double estimatedRecords { 0.0 };
+    double estimatedCost { 0.0 };
+};
+
+// an operator of a query and the operators it pulls its rows from
+struct QueryPlanNode {
+    // FIND, FETCH, TRAVERSE, FILTER, LIMIT, PROJECT, EXPAND, GROUP or NONE
+    std::string operation {};
+    // the plans chosen by a FIND operator for its class and each of its sub-classes
+    std::vector<QueryPlan> plans {};
+    // filled in by a profile only, including what is spent on the inputs of the operator
+    unsigned long long rows { 0 };
+    unsigned long long reads { 0 };
+    double elapsedTime { 0.0 };
+    std::vector<QueryPlanNode> children {};
+};
+
 class OperationBuilder {
 public:
     enum class ConditionType {
@@ -1351,6 +1500,11 @@ public:
         UNDIRECTED
     };
 
+    enum class TraversalStrategy {
+        BREADTH_FIRST,
+        DEPTH_FIRST
+    };
+
 protected:
     OperationBuilder(const Transaction* txn);
 
@@ -1416,6 +1570,12 @@ public:
 
     unsigned long count() const;
 
+    // the plans chosen for the class and each of its sub-classes without retrieving any record
+    std::vector<QueryPlan> explain() const;
+
+    // retrieves every record and measures the rows, the LMDB reads and the milliseconds it takes
+    QueryPlanNode profile() const;
+
 private:
     friend class Transaction;
 
@@ -1506,6 +1666,13 @@ public:
 
     virtual TraverseOperationBuilder& depth(unsigned int minDepth, unsigned int maxDepth);
 
+    virtual TraverseOperationBuilder& breadthFirst();
+
+    // a depth-first traversal gives each vertex its depth in the depth-first tree, which is the length of
+    // the path it was first found along; a shorter path found later changes neither the depth nor the
+    // vertices the maximum depth cuts off
+    virtual TraverseOperationBuilder& depthFirst();
+
     //    virtual TraverseOperationBuilder& orderBy(const std::string &propName);
     //
     //    template<typename ...T>
@@ -1534,8 +1701,21 @@ public:
 
     ResultSetCursor getCursor() const;
 
+    // vertices are found one at a time while the cursor moves, so a traversal can be stopped at any point
+    TraverseCursor getStream() const;
+
+    // every vertex reached together with the edge and the vertex it was reached from, so that a path
+    // to any of them is found without further queries
+    TraversalPaths getPaths() const;
+
     unsigned long count() const;
 
+    // a traversal reads no index, so its plan is the traversal alone
+    QueryPlanNode explain() const;
+
+    // traverses every vertex and measures the rows, the LMDB reads and the milliseconds it takes
+    QueryPlanNode profile() const;
+
 private:
     friend class Transaction;
 
@@ -1543,6 +1723,11 @@ private:
         const RecordDescriptor& recordDescriptor,
         const EdgeDirection& direction);
 
+    // checks the sources, then runs a traversal in the relation direction of the builder,
+    // telling it whether the traversal is depth-first
+    template <typename T>
+    T traverse(const std::function<T(const adapter::relation::Direction&, bool)>& traversal) const;
+
     std::set<RecordDescriptor> _rdescs {};
     EdgeDirection _direction;
     unsigned int _minDepth { 0 };
@@ -1550,6 +1735,7 @@ private:
     GraphFilter _edgeFilter {};
     GraphFilter _vertexFilter {};
     std::vector<std::string> _orderBy {};
+    TraversalStrategy _strategy { TraversalStrategy::BREADTH_FIRST };
 };
 
 class ShortestPathOperationBuilder : public OperationBuilder {
@@ -1562,12 +1748,16 @@ public:
 
     virtual ShortestPathOperationBuilder& whereE(const GraphFilter& filter);
 
-    //    virtual ShortestPathOperationBuilder& minDepth(unsigned int depth);
-    //
-    //    virtual ShortestPathOperationBuilder& maxDepth(unsigned int depth);
-    //
-    //    virtual ShortestPathOperationBuilder& depth(unsigned int minDepth, unsigned int maxDepth);
-    //
+    virtual ShortestPathOperationBuilder& minDepth(unsigned int depth);
+
+    virtual ShortestPathOperationBuilder& maxDepth(unsigned int depth);
+
+    virtual ShortestPathOperationBuilder& depth(unsigned int minDepth, unsigned int maxDepth);
+
+    virtual ShortestPathOperationBuilder& weightedBy(const std::string& propName);
+
+    virtual ShortestPathOperationBuilder& heuristic(double (*estimator)(const Record& vertex, const Record& destination));
+
     //    virtual ShortestPathOperationBuilder& orderBy(const std::string &propName);
     //
     //    template<typename ...T>
@@ -1612,6 +1802,38 @@ private:
     GraphFilter _edgeFilter {};
     GraphFilter _vertexFilter {};
     std::vector<std::string> _orderBy {};
+    std::string _weightPropName {};
+    double (*_heuristic)(const Record& vertex, const Record& destination) { nullptr };
+};
+
+class GraphAnalytics {
+public:
+    GraphAnalytics() = delete;
+
+    ~GraphAnalytics() noexcept = default;
+
+    size_t getNumVertices() const;
+
+    size_t getNumEdges() const;
+
+    // the rank of every vertex, where the ranks of all vertices sum to one
+    std::vector<std::pair<RecordDescriptor, double>> pageRank(double dampingFactor = 0.85,
+        unsigned int maxIterations = 100,
+        double tolerance = 1e-6) const;
+
+    // the component number of every vertex, counted from zero, where vertices joined by edges in either
+    // direction share the same number
+    std::vector<std::pair<RecordDescriptor, size_t>> getConnectedComponents() const;
+
+    // the number of triangles when edge directions, loop edges and parallel edges are ignored
+    unsigned long countTriangles() const;
+
+private:
+    friend class Transaction;
+
+    GraphAnalytics(const Transaction* txn);
+
+    std::shared_ptr<const algorithm::AdjacencySnapshot> _snapshot;
 };
 
 inline bool operator<(const RecordId& lhs, const RecordId& rhs)
@@ -1656,7 +1878,8 @@ inline bool operator==(const PropertyDescriptor& lhs, const PropertyDescriptor&
 
 inline bool operator==(const IndexDescriptor& lhs, const IndexDescriptor& rhs)
 {
-    return (lhs.id == rhs.id) && (lhs.classId == rhs.classId) && (lhs.propertyId == rhs.propertyId) && (lhs.unique == rhs.unique);
+    return (lhs.id == rhs.id) && (lhs.classId == rhs.classId) && (lhs.propertyId == rhs.propertyId) && (lhs.unique == rhs.unique)
+        && (lhs.type == rhs.type);
 }
 
 inline std::string rid2str(const nogdb::RecordId& rid)
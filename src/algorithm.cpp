@@ -28,6 +28,8 @@ namespace algorithm {
     using namespace datarecord;
     using compare::RecordCompare;
     using compare::ClassFilter;
+    using parser::RecordParser;
+    using schema::SchemaUtils;
 
     ResultSet GraphTraversal::breadthFirstSearch(const Transaction& txn,
         const std::set<RecordDescriptor>& recordDescriptors,
@@ -60,42 +62,248 @@ namespace algorithm {
         const GraphFilter& vertexFilter)
     {
         auto result = std::vector<RecordDescriptor> {};
-        auto visited = std::unordered_set<RecordId, RecordIdHash> {};
-        auto queue = std::queue<std::pair<RecordDescriptor, unsigned int>> {};
-        for(const auto& recordDescriptor: recordDescriptors) {
-            visited.insert(recordDescriptor.rid);
-            queue.push(std::make_pair(recordDescriptor, 0));
-        }
+        breadthFirstVisit(txn, recordDescriptors, minDepth, maxDepth, direction, edgeFilter, vertexFilter,
+            [&result](const RecordId& vertex, unsigned int depth) {
+                auto vertexRdesc = RecordDescriptor { vertex };
+                vertexRdesc._depth = depth;
+                result.emplace_back(vertexRdesc);
+            });
+        return result;
+    }
 
+    unsigned long GraphTraversal::breadthFirstSearchCount(const Transaction& txn,
+        const std::set<RecordDescriptor>& recordDescriptors,
+        unsigned int minDepth,
+        unsigned int maxDepth,
+        const Direction& direction,
+        const GraphFilter& edgeFilter,
+        const GraphFilter& vertexFilter)
+    {
+        auto result = 0UL;
+        breadthFirstVisit(txn, recordDescriptors, minDepth, maxDepth, direction, edgeFilter, vertexFilter,
+            [&result](const RecordId&, unsigned int) { ++result; });
+        return result;
+    }
+
+    void GraphTraversal::breadthFirstVisit(const Transaction& txn,
+        const std::set<RecordDescriptor>& recordDescriptors,
+        unsigned int minDepth,
+        unsigned int maxDepth,
+        const Direction& direction,
+        const GraphFilter& edgeFilter,
+        const GraphFilter& vertexFilter,
+        const std::function<void(const RecordId&, unsigned int)>& visit)
+    {
         try {
             auto edgeClassFilter = RecordCompare::getFilterClasses(txn, edgeFilter);
             auto vertexClassFilter = RecordCompare::getFilterClasses(txn, vertexFilter);
-            auto addUniqueVertex = [&](const std::pair<RecordDescriptor, unsigned int>& nextVertexInfo) {
-                auto currentVertex = nextVertexInfo.first;
-                auto currentLevel = nextVertexInfo.second;
-                if (visited.find(currentVertex.rid) != visited.cend())
-                    return;
-                auto vertexRdesc = RecordCompare::filterRecord(txn, currentVertex, vertexFilter, vertexClassFilter);
-                if ((currentLevel >= minDepth) && (currentLevel <= maxDepth) && (vertexRdesc != RecordDescriptor {})) {
-                    vertexRdesc._depth = currentLevel;
-                    result.emplace_back(vertexRdesc);
+            // traversal state stays compact: visited vertices are bits and frontiers are packed record ids
+            auto visited = RecordIdBitmap {};
+            auto frontier = PackedRecordIds {};
+            for (const auto& recordDescriptor : recordDescriptors) {
+                visited.insert(recordDescriptor.rid);
+                frontier.push_back(recordDescriptor.rid);
+                if (minDepth == 0) {
+                    visit(recordDescriptor.rid, 0U);
                 }
-                visited.insert(currentVertex.rid);
-                if ((currentLevel < maxDepth) && (vertexRdesc != RecordDescriptor {})) {
-                    queue.push(std::make_pair(currentVertex.rid, currentLevel));
+            }
+
+            // workers read the cached adjacency, or else the relation tables through read-only transactions of
+            // their own; a read-write transaction expands every frontier on the calling thread, since no other
+            // transaction sees its changes
+            auto adjacencySnapshot = txn.getAdjacencySnapshot();
+            auto isParallel = adjacencySnapshot != nullptr || txn.getTxnMode() == TxnMode::READ_ONLY;
+            auto workers = std::unique_ptr<WorkerPool> {};
+            auto readers = std::unique_ptr<RelationReaders> {};
+
+            // expand one whole level at a time, so that a large frontier can be shared among worker threads
+            auto currentLevel = 0U;
+            while (!frontier.empty() && currentLevel < maxDepth) {
+                ++currentLevel;
+
+                auto numWorkers = (isParallel) ? getNumWorkers(txn, frontier.size()) : size_t { 1 };
+                if (numWorkers > 1 && workers == nullptr) {
+                    if (adjacencySnapshot == nullptr) {
+                        readers.reset(new RelationReaders { *txn._txnBase, getMaxWorkers(txn) });
+                    }
+                    if (readers == nullptr || readers->isValid()) {
+                        workers.reset(new WorkerPool { getMaxWorkers(txn) });
+                    } else {
+                        isParallel = false;
+                        numWorkers = 1;
+                    }
                 }
-            };
 
-            if (minDepth == 0) {
-                result.assign(recordDescriptors.cbegin(), recordDescriptors.cend());
+                // each worker keeps its neighbours in frontier order, so they are found in the same order as
+                // a serial search does; edges whose records the filter reads are only filtered on this thread
+                auto neighbours = std::vector<PackedRecordIds>(numWorkers);
+                auto edges = std::vector<PackedRecordIds>(numWorkers);
+                auto isExpanded = std::vector<char>(numWorkers, 1);
+                auto isEdgeFilterNeeded = numWorkers > 1 && edgeClassFilter.isRecordNeeded;
+                if (numWorkers > 1) {
+                    workers->run(numWorkers, frontier.size(), [&](size_t worker, size_t begin, size_t end) {
+                        auto edgeNeighbours = std::vector<std::pair<RecordId, RecordId>> {};
+                        for (auto i = begin; i < end; ++i) {
+                            if (readers != nullptr) {
+                                readers->getEdgeAndNeighbours(worker, frontier[i], direction, edgeNeighbours);
+                            } else if (!adjacencySnapshot->getEdgeAndNeighbours(
+                                           frontier[i], direction, edgeNeighbours)) {
+                                isExpanded[worker] = 0;
+                                return;
+                            }
+                            for (const auto& edgeNeighbour : edgeNeighbours) {
+                                if (RecordCompare::isClassAccepted(edgeNeighbour.first.first, edgeClassFilter)) {
+                                    if (isEdgeFilterNeeded) {
+                                        edges[worker].push_back(edgeNeighbour.first);
+                                    }
+                                    neighbours[worker].push_back(edgeNeighbour.second);
+                                }
+                            }
+                        }
+                    });
+                }
+                if (numWorkers < 2 || std::find(isExpanded.cbegin(), isExpanded.cend(), 0) != isExpanded.cend()) {
+                    neighbours.assign(1, PackedRecordIds {});
+                    isEdgeFilterNeeded = false;
+                    for (auto i = size_t { 0 }; i < frontier.size(); ++i) {
+                        for (const auto& edgeNeighbour : RecordCompare::filterIncidentEdges(
+                                 txn, frontier[i], direction, edgeFilter, edgeClassFilter)) {
+                            neighbours[0].push_back(edgeNeighbour.second.rid);
+                        }
+                    }
+                }
+
+                auto candidates = PackedRecordIds {};
+                for (auto worker = size_t { 0 }; worker < neighbours.size(); ++worker) {
+                    for (auto i = size_t { 0 }; i < neighbours[worker].size(); ++i) {
+                        if (isEdgeFilterNeeded
+                            && RecordCompare::filterRecord(txn, edges[worker][i], edgeFilter, edgeClassFilter)
+                                == RecordDescriptor {}) {
+                            continue;
+                        }
+                        if (visited.insert(neighbours[worker][i])) {
+                            candidates.push_back(neighbours[worker][i]);
+                        }
+                    }
+                }
+                neighbours.clear();
+                edges.clear();
+
+                auto isAccepted = std::vector<char>(candidates.size(), 0);
+                for (auto i = size_t { 0 }; i < candidates.size(); ++i) {
+                    isAccepted[i] = RecordCompare::filterRecord(txn, candidates[i], vertexFilter, vertexClassFilter)
+                        != RecordDescriptor {};
+                }
+
+                // the vertices of the last level are never expanded
+                frontier.clear();
+                for (auto i = size_t { 0 }; i < candidates.size(); ++i) {
+                    if (isAccepted[i]) {
+                        if (currentLevel < maxDepth) {
+                            frontier.push_back(candidates[i]);
+                        }
+                        if (currentLevel >= minDepth) {
+                            visit(candidates[i], currentLevel);
+                        }
+                    }
+                }
             }
-            while (!queue.empty()) {
-                auto vertex = queue.front();
-                queue.pop();
-                for (const auto& edgeNeighbour :
-                    RecordCompare::filterIncidentEdges(txn, vertex.first.rid, direction, edgeFilter, edgeClassFilter)) {
-                    addUniqueVertex(std::make_pair(edgeNeighbour.second, vertex.second + 1));
+        } catch (const Error& err) {
+            if (err.code() == NOGDB_GRAPH_NOEXST_VERTEX) {
+                throw NOGDB_GRAPH_ERROR(NOGDB_GRAPH_UNKNOWN_ERR);
+            } else {
+                throw NOGDB_FATAL_ERROR(err);
+            }
+        }
+    }
+
+    TraversalState::TraversalState(const Transaction& txn,
+        const std::set<RecordDescriptor>& recordDescriptors,
+        unsigned int minDepth,
+        unsigned int maxDepth,
+        const Direction& direction,
+        bool isDepthFirst,
+        const GraphFilter& edgeFilter,
+        const GraphFilter& vertexFilter)
+        : _txn { txn }
+        , _minDepth { minDepth }
+        , _maxDepth { maxDepth }
+        , _direction { direction }
+        , _isDepthFirst { isDepthFirst }
+        , _edgeFilter { edgeFilter }
+        , _vertexFilter { vertexFilter }
+    {
+        _edgeClassFilter = RecordCompare::getFilterClasses(txn, _edgeFilter);
+        _vertexClassFilter = RecordCompare::getFilterClasses(txn, _vertexFilter);
+        // a traversal takes the cached adjacency, which its edge lookups then read instead of the relation tables
+        txn.getAdjacencySnapshot();
+        for (const auto& recordDescriptor : recordDescriptors) {
+            _visited.insert(recordDescriptor.rid);
+            _sources.emplace_back(recordDescriptor.rid);
+        }
+    }
+
+    RecordDescriptor TraversalState::next()
+    {
+        auto node = TraversalNode {};
+        while (nextNode(node)) {
+            if (node.depth >= _minDepth) {
+                auto vertexRdesc = RecordDescriptor { node.vertex };
+                vertexRdesc._depth = node.depth;
+                return vertexRdesc;
+            }
+        }
+        return RecordDescriptor {};
+    }
+
+    bool TraversalState::nextNode(TraversalNode& node)
+    {
+        // sources are found before anything else
+        if (!_sources.empty()) {
+            node = TraversalNode { _sources.front(), RecordId {}, std::numeric_limits<size_t>::max(), 0 };
+            _sources.pop_front();
+            if (_maxDepth > 0) {
+                _frames.emplace_back(Frame { node.vertex, _numNodes, 0, false, {}, 0 });
+            }
+            ++_numNodes;
+            return true;
+        }
+        try {
+            while (!_frames.empty()) {
+                auto& frame = _isDepthFirst ? _frames.back() : _frames.front();
+                if (!frame.isExpanded) {
+                    for (const auto& edgeNeighbour : RecordCompare::filterIncidentEdges(
+                             _txn, frame.vertex, _direction, _edgeFilter, _edgeClassFilter)) {
+                        frame.edgeNeighbours.emplace_back(edgeNeighbour.first.rid, edgeNeighbour.second.rid);
+                    }
+                    frame.isExpanded = true;
+                }
+                if (frame.index >= frame.edgeNeighbours.size()) {
+                    if (_isDepthFirst) {
+                        _frames.pop_back();
+                    } else {
+                        _frames.pop_front();
+                    }
+                    continue;
+                }
+
+                auto edgeNeighbour = frame.edgeNeighbours[frame.index++];
+                auto nextVertex = edgeNeighbour.second;
+                auto nextDepth = frame.depth + 1;
+                if (!_visited.insert(nextVertex)) {
+                    continue;
+                }
+                if (RecordCompare::filterRecord(_txn, nextVertex, _vertexFilter, _vertexClassFilter)
+                    == RecordDescriptor {}) {
+                    continue;
                 }
+                node = TraversalNode { nextVertex, edgeNeighbour.first, frame.node, nextDepth };
+                if (node.depth < _maxDepth) {
+                    // a new frame at the back is the next one to expand in a depth-first search
+                    _frames.emplace_back(Frame { nextVertex, _numNodes, node.depth, false, {}, 0 });
+                }
+                ++_numNodes;
+                return true;
             }
         } catch (const Error& err) {
             if (err.code() == NOGDB_GRAPH_NOEXST_VERTEX) {
@@ -104,17 +312,73 @@ namespace algorithm {
                 throw NOGDB_FATAL_ERROR(err);
             }
         }
+        return false;
+    }
+
+    ResultSet GraphTraversal::depthFirstSearch(const Transaction& txn,
+        const std::set<RecordDescriptor>& recordDescriptors,
+        unsigned int minDepth,
+        unsigned int maxDepth,
+        const Direction& direction,
+        const GraphFilter& edgeFilter,
+        const GraphFilter& vertexFilter)
+    {
+        const auto searchResultDescriptor = depthFirstSearchRdesc(
+            txn, recordDescriptors, minDepth, maxDepth, direction, edgeFilter, vertexFilter);
+        ResultSet result(searchResultDescriptor.size());
+        std::transform(searchResultDescriptor.begin(), searchResultDescriptor.end(), result.begin(),
+            [&txn](const RecordDescriptor& descriptor) {
+                const auto classInfo = txn._adapter->dbClass()->getInfo(descriptor.rid.first);
+                const auto& record = DataRecordUtils::getRecordWithBasicInfo(&txn, classInfo, descriptor);
+                record.setBasicInfo(DEPTH_PROPERTY, descriptor._depth);
+                return Result(descriptor, record);
+            });
+
+        return result;
+    }
+
+    std::vector<RecordDescriptor> GraphTraversal::depthFirstSearchRdesc(const Transaction& txn,
+        const std::set<RecordDescriptor>& recordDescriptors,
+        unsigned int minDepth,
+        unsigned int maxDepth,
+        const Direction& direction,
+        const GraphFilter& edgeFilter,
+        const GraphFilter& vertexFilter)
+    {
+        auto result = std::vector<RecordDescriptor> {};
+        TraversalState state { txn, recordDescriptors, minDepth, maxDepth, direction, true, edgeFilter, vertexFilter };
+        for (auto vertexRdesc = state.next(); vertexRdesc != RecordDescriptor {}; vertexRdesc = state.next()) {
+            result.emplace_back(vertexRdesc);
+        }
+        return result;
+    }
+
+    unsigned long GraphTraversal::depthFirstSearchCount(const Transaction& txn,
+        const std::set<RecordDescriptor>& recordDescriptors,
+        unsigned int minDepth,
+        unsigned int maxDepth,
+        const Direction& direction,
+        const GraphFilter& edgeFilter,
+        const GraphFilter& vertexFilter)
+    {
+        auto result = 0UL;
+        TraversalState state { txn, recordDescriptors, minDepth, maxDepth, direction, true, edgeFilter, vertexFilter };
+        for (auto vertexRdesc = state.next(); vertexRdesc != RecordDescriptor {}; vertexRdesc = state.next()) {
+            ++result;
+        }
         return result;
     }
 
     ResultSet GraphTraversal::bfsShortestPath(const Transaction& txn,
         const RecordDescriptor& srcVertexRecordDescriptor,
         const RecordDescriptor& dstVertexRecordDescriptor,
+        unsigned int minDepth,
+        unsigned int maxDepth,
         const GraphFilter& edgeFilter,
         const GraphFilter& vertexFilter)
     {
-        const auto searchResultDescriptor = bfsShortestPathRdesc(
-            txn, srcVertexRecordDescriptor, dstVertexRecordDescriptor, edgeFilter, vertexFilter);
+        const auto searchResultDescriptor = bfsShortestPathRdesc(txn,
+            srcVertexRecordDescriptor, dstVertexRecordDescriptor, minDepth, maxDepth, edgeFilter, vertexFilter);
 
         ResultSet result(searchResultDescriptor.size());
         std::transform(searchResultDescriptor.begin(), searchResultDescriptor.end(), result.begin(),
@@ -131,52 +395,63 @@ namespace algorithm {
     std::vector<RecordDescriptor> GraphTraversal::bfsShortestPathRdesc(const Transaction& txn,
         const RecordDescriptor& srcVertexRecordDescriptor,
         const RecordDescriptor& dstVertexRecordDescriptor,
+        unsigned int minDepth,
+        unsigned int maxDepth,
         const GraphFilter& edgeFilter,
         const GraphFilter& vertexFilter)
     {
         auto result = std::vector<RecordDescriptor> {};
         try {
             if (srcVertexRecordDescriptor == dstVertexRecordDescriptor) {
-                result.emplace_back(srcVertexRecordDescriptor);
+                if (minDepth == 0) {
+                    result.emplace_back(srcVertexRecordDescriptor);
+                }
             } else {
                 auto edgeClassFilter = RecordCompare::getFilterClasses(txn, edgeFilter);
                 auto vertexClassFilter = RecordCompare::getFilterClasses(txn, vertexFilter);
+                // the destination is a part of the path, so it must pass the vertex filter as well
+                auto dstVertexRdesc = RecordCompare::filterRecord(
+                    txn, dstVertexRecordDescriptor, vertexFilter, vertexClassFilter);
+                if (dstVertexRdesc == RecordDescriptor {}) {
+                    return result;
+                }
+
+                // search forwards from the source and backwards from the destination until both searches meet,
+                // always expanding the smaller frontier by one level
+                auto srcVisited = VisitedMap {};
+                auto dstVisited = VisitedMap {};
+                srcVisited.insert({ srcVertexRecordDescriptor.rid, { srcVertexRecordDescriptor, RecordId {} } });
+                dstVisited.insert({ dstVertexRecordDescriptor.rid, { dstVertexRdesc, RecordId {} } });
+                auto srcFrontier = std::vector<RecordId> { srcVertexRecordDescriptor.rid };
+                auto dstFrontier = std::vector<RecordId> { dstVertexRecordDescriptor.rid };
+                auto currentDepth = 0U;
                 auto found = false;
-                auto visited = std::unordered_map<RecordId, std::pair<RecordDescriptor, RecordId>, RecordIdHash> {};
-                visited.insert({ srcVertexRecordDescriptor.rid, { RecordDescriptor {}, RecordId {} } });
-                auto queue = std::queue<RecordId> {};
-                queue.push(srcVertexRecordDescriptor.rid);
-                while (!queue.empty() && !found) {
-                    auto vertex = queue.front();
-                    queue.pop();
-
-                    for (const auto& edgeNeighbour :
-                        RecordCompare::filterIncidentEdges(txn, vertex, Direction::OUT, edgeFilter, edgeClassFilter)) {
-                        auto nextVertex = edgeNeighbour.second.rid;
-                        if (visited.find(nextVertex) == visited.cend()) {
-                            auto vertexRdesc = RecordCompare::filterRecord(
-                                txn, nextVertex, vertexFilter, vertexClassFilter);
-                            if (vertexRdesc != RecordDescriptor {}) {
-                                visited.insert({ nextVertex, { vertexRdesc, vertex } });
-                                queue.push(nextVertex);
-                            }
-                        }
-                        if (nextVertex == dstVertexRecordDescriptor.rid) {
-                            found = true;
-                            break;
-                        }
+                auto meetingVertex = RecordId {};
+                while (!found && !srcFrontier.empty() && !dstFrontier.empty() && currentDepth < maxDepth) {
+                    if (srcFrontier.size() <= dstFrontier.size()) {
+                        found = expandFrontier(txn, srcFrontier, srcVisited, dstVisited, Direction::OUT,
+                            edgeFilter, edgeClassFilter, vertexFilter, vertexClassFilter, meetingVertex);
+                    } else {
+                        found = expandFrontier(txn, dstFrontier, dstVisited, srcVisited, Direction::IN,
+                            edgeFilter, edgeClassFilter, vertexFilter, vertexClassFilter, meetingVertex);
                     }
+                    ++currentDepth;
                 }
 
-                if (found) {
-                    auto vertex = dstVertexRecordDescriptor.rid;
-                    while (vertex != srcVertexRecordDescriptor.rid) {
-                        auto data = visited.at(vertex);
+                if (found && currentDepth >= minDepth) {
+                    auto vertex = meetingVertex;
+                    while (vertex != RecordId {}) {
+                        auto& data = srcVisited.at(vertex);
                         result.emplace_back(data.first);
                         vertex = data.second;
                     }
-                    result.emplace_back(srcVertexRecordDescriptor);
                     std::reverse(result.begin(), result.end());
+                    vertex = dstVisited.at(meetingVertex).second;
+                    while (vertex != RecordId {}) {
+                        auto& data = dstVisited.at(vertex);
+                        result.emplace_back(data.first);
+                        vertex = data.second;
+                    }
                     auto currentLevel = 0U;
                     for (auto& res : result) {
                         res._depth = currentLevel++;
@@ -192,5 +467,564 @@ namespace algorithm {
         }
         return result;
     }
+
+    bool GraphTraversal::expandFrontier(const Transaction& txn,
+        std::vector<RecordId>& frontier,
+        VisitedMap& visited,
+        const VisitedMap& otherVisited,
+        const Direction& direction,
+        const GraphFilter& edgeFilter,
+        const ClassFilter& edgeClassFilter,
+        const GraphFilter& vertexFilter,
+        const ClassFilter& vertexClassFilter,
+        RecordId& meetingVertex)
+    {
+        auto nextFrontier = std::vector<RecordId> {};
+        for (const auto& vertex : frontier) {
+            for (const auto& edgeNeighbour :
+                RecordCompare::filterIncidentEdges(txn, vertex, direction, edgeFilter, edgeClassFilter)) {
+                auto nextVertex = edgeNeighbour.second.rid;
+                if (visited.find(nextVertex) != visited.cend()) {
+                    continue;
+                }
+                auto otherVertex = otherVisited.find(nextVertex);
+                if (otherVertex != otherVisited.cend()) {
+                    // the other search has already accepted this vertex, so the first meeting is a shortest path
+                    visited.insert({ nextVertex, { otherVertex->second.first, vertex } });
+                    meetingVertex = nextVertex;
+                    return true;
+                }
+                auto vertexRdesc = RecordCompare::filterRecord(txn, nextVertex, vertexFilter, vertexClassFilter);
+                if (vertexRdesc != RecordDescriptor {}) {
+                    visited.insert({ nextVertex, { vertexRdesc, vertex } });
+                    nextFrontier.emplace_back(nextVertex);
+                }
+            }
+        }
+        frontier = std::move(nextFrontier);
+        return false;
+    }
+
+    ResultSet GraphTraversal::dijkstraShortestPath(const Transaction& txn,
+        const RecordDescriptor& srcVertexRecordDescriptor,
+        const RecordDescriptor& dstVertexRecordDescriptor,
+        unsigned int minDepth,
+        unsigned int maxDepth,
+        const std::string& weightPropertyName,
+        double (*heuristic)(const Record& vertex, const Record& destination),
+        const GraphFilter& edgeFilter,
+        const GraphFilter& vertexFilter)
+    {
+        const auto searchResultDescriptor = dijkstraShortestPathRdesc(txn, srcVertexRecordDescriptor,
+            dstVertexRecordDescriptor, minDepth, maxDepth, weightPropertyName, heuristic, edgeFilter, vertexFilter);
+
+        ResultSet result(searchResultDescriptor.size());
+        std::transform(searchResultDescriptor.begin(), searchResultDescriptor.end(), result.begin(),
+            [&txn](const RecordDescriptor& descriptor) {
+                const auto classInfo = txn._adapter->dbClass()->getInfo(descriptor.rid.first);
+                const auto& record = DataRecordUtils::getRecordWithBasicInfo(&txn, classInfo, descriptor);
+                record.setBasicInfo(DEPTH_PROPERTY, descriptor._depth);
+                return Result(descriptor, record);
+            });
+
+        return result;
+    }
+
+    std::vector<RecordDescriptor> GraphTraversal::dijkstraShortestPathRdesc(const Transaction& txn,
+        const RecordDescriptor& srcVertexRecordDescriptor,
+        const RecordDescriptor& dstVertexRecordDescriptor,
+        unsigned int minDepth,
+        unsigned int maxDepth,
+        const std::string& weightPropertyName,
+        double (*heuristic)(const Record& vertex, const Record& destination),
+        const GraphFilter& edgeFilter,
+        const GraphFilter& vertexFilter)
+    {
+        struct WeightedVertex {
+            RecordDescriptor descriptor;
+            RecordId parent;
+            double cost;
+            double estimate;
+            unsigned int depth;
+        };
+
+        struct EdgeWeightInfo {
+            PropertyAccessInfo propertyInfo;
+            std::shared_ptr<DataRecord> dataRecord;
+        };
+
+        auto result = std::vector<RecordDescriptor> {};
+        try {
+            if (srcVertexRecordDescriptor == dstVertexRecordDescriptor) {
+                if (minDepth == 0) {
+                    result.emplace_back(srcVertexRecordDescriptor);
+                }
+                return result;
+            }
+
+            auto edgeClassFilter = RecordCompare::getFilterClasses(txn, edgeFilter);
+            auto vertexClassFilter = RecordCompare::getFilterClasses(txn, vertexFilter);
+            auto dstVertexRdesc = RecordCompare::filterRecord(
+                txn, dstVertexRecordDescriptor, vertexFilter, vertexClassFilter);
+            if (dstVertexRdesc == RecordDescriptor {}) {
+                return result;
+            }
+
+            auto isVersionEnabled = txn._txnCtx->isVersionEnabled();
+            auto edgeWeightInfos = std::unordered_map<ClassId, EdgeWeightInfo> {};
+            // read a weight straight from the raw edge record, so that only the weight property is decoded
+            auto getEdgeWeight = [&](const RecordId& edge, double& weight) {
+                auto edgeWeightInfo = edgeWeightInfos.find(edge.first);
+                if (edgeWeightInfo == edgeWeightInfos.cend()) {
+                    auto classInfo = txn._adapter->dbClass()->getInfo(edge.first);
+                    auto propertyInfos = SchemaUtils::getPropertyNameMapInfo(&txn, classInfo.id, classInfo.superClassId);
+                    auto propertyInfo = propertyInfos.find(weightPropertyName);
+                    auto info = EdgeWeightInfo {};
+                    if (propertyInfo != propertyInfos.cend()) {
+                        info.propertyInfo = propertyInfo->second;
+                        info.dataRecord = std::make_shared<DataRecord>(txn._txnBase, classInfo.id, classInfo.type);
+                    }
+                    edgeWeightInfo = edgeWeightInfos.emplace(edge.first, info).first;
+                }
+                if (edgeWeightInfo->second.dataRecord == nullptr) {
+                    return false;
+                }
+                auto value = RecordParser::parseRawDataProperty(edgeWeightInfo->second.dataRecord->getResult(edge.second),
+                    edgeWeightInfo->second.propertyInfo.id, true, isVersionEnabled);
+                if (value.empty()) {
+                    return false;
+                }
+                weight = toEdgeWeight(value, edgeWeightInfo->second.propertyInfo.type);
+                return weight >= 0.0;
+            };
+
+            auto getVertexRecord = [&txn](const RecordDescriptor& vertex) {
+                auto classInfo = txn._adapter->dbClass()->getInfo(vertex.rid.first);
+                return DataRecordUtils::getRecord(&txn, classInfo, vertex);
+            };
+            // without a heuristic, every estimate is zero and the search is a plain dijkstra's algorithm
+            auto dstRecord = (heuristic != nullptr) ? getVertexRecord(dstVertexRecordDescriptor) : Record {};
+            auto estimate = [&](const RecordDescriptor& vertex) {
+                if (heuristic == nullptr || vertex.rid == dstVertexRecordDescriptor.rid) {
+                    return 0.0;
+                }
+                return (*heuristic)(getVertexRecord(vertex), dstRecord);
+            };
+
+            // an entry keeps the number of hops its vertex was reached with, so that entries within maxDepth are counted
+            using QueueEntry = std::tuple<double, RecordId, unsigned int>;
+            auto queue = std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> {};
+            auto shallowEntries = size_t { 0 };
+            auto push = [&](const RecordId& vertex, const WeightedVertex& data) {
+                queue.emplace(data.cost + data.estimate, vertex, data.depth);
+                shallowEntries += (data.depth <= maxDepth) ? 1 : 0;
+            };
+            auto visited = std::unordered_map<RecordId, WeightedVertex, RecordIdHash> {};
+            auto rejected = std::unordered_set<RecordId, RecordIdHash> {};
+            auto settled = std::unordered_set<RecordId, RecordIdHash> {};
+            push(srcVertexRecordDescriptor.rid, visited.insert({ srcVertexRecordDescriptor.rid,
+                WeightedVertex { srcVertexRecordDescriptor, RecordId {}, 0.0, estimate(srcVertexRecordDescriptor), 0U } })
+                .first->second);
+
+            // once no entry is within maxDepth hops, every path still to be found is too long and the search stops
+            auto found = false;
+            while (shallowEntries > 0) {
+                auto vertex = std::get<1>(queue.top());
+                shallowEntries -= (std::get<2>(queue.top()) <= maxDepth) ? 1 : 0;
+                queue.pop();
+                if (vertex == dstVertexRecordDescriptor.rid) {
+                    found = true;
+                    break;
+                }
+                if (!settled.insert(vertex).second) {
+                    continue;
+                }
+                auto cost = visited.at(vertex).cost;
+                auto depth = visited.at(vertex).depth + 1;
+                for (const auto& edgeNeighbour :
+                    RecordCompare::filterIncidentEdges(txn, vertex, Direction::OUT, edgeFilter, edgeClassFilter)) {
+                    auto weight = 0.0;
+                    if (!getEdgeWeight(edgeNeighbour.first.rid, weight)) {
+                        continue;
+                    }
+                    auto nextVertex = edgeNeighbour.second.rid;
+                    auto nextCost = cost + weight;
+                    auto visitedVertex = visited.find(nextVertex);
+                    if (visitedVertex == visited.cend()) {
+                        if (rejected.find(nextVertex) != rejected.cend()) {
+                            continue;
+                        }
+                        auto vertexRdesc = (nextVertex == dstVertexRecordDescriptor.rid)
+                            ? dstVertexRdesc
+                            : RecordCompare::filterRecord(txn, nextVertex, vertexFilter, vertexClassFilter);
+                        if (vertexRdesc == RecordDescriptor {}) {
+                            rejected.insert(nextVertex);
+                            continue;
+                        }
+                        visitedVertex = visited.insert({ nextVertex,
+                            WeightedVertex { vertexRdesc, vertex, nextCost, estimate(vertexRdesc), depth } }).first;
+                    } else if (nextCost < visitedVertex->second.cost) {
+                        // a cheaper way to a vertex re-opens it, which keeps A* correct with inconsistent estimates
+                        visitedVertex->second.parent = vertex;
+                        visitedVertex->second.cost = nextCost;
+                        visitedVertex->second.depth = depth;
+                        settled.erase(nextVertex);
+                    } else {
+                        continue;
+                    }
+                    push(nextVertex, visitedVertex->second);
+                }
+            }
+
+            if (found) {
+                auto vertex = dstVertexRecordDescriptor.rid;
+                while (vertex != RecordId {}) {
+                    auto& data = visited.at(vertex);
+                    result.emplace_back(data.descriptor);
+                    vertex = data.parent;
+                }
+                std::reverse(result.begin(), result.end());
+                // the range of depths applies to the number of hops of the least-cost path
+                if (result.size() - 1 < minDepth || result.size() - 1 > maxDepth) {
+                    result.clear();
+                }
+                auto currentLevel = 0U;
+                for (auto& res : result) {
+                    res._depth = currentLevel++;
+                }
+            }
+        } catch (const Error& err) {
+            if (err.code() == NOGDB_GRAPH_NOEXST_VERTEX) {
+                throw NOGDB_GRAPH_ERROR(NOGDB_GRAPH_UNKNOWN_ERR);
+            } else if (err.code() == NOGDB_CTX_INVALID_PROPTYPE) {
+                throw;
+            } else {
+                throw NOGDB_FATAL_ERROR(err);
+            }
+        }
+        return result;
+    }
+
+    size_t GraphTraversal::getMaxWorkers(const Transaction& txn)
+    {
+        auto numThreads = txn._txnCtx->getTraversalThreads();
+        return (numThreads > 0) ? static_cast<size_t>(numThreads)
+                                : std::max(static_cast<size_t>(std::thread::hardware_concurrency()), size_t { 1 });
+    }
+
+    size_t GraphTraversal::getNumWorkers(const Transaction& txn, size_t size)
+    {
+        auto numWorkers = std::min(getMaxWorkers(txn), size / PARALLEL_TRAVERSAL_MIN_VERTICES);
+        return std::max(numWorkers, size_t { 1 });
+    }
+
+    WorkerPool::WorkerPool(size_t numWorkers)
+        : _errors(numWorkers)
+    {
+        for (auto worker = size_t { 0 }; worker < numWorkers; ++worker) {
+            _threads.emplace_back(&WorkerPool::loop, this, worker);
+        }
+    }
+
+    WorkerPool::~WorkerPool() noexcept
+    {
+        {
+            std::lock_guard<std::mutex> lock { _mutex };
+            _isStopped = true;
+        }
+        _started.notify_all();
+        for (auto& thread : _threads) {
+            thread.join();
+        }
+    }
+
+    void WorkerPool::run(size_t numWorkers, size_t size, const std::function<void(size_t, size_t, size_t)>& work)
+    {
+        std::unique_lock<std::mutex> lock { _mutex };
+        _work = &work;
+        _numWorkers = std::min(numWorkers, _threads.size());
+        _size = size;
+        _numRunning = _threads.size();
+        ++_round;
+        _started.notify_all();
+        _finished.wait(lock, [this]() { return _numRunning == 0; });
+        _work = nullptr;
+        for (auto& error : _errors) {
+            if (error) {
+                auto workerError = error;
+                error = nullptr;
+                std::rethrow_exception(workerError);
+            }
+        }
+    }
+
+    void WorkerPool::loop(size_t worker)
+    {
+        auto round = size_t { 0 };
+        std::unique_lock<std::mutex> lock { _mutex };
+        while (true) {
+            _started.wait(lock, [&]() { return _isStopped || _round != round; });
+            if (_isStopped) {
+                return;
+            }
+            round = _round;
+            if (worker < _numWorkers) {
+                auto chunkSize = (_size + _numWorkers - 1) / _numWorkers;
+                auto begin = std::min(worker * chunkSize, _size);
+                auto end = std::min(begin + chunkSize, _size);
+                auto& work = *_work;
+                lock.unlock();
+                auto error = std::exception_ptr {};
+                try {
+                    work(worker, begin, end);
+                } catch (...) {
+                    error = std::current_exception();
+                }
+                lock.lock();
+                _errors[worker] = error;
+            }
+            if (--_numRunning == 0) {
+                _finished.notify_one();
+            }
+        }
+    }
+
+    RelationReaders::RelationReaders(const storage_engine::LMDBTxn& txn, size_t numReaders)
+    {
+        const RelationAccess inRel { &txn, Direction::IN };
+        const RelationAccess outRel { &txn, Direction::OUT };
+        try {
+            for (auto reader = size_t { 0 }; reader < numReaders; ++reader) {
+                auto readerTxn = std::unique_ptr<storage_engine::LMDBTxn>(
+                    new storage_engine::LMDBTxn { txn, storage_engine::lmdb::TXN_RO });
+                if (readerTxn->id() != txn.id()) {
+                    _readers.clear();
+                    return;
+                }
+                auto readerInRel = std::unique_ptr<RelationAccess>(new RelationAccess { readerTxn.get(), inRel });
+                auto readerOutRel = std::unique_ptr<RelationAccess>(new RelationAccess { readerTxn.get(), outRel });
+                // a table first opened by the transaction is unknown to other transactions until it ends
+                readerInRel->countEdges(RecordId {});
+                readerOutRel->countEdges(RecordId {});
+                _readers.emplace_back(
+                    Reader { std::move(readerTxn), std::move(readerInRel), std::move(readerOutRel) });
+            }
+        } catch (const Error&) {
+            _readers.clear();
+        }
+    }
+
+    void RelationReaders::getEdgeAndNeighbours(size_t reader,
+        const RecordId& vertex,
+        const Direction& direction,
+        std::vector<std::pair<RecordId, RecordId>>& edgeNeighbours) const
+    {
+        edgeNeighbours.clear();
+        if (direction != Direction::OUT) {
+            auto inEdgeNeighbours = _readers[reader].inRel->getEdgeAndNeighbours(vertex);
+            edgeNeighbours.insert(edgeNeighbours.cend(), inEdgeNeighbours.cbegin(), inEdgeNeighbours.cend());
+        }
+        if (direction != Direction::IN) {
+            auto outEdgeNeighbours = _readers[reader].outRel->getEdgeAndNeighbours(vertex);
+            edgeNeighbours.insert(edgeNeighbours.cend(), outEdgeNeighbours.cbegin(), outEdgeNeighbours.cend());
+        }
+    }
+
+    double GraphTraversal::toEdgeWeight(const Bytes& value, const PropertyType& type)
+    {
+        switch (type) {
+        case PropertyType::TINYINT:
+            return static_cast<double>(value.toTinyInt());
+        case PropertyType::UNSIGNED_TINYINT:
+            return static_cast<double>(value.toTinyIntU());
+        case PropertyType::SMALLINT:
+            return static_cast<double>(value.toSmallInt());
+        case PropertyType::UNSIGNED_SMALLINT:
+            return static_cast<double>(value.toSmallIntU());
+        case PropertyType::INTEGER:
+            return static_cast<double>(value.toInt());
+        case PropertyType::UNSIGNED_INTEGER:
+            return static_cast<double>(value.toIntU());
+        case PropertyType::BIGINT:
+            return static_cast<double>(value.toBigInt());
+        case PropertyType::UNSIGNED_BIGINT:
+            return static_cast<double>(value.toBigIntU());
+        case PropertyType::REAL:
+            return value.toReal();
+        default:
+            throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_INVALID_PROPTYPE);
+        }
+    }
+
+    AdjacencySnapshot::AdjacencySnapshot(const Transaction& txn)
+    {
+        for (const auto& classInfo : txn._adapter->dbClass()->getAllInfos()) {
+            if (classInfo.type == ClassType::VERTEX) {
+                DataRecord vertexDataRecord { txn._txnBase, classInfo.id, classInfo.type };
+                vertexDataRecord.resultSetIter([&](const PositionId& positionId, const storage_engine::lmdb::Result&) {
+                    vertices.emplace_back(RecordId { classInfo.id, positionId });
+                });
+            }
+        }
+        std::sort(vertices.begin(), vertices.end());
+
+        auto fill = [&](const Direction& direction,
+                        std::vector<size_t>& offsets,
+                        std::vector<size_t>& neighbours,
+                        std::vector<RecordId>& edges) {
+            // relation keys are ordered as text, so entries are grouped by vertex but not in vertex order
+            auto entries = std::vector<std::pair<size_t, std::pair<RecordId, size_t>>> {};
+            const RelationAccess relation { txn._txnBase, direction };
+            relation.relationIter([&](const RecordId& vertexId, const RecordId& edgeId, const RecordId& neighbourId) {
+                auto vertex = indexOf(vertexId);
+                auto neighbour = indexOf(neighbourId);
+                if (vertex < vertices.size() && neighbour < vertices.size()) {
+                    entries.emplace_back(vertex, std::make_pair(edgeId, neighbour));
+                }
+            });
+
+            offsets.assign(vertices.size() + 1, size_t { 0 });
+            for (const auto& entry : entries) {
+                ++offsets[entry.first + 1];
+            }
+            for (auto i = size_t { 0 }; i < vertices.size(); ++i) {
+                offsets[i + 1] += offsets[i];
+            }
+            neighbours.resize(entries.size());
+            edges.resize(entries.size());
+            auto positions = std::vector<size_t>(offsets.cbegin(), offsets.cend() - 1);
+            for (const auto& entry : entries) {
+                auto position = positions[entry.first]++;
+                edges[position] = entry.second.first;
+                neighbours[position] = entry.second.second;
+            }
+        };
+        fill(Direction::OUT, outOffsets, outNeighbours, outEdges);
+        fill(Direction::IN, inOffsets, inNeighbours, inEdges);
+    }
+
+    size_t AdjacencySnapshot::indexOf(const RecordId& vertex) const
+    {
+        auto found = std::lower_bound(vertices.cbegin(), vertices.cend(), vertex);
+        return (found != vertices.cend() && *found == vertex)
+            ? static_cast<size_t>(found - vertices.cbegin())
+            : vertices.size();
+    }
+
+    bool AdjacencySnapshot::getEdgeAndNeighbours(const RecordId& vertex,
+        const Direction& direction,
+        std::vector<std::pair<RecordId, RecordId>>& edgeNeighbours) const
+    {
+        auto index = indexOf(vertex);
+        if (index == vertices.size()) {
+            return false;
+        }
+        edgeNeighbours.clear();
+        if (direction != Direction::OUT) {
+            for (auto i = inOffsets[index]; i < inOffsets[index + 1]; ++i) {
+                edgeNeighbours.emplace_back(inEdges[i], vertices[inNeighbours[i]]);
+            }
+        }
+        if (direction != Direction::IN) {
+            for (auto i = outOffsets[index]; i < outOffsets[index + 1]; ++i) {
+                edgeNeighbours.emplace_back(outEdges[i], vertices[outNeighbours[i]]);
+            }
+        }
+        return true;
+    }
+
+    size_t AdjacencySnapshot::getNumWorkers() const
+    {
+        auto numWorkers = std::min(static_cast<size_t>(std::thread::hardware_concurrency()),
+            vertices.size() / PARALLEL_TRAVERSAL_MIN_VERTICES);
+        return std::max(numWorkers, size_t { 1 });
+    }
+
+    void AdjacencySnapshot::runInParallel(size_t numWorkers,
+        const std::function<void(size_t, size_t, size_t)>& work) const
+    {
+        auto size = vertices.size();
+        if (numWorkers < 2) {
+            work(0, 0, size);
+            return;
+        }
+
+        // a snapshot is only read, so its workers need no transaction of their own
+        auto chunkSize = (size + numWorkers - 1) / numWorkers;
+        auto errors = std::vector<std::exception_ptr>(numWorkers);
+        auto workers = std::vector<std::thread> {};
+        for (auto worker = size_t { 0 }; worker < numWorkers; ++worker) {
+            workers.emplace_back([&, worker]() {
+                try {
+                    auto begin = std::min(worker * chunkSize, size);
+                    auto end = std::min(begin + chunkSize, size);
+                    work(worker, begin, end);
+                } catch (...) {
+                    errors[worker] = std::current_exception();
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+    std::shared_ptr<const AdjacencySnapshot> AdjacencyCache::get(const Transaction& txn)
+    {
+        if (txn._txnMode != TxnMode::READ_ONLY) {
+            return nullptr;
+        }
+        auto txnId = txn._txnBase->id();
+        {
+            std::lock_guard<std::mutex> lock { _mutex };
+            if (_snapshot != nullptr && _txnId == txnId) {
+                return _snapshot;
+            }
+            // a reader older than the cached snapshot keeps reading the relation tables, and so does any reader
+            // while another one takes a snapshot, rather than waiting for it
+            if ((_snapshot != nullptr && txnId < _txnId) || _isBuilding) {
+                return nullptr;
+            }
+            _isBuilding = true;
+        }
+
+        // the snapshot is taken without the lock, so that readers of the cached one are never held up
+        auto snapshot = std::shared_ptr<const AdjacencySnapshot> {};
+        try {
+            snapshot = std::make_shared<const AdjacencySnapshot>(txn);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock { _mutex };
+            _isBuilding = false;
+            throw;
+        }
+        std::lock_guard<std::mutex> lock { _mutex };
+        if (_snapshot == nullptr || txnId >= _txnId) {
+            _snapshot = snapshot;
+            _txnId = txnId;
+        }
+        _isBuilding = false;
+        return snapshot;
+    }
+
+    std::shared_ptr<const AdjacencySnapshot> AdjacencyCache::find(const Transaction& txn)
+    {
+        if (txn._txnMode != TxnMode::READ_ONLY) {
+            return nullptr;
+        }
+        auto txnId = txn._txnBase->id();
+        std::lock_guard<std::mutex> lock { _mutex };
+        return (_snapshot != nullptr && _txnId == txnId) ? _snapshot : nullptr;
+    }
+
+    void AdjacencyCache::invalidate()
+    {
+        std::lock_guard<std::mutex> lock { _mutex };
+        _snapshot = nullptr;
+    }
 }
 }
@@ -21,10 +21,18 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <queue>
 #include <set>
 #include <stack>
+#include <thread>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -45,6 +53,254 @@ namespace algorithm {
     using namespace adapter::schema;
     using namespace adapter::relation;
 
+    // the smallest number of frontier vertices given to each worker thread of a traversal
+    constexpr size_t PARALLEL_TRAVERSAL_MIN_VERTICES = 1024;
+
+    // worker threads kept for a whole traversal, so that each level reuses them instead of starting new ones
+    class WorkerPool {
+    public:
+        explicit WorkerPool(size_t numWorkers);
+
+        ~WorkerPool() noexcept;
+
+        WorkerPool(const WorkerPool&) = delete;
+
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        // gives each of the first numWorkers threads a range of [0, size) and returns once all of them are done
+        void run(size_t numWorkers, size_t size, const std::function<void(size_t, size_t, size_t)>& work);
+
+    private:
+        void loop(size_t worker);
+
+        std::vector<std::thread> _threads {};
+        std::mutex _mutex {};
+        std::condition_variable _started {};
+        std::condition_variable _finished {};
+        const std::function<void(size_t, size_t, size_t)>* _work { nullptr };
+        size_t _numWorkers { 0 };
+        size_t _size { 0 };
+        size_t _round { 0 };
+        size_t _numRunning { 0 };
+        bool _isStopped { false };
+        std::vector<std::exception_ptr> _errors {};
+    };
+
+    // read-only transactions that let worker threads read the relation tables on the snapshot of a read-only
+    // transaction; the tables are opened by that transaction alone, since lmdb must not open them concurrently
+    class RelationReaders {
+    public:
+        RelationReaders(const storage_engine::LMDBTxn& txn, size_t numReaders);
+
+        RelationReaders(const RelationReaders&) = delete;
+
+        RelationReaders& operator=(const RelationReaders&) = delete;
+
+        // false when a commit came in after the transaction began, so that the readers would see other data
+        bool isValid() const noexcept
+        {
+            return !_readers.empty();
+        }
+
+        // the same edges and neighbours in the same order as the transaction reads them
+        void getEdgeAndNeighbours(size_t reader,
+            const RecordId& vertex,
+            const Direction& direction,
+            std::vector<std::pair<RecordId, RecordId>>& edgeNeighbours) const;
+
+    private:
+        struct Reader {
+            std::unique_ptr<storage_engine::LMDBTxn> txn;
+            std::unique_ptr<RelationAccess> inRel;
+            std::unique_ptr<RelationAccess> outRel;
+        };
+
+        std::vector<Reader> _readers {};
+    };
+
+    // a set of record ids kept as one dense bitmap per class, indexed by position id
+    class RecordIdBitmap {
+    public:
+        // returns false if the record id is already in the set
+        bool insert(const RecordId& rid)
+        {
+            auto& bitmap = _bitmaps[rid.first];
+            auto word = static_cast<size_t>(rid.second / BITS_PER_WORD);
+            if (word >= bitmap.size()) {
+                bitmap.resize(word + 1, uint64_t { 0 });
+            }
+            auto mask = uint64_t { 1 } << (rid.second % BITS_PER_WORD);
+            if (bitmap[word] & mask) {
+                return false;
+            }
+            bitmap[word] |= mask;
+            return true;
+        }
+
+        bool contains(const RecordId& rid) const
+        {
+            auto bitmap = _bitmaps.find(rid.first);
+            if (bitmap == _bitmaps.cend()) {
+                return false;
+            }
+            auto word = static_cast<size_t>(rid.second / BITS_PER_WORD);
+            return word < bitmap->second.size()
+                && (bitmap->second[word] & (uint64_t { 1 } << (rid.second % BITS_PER_WORD)));
+        }
+
+    private:
+        static constexpr PositionId BITS_PER_WORD = 64;
+
+        std::unordered_map<ClassId, std::vector<uint64_t>> _bitmaps {};
+    };
+
+    // a flat array of record ids packed into 6 bytes each, without the padding of std::pair
+    class PackedRecordIds {
+    public:
+        static constexpr size_t PACKED_SIZE = sizeof(ClassId) + sizeof(PositionId);
+
+        void push_back(const RecordId& rid)
+        {
+            auto offset = _data.size();
+            _data.resize(offset + PACKED_SIZE);
+            memcpy(_data.data() + offset, &rid.first, sizeof(ClassId));
+            memcpy(_data.data() + offset + sizeof(ClassId), &rid.second, sizeof(PositionId));
+        }
+
+        RecordId operator[](size_t index) const
+        {
+            auto rid = RecordId {};
+            memcpy(&rid.first, _data.data() + index * PACKED_SIZE, sizeof(ClassId));
+            memcpy(&rid.second, _data.data() + index * PACKED_SIZE + sizeof(ClassId), sizeof(PositionId));
+            return rid;
+        }
+
+        size_t size() const noexcept
+        {
+            return _data.size() / PACKED_SIZE;
+        }
+
+        bool empty() const noexcept
+        {
+            return _data.empty();
+        }
+
+        void clear() noexcept
+        {
+            _data.clear();
+        }
+
+    private:
+        std::vector<uint8_t> _data {};
+    };
+
+    // a compressed sparse row copy of the edges between every vertex, read in one pass over each relation table
+    struct AdjacencySnapshot {
+        explicit AdjacencySnapshot(const Transaction& txn);
+
+        // returns the number of vertices if the record id is not a vertex of the snapshot
+        size_t indexOf(const RecordId& vertex) const;
+
+        // the same edges and neighbours in the same order as the relation tables give, or false if the vertex
+        // is not in the snapshot
+        bool getEdgeAndNeighbours(const RecordId& vertex,
+            const Direction& direction,
+            std::vector<std::pair<RecordId, RecordId>>& edgeNeighbours) const;
+
+        size_t getNumWorkers() const;
+
+        // gives each worker thread a range of vertex indexes
+        void runInParallel(size_t numWorkers, const std::function<void(size_t, size_t, size_t)>& work) const;
+
+        // vertices are kept in record id order, so that the index of a vertex is found by a binary search
+        std::vector<RecordId> vertices {};
+        // the out-neighbours of vertex i are outNeighbours[outOffsets[i]] up to outNeighbours[outOffsets[i + 1]],
+        // reached through the edges at the same positions of outEdges
+        std::vector<size_t> outOffsets {};
+        std::vector<size_t> outNeighbours {};
+        std::vector<RecordId> outEdges {};
+        std::vector<size_t> inOffsets {};
+        std::vector<size_t> inNeighbours {};
+        std::vector<RecordId> inEdges {};
+    };
+
+    // the adjacency snapshot kept by a context, which only serves transactions reading the same data
+    class AdjacencyCache {
+    public:
+        // takes a snapshot unless the cached one holds the data of the transaction; returns nullptr for
+        // a read-write transaction, whose uncommitted changes are not in any snapshot, and while another
+        // transaction is taking one
+        std::shared_ptr<const AdjacencySnapshot> get(const Transaction& txn);
+
+        // the cached snapshot if it holds the data of the transaction, without ever taking one
+        std::shared_ptr<const AdjacencySnapshot> find(const Transaction& txn);
+
+        void invalidate();
+
+    private:
+        std::mutex _mutex {};
+        std::shared_ptr<const AdjacencySnapshot> _snapshot {};
+        // read-only transactions beginning between the same two commits share one lmdb transaction id
+        size_t _txnId { 0 };
+        bool _isBuilding { false };
+    };
+
+    // a vertex reached by a traversal, with the edge and the earlier node it was reached from
+    struct TraversalNode {
+        RecordId vertex;
+        RecordId edge;
+        size_t parent;
+        unsigned int depth;
+    };
+
+    // a traversal that finds one vertex at a time, either breadth-first or depth-first
+    class TraversalState {
+    public:
+        TraversalState(const Transaction& txn,
+            const std::set<RecordDescriptor>& recordDescriptors,
+            unsigned int minDepth,
+            unsigned int maxDepth,
+            const Direction& direction,
+            bool isDepthFirst,
+            const GraphFilter& edgeFilter,
+            const GraphFilter& vertexFilter);
+
+        // returns an empty record descriptor when no vertex is left
+        RecordDescriptor next();
+
+        // finds every vertex, including the ones above the minimum depth which only lead to deeper vertices;
+        // nodes are numbered in the order they are found and returns false when no vertex is left.
+        // A depth-first search gives each vertex its depth in the depth-first tree, which is the length
+        // of the path it was first found along and not necessarily the shortest one
+        bool nextNode(TraversalNode& node);
+
+    private:
+        // a vertex whose neighbours are being visited
+        struct Frame {
+            RecordId vertex;
+            size_t node;
+            unsigned int depth;
+            bool isExpanded;
+            std::vector<std::pair<RecordId, RecordId>> edgeNeighbours;
+            size_t index;
+        };
+
+        const Transaction& _txn;
+        unsigned int _minDepth;
+        unsigned int _maxDepth;
+        Direction _direction;
+        bool _isDepthFirst;
+        GraphFilter _edgeFilter;
+        GraphFilter _vertexFilter;
+        compare::ClassFilter _edgeClassFilter {};
+        compare::ClassFilter _vertexClassFilter {};
+        RecordIdBitmap _visited {};
+        size_t _numNodes { 0 };
+        // breadth-first search takes frames from the front as a queue, depth-first search from the back as a stack
+        std::deque<Frame> _frames {};
+        std::deque<RecordId> _sources {};
+    };
+
     class GraphTraversal {
     public:
         GraphTraversal() = delete;
@@ -67,17 +323,104 @@ namespace algorithm {
             const GraphFilter& edgeFilter,
             const GraphFilter& vertexFilter);
 
+        static unsigned long breadthFirstSearchCount(const Transaction& txn,
+            const std::set<RecordDescriptor>& recordDescriptors,
+            unsigned int minDepth,
+            unsigned int maxDepth,
+            const Direction& direction,
+            const GraphFilter& edgeFilter,
+            const GraphFilter& vertexFilter);
+
+        static ResultSet depthFirstSearch(const Transaction& txn,
+            const std::set<RecordDescriptor>& recordDescriptors,
+            unsigned int minDepth,
+            unsigned int maxDepth,
+            const Direction& direction,
+            const GraphFilter& edgeFilter,
+            const GraphFilter& vertexFilter);
+
+        static std::vector<RecordDescriptor> depthFirstSearchRdesc(const Transaction& txn,
+            const std::set<RecordDescriptor>& recordDescriptors,
+            unsigned int minDepth,
+            unsigned int maxDepth,
+            const Direction& direction,
+            const GraphFilter& edgeFilter,
+            const GraphFilter& vertexFilter);
+
+        static unsigned long depthFirstSearchCount(const Transaction& txn,
+            const std::set<RecordDescriptor>& recordDescriptors,
+            unsigned int minDepth,
+            unsigned int maxDepth,
+            const Direction& direction,
+            const GraphFilter& edgeFilter,
+            const GraphFilter& vertexFilter);
+
         static ResultSet bfsShortestPath(const Transaction& txn,
             const RecordDescriptor& srcVertexRecordDescriptor,
             const RecordDescriptor& dstVertexRecordDescriptor,
+            unsigned int minDepth,
+            unsigned int maxDepth,
             const GraphFilter& edgeFilter,
             const GraphFilter& vertexFilter);
 
         static std::vector<RecordDescriptor> bfsShortestPathRdesc(const Transaction& txn,
             const RecordDescriptor& srcVertexRecordDescriptor,
             const RecordDescriptor& dstVertexRecordDescriptor,
+            unsigned int minDepth,
+            unsigned int maxDepth,
+            const GraphFilter& edgeFilter,
+            const GraphFilter& vertexFilter);
+
+        static ResultSet dijkstraShortestPath(const Transaction& txn,
+            const RecordDescriptor& srcVertexRecordDescriptor,
+            const RecordDescriptor& dstVertexRecordDescriptor,
+            unsigned int minDepth,
+            unsigned int maxDepth,
+            const std::string& weightPropertyName,
+            double (*heuristic)(const Record& vertex, const Record& destination),
+            const GraphFilter& edgeFilter,
+            const GraphFilter& vertexFilter);
+
+        static std::vector<RecordDescriptor> dijkstraShortestPathRdesc(const Transaction& txn,
+            const RecordDescriptor& srcVertexRecordDescriptor,
+            const RecordDescriptor& dstVertexRecordDescriptor,
+            unsigned int minDepth,
+            unsigned int maxDepth,
+            const std::string& weightPropertyName,
+            double (*heuristic)(const Record& vertex, const Record& destination),
             const GraphFilter& edgeFilter,
             const GraphFilter& vertexFilter);
+
+    private:
+        // calls the visitor with every vertex found within the depth range, level by level
+        static void breadthFirstVisit(const Transaction& txn,
+            const std::set<RecordDescriptor>& recordDescriptors,
+            unsigned int minDepth,
+            unsigned int maxDepth,
+            const Direction& direction,
+            const GraphFilter& edgeFilter,
+            const GraphFilter& vertexFilter,
+            const std::function<void(const RecordId&, unsigned int)>& visit);
+
+        // a visited vertex mapped to its descriptor and to the vertex next to it on the way back to the origin
+        using VisitedMap = std::unordered_map<RecordId, std::pair<RecordDescriptor, RecordId>, RecordIdHash>;
+
+        static bool expandFrontier(const Transaction& txn,
+            std::vector<RecordId>& frontier,
+            VisitedMap& visited,
+            const VisitedMap& otherVisited,
+            const Direction& direction,
+            const GraphFilter& edgeFilter,
+            const compare::ClassFilter& edgeClassFilter,
+            const GraphFilter& vertexFilter,
+            const compare::ClassFilter& vertexClassFilter,
+            RecordId& meetingVertex);
+
+        static size_t getMaxWorkers(const Transaction& txn);
+
+        static size_t getNumWorkers(const Transaction& txn, size_t size);
+
+        static double toEdgeWeight(const Bytes& value, const PropertyType& type);
     };
 }
 }
\ No newline at end of file
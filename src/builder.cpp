@@ -126,6 +126,18 @@ TraverseOperationBuilder& TraverseOperationBuilder::depth(unsigned int minDepth,
     return *this;
 }
 
+TraverseOperationBuilder& TraverseOperationBuilder::breadthFirst()
+{
+    _strategy = TraversalStrategy::BREADTH_FIRST;
+    return *this;
+}
+
+TraverseOperationBuilder& TraverseOperationBuilder::depthFirst()
+{
+    _strategy = TraversalStrategy::DEPTH_FIRST;
+    return *this;
+}
+
 ShortestPathOperationBuilder::ShortestPathOperationBuilder(const Transaction* txn,
     const RecordDescriptor& srcVertexRecordDescriptor,
     const RecordDescriptor& dstVertexRecordDescriptor)
@@ -147,4 +159,36 @@ ShortestPathOperationBuilder& ShortestPathOperationBuilder::whereE(const GraphFi
     return *this;
 }
 
+ShortestPathOperationBuilder& ShortestPathOperationBuilder::minDepth(unsigned int depth)
+{
+    _minDepth = depth;
+    return *this;
+}
+
+ShortestPathOperationBuilder& ShortestPathOperationBuilder::maxDepth(unsigned int depth)
+{
+    _maxDepth = depth;
+    return *this;
+}
+
+ShortestPathOperationBuilder& ShortestPathOperationBuilder::depth(unsigned int minDepth, unsigned int maxDepth)
+{
+    _minDepth = minDepth;
+    _maxDepth = maxDepth;
+    return *this;
+}
+
+ShortestPathOperationBuilder& ShortestPathOperationBuilder::weightedBy(const std::string& propName)
+{
+    _weightPropName = propName;
+    return *this;
+}
+
+ShortestPathOperationBuilder& ShortestPathOperationBuilder::heuristic(
+    double (*estimator)(const Record& vertex, const Record& destination))
+{
+    _heuristic = estimator;
+    return *this;
+}
+
 }
\ No newline at end of file
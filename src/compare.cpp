@@ -19,9 +19,12 @@
  *
  */
 
+#include <algorithm>
+#include <cstring>
 #include <regex>
 #include <utility>
 
+#include "algorithm.hpp"
 #include "compare.hpp"
 #include "datarecord.hpp"
 #include "index.hpp"
@@ -37,6 +40,378 @@ namespace compare {
     using namespace index;
     using compare::RecordCompare;
   
+    namespace {
+        // the condition may be compiled for a type wider than the one its operands were given in
+        template <typename T>
+        T decode(const Bytes& valueBytes)
+        {
+            auto value = T {};
+            if (!valueBytes.empty()) {
+                memcpy(&value, valueBytes.getRaw(), std::min(valueBytes.size(), sizeof(T)));
+            }
+            return value;
+        }
+    }
+
+    std::unique_ptr<const NumericKernel> ConditionMatcher::createKernel() const
+    {
+        switch (_type) {
+        case PropertyType::TINYINT:
+            return createKernel<int8_t>();
+        case PropertyType::UNSIGNED_TINYINT:
+            return createKernel<uint8_t>();
+        case PropertyType::SMALLINT:
+            return createKernel<int16_t>();
+        case PropertyType::UNSIGNED_SMALLINT:
+            return createKernel<uint16_t>();
+        case PropertyType::INTEGER:
+            return createKernel<int32_t>();
+        case PropertyType::UNSIGNED_INTEGER:
+            return createKernel<uint32_t>();
+        case PropertyType::BIGINT:
+            return createKernel<int64_t>();
+        case PropertyType::UNSIGNED_BIGINT:
+            return createKernel<uint64_t>();
+        case PropertyType::REAL:
+            return createKernel<double>();
+        default:
+            return nullptr;
+        }
+    }
+
+    template <typename T>
+    std::unique_ptr<const NumericKernel> ConditionMatcher::createKernel() const
+    {
+        switch (_comp) {
+        case Condition::Comparator::EQUAL:
+            return createComparisonKernel<T, comparison::Equal>();
+        case Condition::Comparator::GREATER:
+            return createComparisonKernel<T, comparison::Greater>();
+        case Condition::Comparator::GREATER_EQUAL:
+            return createComparisonKernel<T, comparison::GreaterEqual>();
+        case Condition::Comparator::LESS:
+            return createComparisonKernel<T, comparison::Less>();
+        case Condition::Comparator::LESS_EQUAL:
+            return createComparisonKernel<T, comparison::LessEqual>();
+        case Condition::Comparator::BETWEEN:
+            return createComparisonKernel<T, comparison::Between>();
+        case Condition::Comparator::BETWEEN_NO_LOWER:
+            return createComparisonKernel<T, comparison::BetweenNoLower>();
+        case Condition::Comparator::BETWEEN_NO_UPPER:
+            return createComparisonKernel<T, comparison::BetweenNoUpper>();
+        case Condition::Comparator::BETWEEN_NO_BOUND:
+            return createComparisonKernel<T, comparison::BetweenNoBound>();
+        case Condition::Comparator::IN: {
+            auto values = std::vector<T> {};
+            for (const auto& valueBytes : _valueSet) {
+                values.emplace_back(decode<T>(valueBytes));
+            }
+            return std::unique_ptr<const NumericKernel> { new InKernel<T>(std::move(values), _isNegative) };
+        }
+        default:
+            // the generic comparison reports an invalid comparator when a value is matched
+            return nullptr;
+        }
+    }
+
+    template <typename T, typename Cmp>
+    std::unique_ptr<const NumericKernel> ConditionMatcher::createComparisonKernel() const
+    {
+        auto isRange = _comp >= Condition::Comparator::BETWEEN && _comp <= Condition::Comparator::BETWEEN_NO_BOUND;
+        auto lower = isRange ? decode<T>(_valueSet[0]) : decode<T>(_valueBytes);
+        auto upper = isRange ? decode<T>(_valueSet[1]) : T {};
+        return std::unique_ptr<const NumericKernel> { new ComparisonKernel<T, Cmp>(lower, upper, _isNegative) };
+    }
+
+    ConditionMatcher::ConditionMatcher(const Condition& condition, const PropertyType& type)
+        : _type { type }
+        , _comp { condition.comp }
+        , _isIgnoreCase { condition.isIgnoreCase }
+        , _isNegative { condition.isNegative }
+        , _valueBytes { condition.valueBytes }
+        , _valueSet { condition.valueSet }
+    {
+        if (type != PropertyType::TEXT) {
+            _kernel = createKernel();
+            return;
+        }
+        auto toText = [&](const Bytes& value) {
+            if (value.empty()) {
+                return std::string {};
+            }
+            return _isIgnoreCase ? RecordCompare::toLower(value.toText()) : value.toText();
+        };
+        if (_comp == Condition::Comparator::IN
+            || (_comp >= Condition::Comparator::BETWEEN && _comp <= Condition::Comparator::BETWEEN_NO_BOUND)) {
+            for (const auto& value : _valueSet) {
+                _texts.emplace_back(toText(value));
+            }
+        } else if (_comp != Condition::Comparator::IS_NULL && _comp != Condition::Comparator::NOT_NULL) {
+            _texts.emplace_back(toText(_valueBytes));
+        }
+        if (_comp == Condition::Comparator::LIKE) {
+            auto pattern = _texts[0];
+            utils::string::replaceAll(pattern, "%", "(.*)");
+            utils::string::replaceAll(pattern, "_", "(.)");
+            _pattern = std::regex(pattern);
+        } else if (_comp == Condition::Comparator::REGEX) {
+            _pattern = std::regex(_texts[0]);
+        }
+    }
+
+    bool ConditionMatcher::match(const Bytes& value) const
+    {
+        switch (_comp) {
+        case Condition::Comparator::IS_NULL:
+            return value.empty();
+        case Condition::Comparator::NOT_NULL:
+            return !value.empty();
+        default:
+            break;
+        }
+        if (value.empty()) {
+            return false;
+        }
+
+        if (_kernel != nullptr) {
+            return _kernel->match(value.getRaw());
+        }
+        if (_type != PropertyType::TEXT) {
+            if (_comp == Condition::Comparator::IN) {
+                for (const auto& valueBytes : _valueSet) {
+                    if (RecordCompare::genericCompareFunc(
+                            value, _type, valueBytes, Bytes {}, Condition::Comparator::EQUAL, _isIgnoreCase)
+                        ^ _isNegative) {
+                        return true;
+                    }
+                }
+                return false;
+            } else if (_comp >= Condition::Comparator::BETWEEN && _comp <= Condition::Comparator::BETWEEN_NO_BOUND) {
+                return RecordCompare::genericCompareFunc(
+                           value, _type, _valueSet[0], _valueSet[1], _comp, _isIgnoreCase)
+                    ^ _isNegative;
+            }
+            return RecordCompare::genericCompareFunc(value, _type, _valueBytes, Bytes {}, _comp, _isIgnoreCase)
+                ^ _isNegative;
+        }
+
+        // only the value of each record is still converted and folded
+        auto text = _isIgnoreCase ? RecordCompare::toLower(value.toText()) : value.toText();
+        if (_comp == Condition::Comparator::IN) {
+            for (const auto& cmpText : _texts) {
+                if ((text == cmpText) ^ _isNegative) {
+                    return true;
+                }
+            }
+            return false;
+        }
+        return compareText(text) ^ _isNegative;
+    }
+
+    bool ConditionMatcher::compareText(const std::string& text) const
+    {
+        switch (_comp) {
+        case Condition::Comparator::EQUAL:
+            return text == _texts[0];
+        case Condition::Comparator::GREATER:
+            return text > _texts[0];
+        case Condition::Comparator::GREATER_EQUAL:
+            return text >= _texts[0];
+        case Condition::Comparator::LESS:
+            return text < _texts[0];
+        case Condition::Comparator::LESS_EQUAL:
+            return text <= _texts[0];
+        case Condition::Comparator::CONTAIN:
+            return text.find(_texts[0]) < strlen(text.c_str());
+        case Condition::Comparator::BEGIN_WITH:
+            return text.compare(0, _texts[0].size(), _texts[0]) == 0;
+        case Condition::Comparator::END_WITH:
+            return text.size() >= _texts[0].size()
+                && text.compare(text.size() - _texts[0].size(), _texts[0].size(), _texts[0]) == 0;
+        case Condition::Comparator::LIKE:
+        case Condition::Comparator::REGEX:
+            return std::regex_match(text, _pattern);
+        case Condition::Comparator::BETWEEN:
+            return (_texts[0] <= text) && (text <= _texts[1]);
+        case Condition::Comparator::BETWEEN_NO_LOWER:
+            return (_texts[0] < text) && (text <= _texts[1]);
+        case Condition::Comparator::BETWEEN_NO_UPPER:
+            return (_texts[0] <= text) && (text < _texts[1]);
+        case Condition::Comparator::BETWEEN_NO_BOUND:
+            return (_texts[0] < text) && (text < _texts[1]);
+        default:
+            throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_INVALID_COMPARATOR);
+        }
+    }
+
+    MultiConditionMatcher::MultiConditionMatcher(const MultiCondition& multiCondition,
+        const PropertyNameMapInfo& propertyNameMapInfo)
+    {
+        build(multiCondition.root, propertyNameMapInfo);
+    }
+
+    bool MultiConditionMatcher::match(const Record& record) const
+    {
+        return match(_nodes.size() - 1, record);
+    }
+
+    size_t MultiConditionMatcher::build(const std::shared_ptr<MultiCondition::ExprNode>& exprNode,
+        const PropertyNameMapInfo& propertyNameMapInfo)
+    {
+        auto node = Node {};
+        if (exprNode->checkIfCondition()) {
+            const auto& condition = std::static_pointer_cast<MultiCondition::ConditionNode>(exprNode)->getCondition();
+            auto foundProperty = propertyNameMapInfo.find(condition.propName);
+            if (foundProperty != propertyNameMapInfo.cend()) {
+                auto isNullCheck = condition.comp == Condition::Comparator::IS_NULL
+                    || condition.comp == Condition::Comparator::NOT_NULL;
+                node.type = NodeType::CONDITION;
+                node.propName = condition.propName;
+                node.matcher = std::make_shared<const ConditionMatcher>(condition, foundProperty->second.type);
+                // the matcher leaves out the negation of a null check, which an expression applies
+                node.isNegative = isNullCheck && condition.isNegative;
+                node.cost = estimateCost(condition, foundProperty->second.type);
+                node.selectivity = estimateSelectivity(condition);
+            }
+        } else if (exprNode->checkIfCmpFunction()) {
+            node.type = NodeType::CMP_FUNCTION;
+            node.cmpFunction = exprNode;
+            node.cost = 32.0;
+            node.selectivity = 0.5;
+        } else {
+            auto compositeNode = std::static_pointer_cast<MultiCondition::CompositeNode>(exprNode);
+            node.type = (compositeNode->getOperator() == MultiCondition::Operator::AND) ? NodeType::AND : NodeType::OR;
+            node.isNegative = compositeNode->getIsNegative();
+            addChildren(node, compositeNode->getLeftNode(), propertyNameMapInfo);
+            addChildren(node, compositeNode->getRightNode(), propertyNameMapInfo);
+
+            // AND stops at the first false child and OR at the first true one, so the children are ordered
+            // by their cost for each record they decide
+            auto isAnd = node.type == NodeType::AND;
+            auto expectedCost = [&](size_t nodeIndex) {
+                const auto& child = _nodes[nodeIndex];
+                auto decidingFraction = isAnd ? 1.0 - child.selectivity : child.selectivity;
+                return child.cost / std::max(decidingFraction, 0.001);
+            };
+            std::stable_sort(node.children.begin(), node.children.end(), [&](size_t lhs, size_t rhs) {
+                return expectedCost(lhs) < expectedCost(rhs);
+            });
+            auto notSelected = 1.0;
+            auto selected = 1.0;
+            for (const auto& child : node.children) {
+                node.cost += _nodes[child].cost;
+                selected *= _nodes[child].selectivity;
+                notSelected *= 1.0 - _nodes[child].selectivity;
+            }
+            node.selectivity = isAnd ? selected : 1.0 - notSelected;
+            if (node.isNegative) {
+                node.selectivity = 1.0 - node.selectivity;
+            }
+        }
+        _nodes.emplace_back(std::move(node));
+        return _nodes.size() - 1;
+    }
+
+    void MultiConditionMatcher::addChildren(Node& node,
+        const std::shared_ptr<MultiCondition::ExprNode>& exprNode,
+        const PropertyNameMapInfo& propertyNameMapInfo)
+    {
+        if (!exprNode->checkIfCondition() && !exprNode->checkIfCmpFunction()) {
+            auto compositeNode = std::static_pointer_cast<MultiCondition::CompositeNode>(exprNode);
+            auto isAnd = compositeNode->getOperator() == MultiCondition::Operator::AND;
+            if (isAnd == (node.type == NodeType::AND) && !compositeNode->getIsNegative()) {
+                addChildren(node, compositeNode->getLeftNode(), propertyNameMapInfo);
+                addChildren(node, compositeNode->getRightNode(), propertyNameMapInfo);
+                return;
+            }
+        }
+        node.children.emplace_back(build(exprNode, propertyNameMapInfo));
+    }
+
+    bool MultiConditionMatcher::match(size_t nodeIndex, const Record& record) const
+    {
+        const auto& node = _nodes[nodeIndex];
+        switch (node.type) {
+        case NodeType::CONDITION:
+            return node.matcher->match(record.get(node.propName)) ^ node.isNegative;
+        case NodeType::CMP_FUNCTION:
+            return node.cmpFunction->check(record, PropertyMapType {});
+        case NodeType::AND:
+            for (const auto& child : node.children) {
+                if (!match(child, record)) {
+                    return node.isNegative;
+                }
+            }
+            return !node.isNegative;
+        case NodeType::OR:
+            for (const auto& child : node.children) {
+                if (match(child, record)) {
+                    return !node.isNegative;
+                }
+            }
+            return node.isNegative;
+        default:
+            return false;
+        }
+    }
+
+    double MultiConditionMatcher::estimateCost(const Condition& condition, const PropertyType& type)
+    {
+        if (type != PropertyType::TEXT) {
+            return 1.0;
+        }
+        switch (condition.comp) {
+        case Condition::Comparator::IS_NULL:
+        case Condition::Comparator::NOT_NULL:
+            return 1.0;
+        case Condition::Comparator::CONTAIN:
+        case Condition::Comparator::BEGIN_WITH:
+        case Condition::Comparator::END_WITH:
+        case Condition::Comparator::IN:
+            return 4.0;
+        case Condition::Comparator::LIKE:
+        case Condition::Comparator::REGEX:
+            return 16.0;
+        default:
+            return 2.0;
+        }
+    }
+
+    double MultiConditionMatcher::estimateSelectivity(const Condition& condition)
+    {
+        auto selectivity = 0.0;
+        switch (condition.comp) {
+        case Condition::Comparator::IS_NULL:
+            selectivity = 0.1;
+            break;
+        case Condition::Comparator::NOT_NULL:
+            selectivity = 0.9;
+            break;
+        case Condition::Comparator::EQUAL:
+            selectivity = 0.1;
+            break;
+        case Condition::Comparator::IN:
+            selectivity = std::min(0.1 * condition.valueSet.size(), 0.9);
+            break;
+        case Condition::Comparator::GREATER:
+        case Condition::Comparator::GREATER_EQUAL:
+        case Condition::Comparator::LESS:
+        case Condition::Comparator::LESS_EQUAL:
+            selectivity = 1.0 / 3.0;
+            break;
+        case Condition::Comparator::BETWEEN:
+        case Condition::Comparator::BETWEEN_NO_LOWER:
+        case Condition::Comparator::BETWEEN_NO_UPPER:
+        case Condition::Comparator::BETWEEN_NO_BOUND:
+            selectivity = 0.25;
+            break;
+        default:
+            selectivity = 0.2;
+            break;
+        }
+        return condition.isNegative ? 1.0 - selectivity : selectivity;
+    }
+
     bool RecordCompare::compareBytesValue(const Bytes& value, PropertyType type, const Condition& condition)
     {
         if (condition.comp == Condition::Comparator::IN) {
@@ -99,48 +474,69 @@ namespace compare {
         const PropertyNameMapInfo& propertyNameMapInfo,
         const MultiCondition& multiCondition)
     {
-        auto propertyTypes = PropertyMapType {};
-        for (const auto& conditionNode : multiCondition.conditions) {
-            auto conditionNodePtr = conditionNode.lock();
-            require(conditionNodePtr != nullptr);
-            auto& condition = conditionNodePtr->getCondition();
-            auto foundConditionProperty = propertyTypes.find(condition.propName);
-            if (foundConditionProperty == propertyTypes.cend()) {
-                auto foundProperty = propertyNameMapInfo.find(condition.propName);
-                /**
-                 * Do not throw NOGDB_CTX_NOEXST_PROPERTY as it is used in graph filter which has
-                 * multiple edge comparison with a different set of properties
-                 */
-                if (foundProperty != propertyNameMapInfo.cend()) {
-                    propertyTypes.emplace(condition.propName, foundProperty->second.type);
-                }
-            }
-        }
-        return multiCondition.execute(record, propertyTypes);
+        /**
+         * Do not throw NOGDB_CTX_NOEXST_PROPERTY as it is used in graph filter which has
+         * multiple edge comparison with a different set of properties
+         */
+        return MultiConditionMatcher { multiCondition, propertyNameMapInfo }.match(record);
     }
 
     ClassFilter RecordCompare::getFilterClasses(const Transaction& txn, const GraphFilter& filter)
     {
         auto classFilter = ClassFilter {};
-        classFilter.onlyClasses.insert(filter._onlyClasses.cbegin(), filter._onlyClasses.cend());
+        classFilter.isRecordNeeded = filter._mode != GraphFilter::FilterMode::COMPARE_FUNCTION
+            || filter._function != nullptr;
+        for (const auto& onlyClass : filter._onlyClasses) {
+            auto classInfo = txn._adapter->dbClass()->getInfo(onlyClass);
+            if (classInfo.type != ClassType::UNDEFINED) {
+                classFilter.onlyClasses.insert(classInfo.id);
+            }
+        }
         for (const auto& onlySubOfClass : filter._onlySubOfClasses) {
             auto superClassInfo = txn._adapter->dbClass()->getInfo(onlySubOfClass);
             if (superClassInfo.type != ClassType::UNDEFINED) {
-                classFilter.onlyClasses.insert(superClassInfo.name);
+                classFilter.onlyClasses.insert(superClassInfo.id);
                 auto subClassesInfo = txn._adapter->dbClass()->getSubClassInfos(superClassInfo.id);
                 for (const auto& subClassInfo : subClassesInfo) {
-                    classFilter.onlyClasses.insert(subClassInfo.name);
+                    classFilter.onlyClasses.insert(subClassInfo.id);
                 }
             }
         }
-        classFilter.ignoreClasses.insert(filter._ignoreClasses.cbegin(), filter._ignoreClasses.cend());
+        // unknown names in onlySubOf() are ignored as they have always been
+        classFilter.isOnlyClasses = !filter._onlyClasses.empty() || !classFilter.onlyClasses.empty();
+        for (const auto& ignoreClass : filter._ignoreClasses) {
+            auto classInfo = txn._adapter->dbClass()->getInfo(ignoreClass);
+            if (classInfo.type != ClassType::UNDEFINED) {
+                classFilter.ignoreClasses.insert(classInfo.id);
+            }
+        }
         for (const auto& ignoreSubOfClass : filter._ignoreSubOfClasses) {
             auto superClassInfo = txn._adapter->dbClass()->getInfo(ignoreSubOfClass);
             if (superClassInfo.type != ClassType::UNDEFINED) {
-                classFilter.ignoreClasses.insert(superClassInfo.name);
+                classFilter.ignoreClasses.insert(superClassInfo.id);
                 auto subClassesInfo = txn._adapter->dbClass()->getSubClassInfos(superClassInfo.id);
                 for (const auto& subClassInfo : subClassesInfo) {
-                    classFilter.ignoreClasses.insert(subClassInfo.name);
+                    classFilter.ignoreClasses.insert(subClassInfo.id);
+                }
+            }
+        }
+        if (filter._mode == GraphFilter::FilterMode::CONDITION && filter._condition != nullptr) {
+            // the property may have a different type in each class, so the condition is prepared for all of them
+            for (const auto& type : { PropertyType::TINYINT, PropertyType::UNSIGNED_TINYINT, PropertyType::SMALLINT,
+                     PropertyType::UNSIGNED_SMALLINT, PropertyType::INTEGER, PropertyType::UNSIGNED_INTEGER,
+                     PropertyType::BIGINT, PropertyType::UNSIGNED_BIGINT, PropertyType::TEXT, PropertyType::REAL,
+                     PropertyType::BLOB }) {
+                classFilter.compiledConditions.emplace(type, filter._condition->compile(type));
+            }
+        }
+        if (filter._mode == GraphFilter::FilterMode::MULTI_CONDITION && filter._multiCondition != nullptr) {
+            // matchers are built up front, so the filter can be shared by traversals running in parallel
+            for (const auto& classInfo : txn._adapter->dbClass()->getAllInfos()) {
+                if (isClassAccepted(classInfo.id, classFilter)) {
+                    auto propertyNameMapInfo =
+                        SchemaUtils::getPropertyNameMapInfo(&txn, classInfo.id, classInfo.superClassId);
+                    classFilter.multiConditionMatchers.emplace(classInfo.id,
+                        std::make_shared<const MultiConditionMatcher>(*filter._multiCondition, propertyNameMapInfo));
                 }
             }
         }
@@ -152,6 +548,10 @@ namespace compare {
         const GraphFilter& filter,
         const ClassFilter& classFilter)
     {
+        if (!classFilter.isRecordNeeded) {
+            // nothing but the class of the record is checked, which is already a part of its record id
+            return isClassAccepted(recordDescriptor.rid.first, classFilter) ? recordDescriptor : RecordDescriptor {};
+        }
         return filterResult(txn, recordDescriptor, filter, classFilter).descriptor;
     }
 
@@ -160,31 +560,31 @@ namespace compare {
         const GraphFilter& filter,
         const ClassFilter& classFilter)
     {
-        auto classInfo = txn._adapter->dbClass()->getInfo(recordDescriptor.rid.first);
-        // filter classes
-        if (!classFilter.onlyClasses.empty()) {
-            if (classFilter.onlyClasses.find(classInfo.name) == classFilter.onlyClasses.cend()) {
-                return Result {};
-            }
-        }
-        // filter excluded classes
-        if (!classFilter.ignoreClasses.empty()) {
-            if (classFilter.ignoreClasses.find(classInfo.name) != classFilter.ignoreClasses.cend()) {
-                return Result {};
-            }
+        if (!isClassAccepted(recordDescriptor.rid.first, classFilter)) {
+            return Result {};
         }
 
+        auto classInfo = txn._adapter->dbClass()->getInfo(recordDescriptor.rid.first);
         auto record = DataRecordUtils::getRecordWithBasicInfo(&txn, classInfo, recordDescriptor);
         if (filter._mode == GraphFilter::FilterMode::CONDITION) {
             auto condition = filter._condition.get();
             auto propertyNameMapInfo = SchemaUtils::getPropertyNameMapInfo(&txn, classInfo.id, classInfo.superClassId);
-            auto cmpResult = RecordCompare::compareRecordByCondition(record, propertyNameMapInfo, *condition);
+            auto foundProperty = propertyNameMapInfo.find(condition->propName);
+            if (foundProperty == propertyNameMapInfo.cend()) {
+                return Result {};
+            }
+            auto compiledCondition = classFilter.compiledConditions.find(foundProperty->second.type);
+            auto cmpResult = (compiledCondition != classFilter.compiledConditions.cend())
+                ? compiledCondition->second(record)
+                : RecordCompare::compareRecordByCondition(record, foundProperty->second.type, *condition);
             return cmpResult ? Result { recordDescriptor, record } : Result {};
         } else if (filter._mode == GraphFilter::FilterMode::MULTI_CONDITION) {
-            auto multiCondition = filter._multiCondition.get();
-            auto propertyNameMapInfo = SchemaUtils::getPropertyNameMapInfo(&txn, classInfo.id, classInfo.superClassId);
-            auto cmpResult = RecordCompare::compareRecordByMultiCondition(
-                record, propertyNameMapInfo, *multiCondition);
+            auto foundMatcher = classFilter.multiConditionMatchers.find(classInfo.id);
+            auto cmpResult = (foundMatcher != classFilter.multiConditionMatchers.cend())
+                ? foundMatcher->second->match(record)
+                : RecordCompare::compareRecordByMultiCondition(record,
+                      SchemaUtils::getPropertyNameMapInfo(&txn, classInfo.id, classInfo.superClassId),
+                      *filter._multiCondition);
             return cmpResult ? Result { recordDescriptor, record } : Result {};
         } else {
             if (filter._function != nullptr) {
@@ -203,18 +603,22 @@ namespace compare {
     {
         auto edgeRecordDescriptors = std::vector<std::pair<RecordDescriptor, RecordDescriptor>> {};
         auto edgeNeighbours = std::vector<std::pair<RecordId, RecordId>> {};
-        switch (direction) {
-        case Direction::IN:
-            edgeNeighbours = txn._graph->getInEdgeAndNeighbours(vertex);
-            break;
-        case Direction::OUT:
-            edgeNeighbours = txn._graph->getOutEdgeAndNeighbours(vertex);
-            break;
-        case Direction::ALL:
-            edgeNeighbours = txn._graph->getInEdgeAndNeighbours(vertex);
-            auto moreEdges = txn._graph->getOutEdgeAndNeighbours(vertex);
-            edgeNeighbours.insert(edgeNeighbours.cend(), moreEdges.cbegin(), moreEdges.cend());
-            break;
+        auto adjacencySnapshot = txn.findAdjacencySnapshot();
+        if (adjacencySnapshot == nullptr
+            || !adjacencySnapshot->getEdgeAndNeighbours(vertex, direction, edgeNeighbours)) {
+            switch (direction) {
+            case Direction::IN:
+                edgeNeighbours = txn._graph->getInEdgeAndNeighbours(vertex);
+                break;
+            case Direction::OUT:
+                edgeNeighbours = txn._graph->getOutEdgeAndNeighbours(vertex);
+                break;
+            case Direction::ALL:
+                edgeNeighbours = txn._graph->getInEdgeAndNeighbours(vertex);
+                auto moreEdges = txn._graph->getOutEdgeAndNeighbours(vertex);
+                edgeNeighbours.insert(edgeNeighbours.cend(), moreEdges.cbegin(), moreEdges.cend());
+                break;
+            }
         }
 
         for (const auto& edgeNeighbour : edgeNeighbours) {
@@ -260,13 +664,13 @@ namespace compare {
             return ResultSet {};
         }
         auto propertyInfo = foundProperty->second;
-        auto foundIndex = IndexUtils::hasIndex(&txn, classInfo, propertyInfo, condition);
-        if (foundIndex.first) {
-            auto indexedRecords = IndexUtils::getRecord(&txn, propertyInfo, foundIndex.second, condition);
+        auto indexPlan = IndexUtils::planCondition(&txn, classInfo, propertyInfo, condition, searchIndexOnly);
+        if (indexPlan.plan.strategy == QueryPlan::Strategy::INDEX_SCAN) {
+            auto indexedRecords = IndexUtils::getRecord(&txn, propertyInfo, indexPlan.leadingIndexInfo, condition);
             return DataRecordUtils::getResultSet(&txn, classInfo, indexedRecords);
         } else {
             if (!searchIndexOnly) {
-                return DataRecordUtils::getResultSetByCondition(&txn, classInfo, propertyInfo.type, condition);
+                return DataRecordUtils::getResultSetByCondition(&txn, classInfo, propertyInfo, condition);
             }
         }
         return ResultSet {};
@@ -278,25 +682,22 @@ namespace compare {
         const MultiCondition& multiCondition,
         bool searchIndexOnly)
     {
-        auto conditionProperties = PropertyNameMapInfo {};
-        for (const auto& conditionNode : multiCondition.conditions) {
-            auto conditionNodePtr = conditionNode.lock();
-            require(conditionNodePtr != nullptr);
-            auto& condition = conditionNodePtr->getCondition();
-            auto foundConditionProperty = conditionProperties.find(condition.propName);
-            if (foundConditionProperty == conditionProperties.cend()) {
-                auto foundProperty = propertyNameMapInfo.find(condition.propName);
-                if (foundProperty != propertyNameMapInfo.cend()) {
-                    conditionProperties.emplace(condition.propName, foundProperty->second);
-                }
-            }
-        }
-
-        auto foundIndex = IndexUtils::hasIndex(&txn, classInfo, conditionProperties, multiCondition);
-        if (foundIndex.first) {
-            auto indexedRecords = IndexUtils::getRecord(&txn, conditionProperties, foundIndex.second, multiCondition);
+        auto conditionProperties = getConditionProperties(propertyNameMapInfo, multiCondition);
+        auto indexPlan = IndexUtils::planMultiCondition(
+            &txn, classInfo, conditionProperties, multiCondition, searchIndexOnly);
+        switch (indexPlan.plan.strategy) {
+        case QueryPlan::Strategy::INDEX_INTERSECTION: {
+            auto indexedRecords = IndexUtils::getRecord(
+                &txn, conditionProperties, indexPlan.propertyIndexInfo, multiCondition);
             return DataRecordUtils::getResultSet(&txn, classInfo, indexedRecords);
-        } else {
+        }
+        case QueryPlan::Strategy::INDEX_WITH_FILTER: {
+            auto indexedRecords = IndexUtils::getRecord(
+                &txn, indexPlan.leadingPropertyInfo, indexPlan.leadingIndexInfo, *indexPlan.leadingCondition);
+            return DataRecordUtils::getResultSetByMultiCondition(
+                &txn, classInfo, conditionProperties, multiCondition, indexedRecords);
+        }
+        default:
             if (!searchIndexOnly) {
                 return DataRecordUtils::getResultSetByMultiCondition(
                     &txn, classInfo, conditionProperties, multiCondition);
@@ -316,12 +717,12 @@ namespace compare {
             return std::vector<RecordDescriptor> {};
         }
         auto propertyInfo = foundProperty->second;
-        auto foundIndex = IndexUtils::hasIndex(&txn, classInfo, propertyInfo, condition);
-        if (foundIndex.first) {
-            return IndexUtils::getRecord(&txn, propertyInfo, foundIndex.second, condition);
+        auto indexPlan = IndexUtils::planCondition(&txn, classInfo, propertyInfo, condition, searchIndexOnly);
+        if (indexPlan.plan.strategy == QueryPlan::Strategy::INDEX_SCAN) {
+            return IndexUtils::getRecord(&txn, propertyInfo, indexPlan.leadingIndexInfo, condition);
         } else {
             if (!searchIndexOnly) {
-                return DataRecordUtils::getRecordDescriptorByCondition(&txn, classInfo, propertyInfo.type, condition);
+                return DataRecordUtils::getRecordDescriptorByCondition(&txn, classInfo, propertyInfo, condition);
             }
         }
         return std::vector<RecordDescriptor> {};
@@ -333,24 +734,19 @@ namespace compare {
         const MultiCondition& conditions,
         bool searchIndexOnly)
     {
-        auto conditionProperties = PropertyNameMapInfo {};
-        for (const auto& conditionNode : conditions.conditions) {
-            auto conditionNodePtr = conditionNode.lock();
-            require(conditionNodePtr != nullptr);
-            auto& condition = conditionNodePtr->getCondition();
-            auto foundConditionProperty = conditionProperties.find(condition.propName);
-            if (foundConditionProperty == conditionProperties.cend()) {
-                auto foundProperty = propertyNameMapInfo.find(condition.propName);
-                if (foundProperty != propertyNameMapInfo.cend()) {
-                    conditionProperties.emplace(condition.propName, foundProperty->second);
-                }
-            }
+        auto conditionProperties = getConditionProperties(propertyNameMapInfo, conditions);
+        auto indexPlan = IndexUtils::planMultiCondition(
+            &txn, classInfo, conditionProperties, conditions, searchIndexOnly);
+        switch (indexPlan.plan.strategy) {
+        case QueryPlan::Strategy::INDEX_INTERSECTION:
+            return IndexUtils::getRecord(&txn, conditionProperties, indexPlan.propertyIndexInfo, conditions);
+        case QueryPlan::Strategy::INDEX_WITH_FILTER: {
+            auto indexedRecords = IndexUtils::getRecord(
+                &txn, indexPlan.leadingPropertyInfo, indexPlan.leadingIndexInfo, *indexPlan.leadingCondition);
+            return DataRecordUtils::getRecordDescriptorByMultiCondition(
+                &txn, classInfo, conditionProperties, conditions, indexedRecords);
         }
-
-        auto foundIndex = IndexUtils::hasIndex(&txn, classInfo, conditionProperties, conditions);
-        if (foundIndex.first) {
-            return IndexUtils::getRecord(&txn, conditionProperties, foundIndex.second, conditions);
-        } else {
+        default:
             if (!searchIndexOnly) {
                 return DataRecordUtils::getRecordDescriptorByMultiCondition(
                     &txn, classInfo, conditionProperties, conditions);
@@ -370,12 +766,12 @@ namespace compare {
             return 0;
         }
         auto propertyInfo = foundProperty->second;
-        auto foundIndex = IndexUtils::hasIndex(&txn, classInfo, propertyInfo, condition);
-        if (foundIndex.first) {
-            return IndexUtils::getCountRecord(&txn, propertyInfo, foundIndex.second, condition);
+        auto indexPlan = IndexUtils::planCondition(&txn, classInfo, propertyInfo, condition, searchIndexOnly);
+        if (indexPlan.plan.strategy == QueryPlan::Strategy::INDEX_SCAN) {
+            return IndexUtils::getCountRecord(&txn, propertyInfo, indexPlan.leadingIndexInfo, condition);
         } else {
             if (!searchIndexOnly) {
-                return DataRecordUtils::getCountRecordByCondition(&txn, classInfo, propertyInfo.type, condition);
+                return DataRecordUtils::getCountRecordByCondition(&txn, classInfo, propertyInfo, condition);
             }
         }
         return 0;
@@ -386,6 +782,58 @@ namespace compare {
         const PropertyNameMapInfo& propertyNameMapInfo,
         const MultiCondition& conditions,
         bool searchIndexOnly)
+    {
+        auto conditionProperties = getConditionProperties(propertyNameMapInfo, conditions);
+        auto indexPlan = IndexUtils::planMultiCondition(
+            &txn, classInfo, conditionProperties, conditions, searchIndexOnly);
+        switch (indexPlan.plan.strategy) {
+        case QueryPlan::Strategy::INDEX_INTERSECTION:
+            return IndexUtils::getCountRecord(&txn, conditionProperties, indexPlan.propertyIndexInfo, conditions);
+        case QueryPlan::Strategy::INDEX_WITH_FILTER: {
+            auto indexedRecords = IndexUtils::getRecord(
+                &txn, indexPlan.leadingPropertyInfo, indexPlan.leadingIndexInfo, *indexPlan.leadingCondition);
+            return DataRecordUtils::getRecordDescriptorByMultiCondition(
+                &txn, classInfo, conditionProperties, conditions, indexedRecords).size();
+        }
+        default:
+            if (!searchIndexOnly) {
+                return DataRecordUtils::getCountRecordByMultiCondition(
+                    &txn, classInfo, conditionProperties, conditions);
+            }
+        }
+        return 0;
+    }
+
+    QueryPlan RecordCompare::explainCondition(const Transaction& txn,
+        const ClassAccessInfo& classInfo,
+        const PropertyNameMapInfo& propertyNameMapInfo,
+        const Condition& condition,
+        bool searchIndexOnly)
+    {
+        auto foundProperty = propertyNameMapInfo.find(condition.propName);
+        if (foundProperty == propertyNameMapInfo.cend()) {
+            // no record can match a condition on a property which does not exist in the class
+            auto queryPlan = QueryPlan {};
+            queryPlan.className = classInfo.name;
+            return queryPlan;
+        }
+        return IndexUtils::planCondition(
+            &txn, classInfo, foundProperty->second, condition, searchIndexOnly, true).plan;
+    }
+
+    QueryPlan RecordCompare::explainMultiCondition(const Transaction& txn,
+        const ClassAccessInfo& classInfo,
+        const PropertyNameMapInfo& propertyNameMapInfo,
+        const MultiCondition& conditions,
+        bool searchIndexOnly)
+    {
+        auto conditionProperties = getConditionProperties(propertyNameMapInfo, conditions);
+        return IndexUtils::planMultiCondition(
+            &txn, classInfo, conditionProperties, conditions, searchIndexOnly, true).plan;
+    }
+
+    PropertyNameMapInfo RecordCompare::getConditionProperties(const PropertyNameMapInfo& propertyNameMapInfo,
+        const MultiCondition& conditions)
     {
         auto conditionProperties = PropertyNameMapInfo {};
         for (const auto& conditionNode : conditions.conditions) {
@@ -400,17 +848,7 @@ namespace compare {
                 }
             }
         }
-
-        auto foundIndex = IndexUtils::hasIndex(&txn, classInfo, conditionProperties, conditions);
-        if (foundIndex.first) {
-            return IndexUtils::getCountRecord(&txn, conditionProperties, foundIndex.second, conditions);
-        } else {
-            if (!searchIndexOnly) {
-                return DataRecordUtils::getCountRecordByMultiCondition(
-                    &txn, classInfo, conditionProperties, conditions);
-            }
-        }
-        return 0;
+        return conditionProperties;
     }
 
     ResultSet RecordCompare::compareEdgeCondition(const Transaction& txn,
@@ -485,28 +923,21 @@ namespace compare {
     {
         auto edgeRecordIds = resolveEdgeRecordIds(txn, recordDescriptor.rid, direction);
         auto resultSet = ResultSet {};
-        auto edgeInfos = std::map<ClassId, std::pair<ClassAccessInfo, PropertyMapType>> {};
+        auto edgeInfos = std::map<ClassId, std::pair<ClassAccessInfo, std::shared_ptr<const MultiConditionMatcher>>> {};
         for (const auto& edgeRecordId : edgeRecordIds) {
-            auto edgeClassInfo = ClassAccessInfo {};
-            auto propertyTypes = PropertyMapType {};
-
             auto foundEdgeInfo = edgeInfos.find(edgeRecordId.first);
             if (foundEdgeInfo == edgeInfos.cend()) {
-                edgeClassInfo = txn._adapter->dbClass()->getInfo(edgeRecordId.first);
+                auto edgeClassInfo = txn._adapter->dbClass()->getInfo(edgeRecordId.first);
                 auto propertyNameMapInfo =
                     SchemaUtils::getPropertyNameMapInfo(&txn, edgeClassInfo.id, edgeClassInfo.superClassId);
-                for (const auto& property : propertyNameMapInfo) {
-                    propertyTypes.emplace(property.first, property.second.type);
-                }
-                edgeInfos.emplace(std::make_pair(edgeRecordId.first, std::make_pair(edgeClassInfo, propertyTypes)));
-            } else {
-                edgeClassInfo = foundEdgeInfo->second.first;
-                propertyTypes = foundEdgeInfo->second.second;
+                auto matcher = std::make_shared<const MultiConditionMatcher>(multiCondition, propertyNameMapInfo);
+                foundEdgeInfo = edgeInfos.emplace(edgeRecordId.first, std::make_pair(edgeClassInfo, matcher)).first;
             }
+            const auto& edgeClassInfo = foundEdgeInfo->second.first;
 
             auto edgeRecord =
                 DataRecordUtils::getRecordWithBasicInfo(&txn, edgeClassInfo, RecordDescriptor { edgeRecordId });
-            if (multiCondition.execute(edgeRecord, propertyTypes)) {
+            if (foundEdgeInfo->second.second->match(edgeRecord)) {
                 resultSet.emplace_back(Result { RecordDescriptor { edgeRecordId }, edgeRecord });
             }
         }
@@ -585,28 +1016,21 @@ namespace compare {
     {
         auto edgeRecordIds = resolveEdgeRecordIds(txn, recordDescriptor.rid, direction);
         auto recordDescriptors = std::vector<RecordDescriptor> {};
-        auto edgeInfos = std::map<ClassId, std::pair<ClassAccessInfo, PropertyMapType>> {};
+        auto edgeInfos = std::map<ClassId, std::pair<ClassAccessInfo, std::shared_ptr<const MultiConditionMatcher>>> {};
         for (const auto& edgeRecordId : edgeRecordIds) {
-            auto edgeClassInfo = ClassAccessInfo {};
-            auto propertyTypes = PropertyMapType {};
-
             auto foundEdgeInfo = edgeInfos.find(edgeRecordId.first);
             if (foundEdgeInfo == edgeInfos.cend()) {
-                edgeClassInfo = txn._adapter->dbClass()->getInfo(edgeRecordId.first);
+                auto edgeClassInfo = txn._adapter->dbClass()->getInfo(edgeRecordId.first);
                 auto propertyNameMapInfo =
                     SchemaUtils::getPropertyNameMapInfo(&txn, edgeClassInfo.id, edgeClassInfo.superClassId);
-                for (const auto& property : propertyNameMapInfo) {
-                    propertyTypes.emplace(property.first, property.second.type);
-                }
-                edgeInfos.emplace(std::make_pair(edgeRecordId.first, std::make_pair(edgeClassInfo, propertyTypes)));
-            } else {
-                edgeClassInfo = foundEdgeInfo->second.first;
-                propertyTypes = foundEdgeInfo->second.second;
+                auto matcher = std::make_shared<const MultiConditionMatcher>(multiCondition, propertyNameMapInfo);
+                foundEdgeInfo = edgeInfos.emplace(edgeRecordId.first, std::make_pair(edgeClassInfo, matcher)).first;
             }
+            const auto& edgeClassInfo = foundEdgeInfo->second.first;
 
             auto edgeRecord =
                 DataRecordUtils::getRecordWithBasicInfo(&txn, edgeClassInfo, RecordDescriptor { edgeRecordId });
-            if (multiCondition.execute(edgeRecord, propertyTypes)) {
+            if (foundEdgeInfo->second.second->match(edgeRecord)) {
                 recordDescriptors.emplace_back(RecordDescriptor { edgeRecordId });
             }
         }
@@ -21,8 +21,13 @@
 
 #pragma once
 
+#include <cstring>
+#include <map>
+#include <memory>
 #include <regex>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "datarecord.hpp"
 #include "index.hpp"
@@ -38,9 +43,253 @@ namespace compare {
     using namespace adapter::schema;
     using namespace adapter::relation;
 
+    class MultiConditionMatcher;
+
     struct ClassFilter {
-        std::set<std::string> onlyClasses;
-        std::set<std::string> ignoreClasses;
+        std::set<ClassId> onlyClasses;
+        std::set<ClassId> ignoreClasses;
+        // only() may name classes which do not exist, in which case no record passes the filter,
+        // whereas onlySubOf() of an unknown class does not filter anything
+        bool isOnlyClasses { false };
+        // records are read only when the filter has a condition or a function to evaluate
+        bool isRecordNeeded { true };
+        // the condition of the filter prepared for every property type it may be tested against
+        std::map<PropertyType, CompiledCondition> compiledConditions {};
+        // the multi-condition of the filter prepared for each class accepted by the filter
+        std::map<ClassId, std::shared_ptr<const MultiConditionMatcher>> multiConditionMatchers {};
+    };
+
+    // a comparison of a numeric property against operands which are decoded once, when the condition is compiled
+    class NumericKernel {
+    public:
+        virtual ~NumericKernel() noexcept = default;
+
+        // raw points to the little-endian bytes of a non-empty value
+        virtual bool match(const unsigned char* raw) const = 0;
+
+        // the size of a value in a column given to matchBatch
+        virtual size_t width() const = 0;
+
+        // compares count values stored back to back in column, setting selection[i] to 1 or 0 for each
+        virtual void matchBatch(const unsigned char* column, size_t count, unsigned char* selection) const = 0;
+
+    protected:
+        template <typename T>
+        inline static T load(const unsigned char* raw)
+        {
+            auto value = T {};
+            memcpy(&value, raw, sizeof(T));
+            return value;
+        }
+    };
+
+    // one comparison per comparator, written with bitwise operators so that a range test does not branch
+    namespace comparison {
+        struct Equal {
+            template <typename T>
+            inline static bool apply(T value, T lower, T) { return value == lower; }
+        };
+
+        struct Greater {
+            template <typename T>
+            inline static bool apply(T value, T lower, T) { return value > lower; }
+        };
+
+        struct GreaterEqual {
+            template <typename T>
+            inline static bool apply(T value, T lower, T) { return value >= lower; }
+        };
+
+        struct Less {
+            template <typename T>
+            inline static bool apply(T value, T lower, T) { return value < lower; }
+        };
+
+        struct LessEqual {
+            template <typename T>
+            inline static bool apply(T value, T lower, T) { return value <= lower; }
+        };
+
+        struct Between {
+            template <typename T>
+            inline static bool apply(T value, T lower, T upper) { return (lower <= value) & (value <= upper); }
+        };
+
+        struct BetweenNoLower {
+            template <typename T>
+            inline static bool apply(T value, T lower, T upper) { return (lower < value) & (value <= upper); }
+        };
+
+        struct BetweenNoUpper {
+            template <typename T>
+            inline static bool apply(T value, T lower, T upper) { return (lower <= value) & (value < upper); }
+        };
+
+        struct BetweenNoBound {
+            template <typename T>
+            inline static bool apply(T value, T lower, T upper) { return (lower < value) & (value < upper); }
+        };
+    }
+
+    template <typename T, typename Cmp>
+    class ComparisonKernel : public NumericKernel {
+    public:
+        ComparisonKernel(T lower, T upper, bool isNegative)
+            : _lower { lower }
+            , _upper { upper }
+            , _isNegative { isNegative }
+        {
+        }
+
+        bool match(const unsigned char* raw) const override
+        {
+            return Cmp::apply(load<T>(raw), _lower, _upper) != _isNegative;
+        }
+
+        size_t width() const override
+        {
+            return sizeof(T);
+        }
+
+        // a loop without branches, which an optimizing compiler may turn into vector instructions
+        void matchBatch(const unsigned char* column, size_t count, unsigned char* selection) const override
+        {
+            const auto lower = _lower;
+            const auto upper = _upper;
+            const auto isNegative = static_cast<unsigned char>(_isNegative);
+            for (size_t i = 0; i < count; ++i) {
+                selection[i] = static_cast<unsigned char>(Cmp::apply(load<T>(column + i * sizeof(T)), lower, upper))
+                    ^ isNegative;
+            }
+        }
+
+    private:
+        const T _lower;
+        const T _upper;
+        const bool _isNegative;
+    };
+
+    template <typename T>
+    class InKernel : public NumericKernel {
+    public:
+        InKernel(std::vector<T> values, bool isNegative)
+            : _values { std::move(values) }
+            , _isNegative { isNegative }
+        {
+        }
+
+        // a negative IN passes a value which differs from any of the operands, as the generic comparison does
+        bool match(const unsigned char* raw) const override
+        {
+            const auto value = load<T>(raw);
+            for (const auto& cmpValue : _values) {
+                if ((value == cmpValue) != _isNegative) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        size_t width() const override
+        {
+            return sizeof(T);
+        }
+
+        void matchBatch(const unsigned char* column, size_t count, unsigned char* selection) const override
+        {
+            for (size_t i = 0; i < count; ++i) {
+                selection[i] = static_cast<unsigned char>(InKernel::match(column + i * sizeof(T)));
+            }
+        }
+
+    private:
+        const std::vector<T> _values;
+        const bool _isNegative;
+    };
+
+    // a condition prepared for one property type, with its operands decoded and folded and its pattern compiled
+    class ConditionMatcher {
+    public:
+        ConditionMatcher(const Condition& condition, const PropertyType& type);
+
+        // an empty value stands for a record without the property
+        bool match(const Bytes& value) const;
+
+        // nullptr unless the condition compares a numeric property
+        const NumericKernel* getKernel() const
+        {
+            return _kernel.get();
+        }
+
+    private:
+        bool compareText(const std::string& text) const;
+
+        // returns nullptr when the type or the comparator has no kernel
+        std::unique_ptr<const NumericKernel> createKernel() const;
+
+        template <typename T>
+        std::unique_ptr<const NumericKernel> createKernel() const;
+
+        template <typename T, typename Cmp>
+        std::unique_ptr<const NumericKernel> createComparisonKernel() const;
+
+        PropertyType _type;
+        Condition::Comparator _comp;
+        bool _isIgnoreCase;
+        bool _isNegative;
+        Bytes _valueBytes;
+        std::vector<Bytes> _valueSet;
+        // text operands already in lower case when the case is ignored
+        std::vector<std::string> _texts {};
+        std::regex _pattern {};
+        // numeric comparisons run on the raw bytes of the value
+        std::unique_ptr<const NumericKernel> _kernel {};
+    };
+
+    // a multi-condition prepared for the properties of one class, with nested AND/OR nodes of the same operator
+    // merged and their children ordered so that cheap checks which decide the result run first
+    class MultiConditionMatcher {
+    public:
+        MultiConditionMatcher(const MultiCondition& multiCondition, const PropertyNameMapInfo& propertyNameMapInfo);
+
+        bool match(const Record& record) const;
+
+    private:
+        enum class NodeType {
+            AND,
+            OR,
+            CONDITION,
+            CMP_FUNCTION,
+            // a condition on a property which the class does not have
+            NEVER
+        };
+
+        struct Node {
+            NodeType type { NodeType::NEVER };
+            bool isNegative { false };
+            std::vector<size_t> children {};
+            std::string propName {};
+            std::shared_ptr<const ConditionMatcher> matcher {};
+            std::shared_ptr<MultiCondition::ExprNode> cmpFunction {};
+            double cost { 0.0 };
+            // the estimated fraction of records for which the node is true
+            double selectivity { 0.0 };
+        };
+
+        size_t build(const std::shared_ptr<MultiCondition::ExprNode>& exprNode,
+            const PropertyNameMapInfo& propertyNameMapInfo);
+
+        void addChildren(Node& node, const std::shared_ptr<MultiCondition::ExprNode>& exprNode,
+            const PropertyNameMapInfo& propertyNameMapInfo);
+
+        bool match(size_t nodeIndex, const Record& record) const;
+
+        static double estimateCost(const Condition& condition, const PropertyType& type);
+
+        static double estimateSelectivity(const Condition& condition);
+
+        // children are stored before their parent, so the root is the last node
+        std::vector<Node> _nodes {};
     };
 
     class RecordCompare {
@@ -65,6 +314,21 @@ namespace compare {
 
         static ClassFilter getFilterClasses(const Transaction& txn, const GraphFilter& filter);
 
+        // true when the filter neither reads records nor rejects any class, so every record passes it
+        inline static bool isEveryRecordAccepted(const ClassFilter& classFilter)
+        {
+            return !classFilter.isRecordNeeded && !classFilter.isOnlyClasses && classFilter.ignoreClasses.empty();
+        }
+
+        // reads nothing but the filter, so it may be called from any thread
+        inline static bool isClassAccepted(const ClassId& classId, const ClassFilter& classFilter)
+        {
+            if (classFilter.isOnlyClasses && classFilter.onlyClasses.find(classId) == classFilter.onlyClasses.cend()) {
+                return false;
+            }
+            return classFilter.ignoreClasses.find(classId) == classFilter.ignoreClasses.cend();
+        }
+
         static RecordDescriptor filterRecord(const Transaction& txn,
             const RecordDescriptor& recordDescriptor,
             const GraphFilter& filter,
@@ -121,6 +385,18 @@ namespace compare {
             const MultiCondition& conditions,
             bool searchIndexOnly = false);
 
+        static QueryPlan explainCondition(const Transaction& txn,
+            const ClassAccessInfo& classInfo,
+            const PropertyNameMapInfo& propertyNameMapInfo,
+            const Condition& condition,
+            bool searchIndexOnly = false);
+
+        static QueryPlan explainMultiCondition(const Transaction& txn,
+            const ClassAccessInfo& classInfo,
+            const PropertyNameMapInfo& propertyNameMapInfo,
+            const MultiCondition& conditions,
+            bool searchIndexOnly = false);
+
         static ResultSet compareEdgeCondition(const Transaction& txn,
             const RecordDescriptor& recordDescriptor,
             const Direction& direction,
@@ -152,6 +428,11 @@ namespace compare {
             const MultiCondition& multiCondition);
 
     private:
+        friend class ConditionMatcher;
+
+        static PropertyNameMapInfo getConditionProperties(const PropertyNameMapInfo& propertyNameMapInfo,
+            const MultiCondition& conditions);
+
         inline static std::string toLower(const std::string& text)
         {
             auto tmp = std::string {};
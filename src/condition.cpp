@@ -19,6 +19,8 @@
  *
  */
 
+#include "compare.hpp"
+
 #include "nogdb/nogdb_types.h"
 
 namespace nogdb {
@@ -44,6 +46,24 @@ Condition Condition::operator!() const
     return tmp;
 }
 
+CompiledCondition Condition::compile(const PropertyType& type) const
+{
+    auto compiledCondition = CompiledCondition {};
+    compiledCondition._propName = propName;
+    compiledCondition._matcher = std::make_shared<const compare::ConditionMatcher>(*this, type);
+    return compiledCondition;
+}
+
+bool CompiledCondition::operator()(const Bytes& value) const
+{
+    return _matcher->match(value);
+}
+
+bool CompiledCondition::operator()(const Record& record) const
+{
+    return _matcher->match(record.get(_propName));
+}
+
 MultiCondition Condition::operator&&(const Condition& c) const
 {
     return MultiCondition { *this, c, MultiCondition::Operator::AND };
@@ -34,6 +34,7 @@ const std::string TB_PROPERTIES = ".properties";
 const std::string TB_RELATIONS_IN = ".relations#in";
 const std::string TB_RELATIONS_OUT = ".relations#out";
 const std::string TB_INDEXES = ".indexes";
+const std::string TB_INDEX_STATISTICS = ".index_stats";
 
 const std::string TB_INDEXING_PREFIX = ".index_";
 
@@ -49,6 +50,16 @@ const std::string VERSION_PROPERTY = "@version";
 
 constexpr uint32_t MAX_RECORD_NUM_EM = 0;
 
+// number of records whose property values are compared together in a full class scan
+constexpr size_t SCAN_BATCH_SIZE = 256;
+
+// number of records of a batch insert or removal whose index keys are sorted together, so that the keys
+// being sorted take bounded memory however large the batch is
+constexpr size_t INDEX_SORT_RUN_SIZE = 65536;
+
+// number of lexed sql statements kept by the token cache, the least recently used one is evicted first
+constexpr size_t SQL_TOKEN_CACHE_SIZE = 128;
+
 constexpr size_t MAX_CLASS_NAME_LEN = 128;
 constexpr size_t MAX_PROPERTY_NAME_LEN = 128;
 const std::string MAX_CLASS_ID_KEY = "?max_class_id";
@@ -22,6 +22,7 @@
 #include <memory>
 #include <string>
 
+#include "algorithm.hpp"
 #include "constant.hpp"
 #include "schema.hpp"
 #include "storage_engine.hpp"
@@ -158,6 +159,8 @@ Context::Context(const Context& ctx)
     , _maxDBSize { ctx._maxDBSize }
     , _versionEnabled { ctx._versionEnabled }
     , _envHandler { ctx._envHandler }
+    , _adjacencyCache { ctx._adjacencyCache }
+    , _traversalThreads { ctx._traversalThreads }
 {
     ++_underlying.find(_dbPath)->second._refCount;
 }
@@ -170,6 +173,8 @@ Context& Context::operator=(const Context& ctx)
         _maxDBSize = ctx._maxDBSize;
         _versionEnabled = ctx._versionEnabled;
         _envHandler = ctx._envHandler;
+        _adjacencyCache = ctx._adjacencyCache;
+        _traversalThreads = ctx._traversalThreads;
         ++_underlying.find(_dbPath)->second._refCount;
     }
     return *this;
@@ -181,6 +186,8 @@ Context::Context(Context&& ctx) noexcept
     , _maxDBSize { ctx._maxDBSize }
     , _versionEnabled { ctx._versionEnabled }
     , _envHandler { ctx._envHandler }
+    , _adjacencyCache { std::move(ctx._adjacencyCache) }
+    , _traversalThreads { ctx._traversalThreads }
 {
 }
 
@@ -197,6 +204,8 @@ Context& Context::operator=(Context&& ctx) noexcept
         ctx._maxDBSize = 0;
         ctx._versionEnabled = false;
         ctx._envHandler = nullptr;
+        _adjacencyCache = std::move(ctx._adjacencyCache);
+        _traversalThreads = ctx._traversalThreads;
     }
     return *this;
 }
@@ -206,4 +215,23 @@ Transaction Context::beginTxn(const TxnMode& txnMode)
     return Transaction(*this, txnMode);
 }
 
+Context& Context::enableAdjacencyCache()
+{
+    if (_adjacencyCache == nullptr) {
+        _adjacencyCache = std::make_shared<algorithm::AdjacencyCache>();
+    }
+    return *this;
+}
+
+void Context::disableAdjacencyCache()
+{
+    _adjacencyCache = nullptr;
+}
+
+Context& Context::setTraversalThreads(unsigned int numThreads) noexcept
+{
+    _traversalThreads = numThreads;
+    return *this;
+}
+
 }
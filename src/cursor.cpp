@@ -21,6 +21,7 @@
 
 #include <iterator>
 
+#include "algorithm.hpp"
 #include "datarecord.hpp"
 #include "schema.hpp"
 
@@ -187,4 +188,58 @@ const Result* ResultSetCursor::operator->() const
     return &(operator*());
 }
 
+TraverseCursor::TraverseCursor(const Transaction& txn_, std::unique_ptr<algorithm::TraversalState> state_)
+    : txn { &txn_ }
+    , state { std::move(state_) }
+{
+}
+
+TraverseCursor::~TraverseCursor() noexcept {}
+
+TraverseCursor::TraverseCursor(TraverseCursor&& tc) noexcept
+    : txn { tc.txn }
+    , state { std::move(tc.state) }
+    , result { std::move(tc.result) }
+{
+}
+
+TraverseCursor& TraverseCursor::operator=(TraverseCursor&& tc) noexcept
+{
+    if (this != &tc) {
+        txn = tc.txn;
+        state = std::move(tc.state);
+        result = std::move(tc.result);
+    }
+    return *this;
+}
+
+bool TraverseCursor::next()
+{
+    BEGIN_VALIDATION(txn)
+        .isTxnCompleted();
+
+    auto recordDescriptor = (state != nullptr) ? state->next() : RecordDescriptor {};
+    if (recordDescriptor == RecordDescriptor {}) {
+        // the traversal is over, so its state is released at once
+        state.reset();
+        result = Result {};
+        return false;
+    }
+    auto classInfo = SchemaUtils::getExistingClass(txn, recordDescriptor.rid.first);
+    auto record = DataRecordUtils::getRecordWithBasicInfo(txn, classInfo, recordDescriptor);
+    record.setBasicInfo(DEPTH_PROPERTY, recordDescriptor._depth);
+    result = Result { recordDescriptor, record };
+    return true;
+}
+
+const Result& TraverseCursor::operator*() const
+{
+    return result;
+}
+
+const Result* TraverseCursor::operator->() const
+{
+    return &(operator*());
+}
+
 }
\ No newline at end of file
@@ -19,6 +19,9 @@
  *
  */
 
+#include <algorithm>
+#include <cstring>
+
 #include "datarecord.hpp"
 
 namespace nogdb {
@@ -106,67 +109,107 @@ namespace datarecord {
 
     ResultSet DataRecordUtils::getResultSetByCondition(const Transaction *txn,
         const ClassAccessInfo& classInfo,
-        const PropertyType& propertyType,
+        const PropertyAccessInfo& propertyInfo,
         const Condition& condition)
     {
-        auto dataRecord = DataRecord(txn->_txnBase, classInfo.id, classInfo.type);
         auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(txn, classInfo.id, classInfo.superClassId);
         auto resultSet = ResultSet {};
-        std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> callback =
+        scanByCondition(txn, classInfo, propertyInfo, condition,
             [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
                 auto rid = RecordId { classInfo.id, positionId };
                 auto record = RecordParser::parseRawDataWithBasicInfo(
                     classInfo.name, rid, result, propertyIdMapInfo, classInfo.type, txn->_txnCtx->isVersionEnabled());
-                if (RecordCompare::compareRecordByCondition(record, propertyType, condition)) {
-                    resultSet.emplace_back(Result { RecordDescriptor { rid }, record });
-                }
-            };
-        dataRecord.resultSetIter(callback);
+                resultSet.emplace_back(Result { RecordDescriptor { rid }, record });
+            });
         return resultSet;
     }
 
     std::vector<RecordDescriptor> DataRecordUtils::getRecordDescriptorByCondition(const Transaction *txn,
         const ClassAccessInfo& classInfo,
-        const PropertyType& propertyType,
+        const PropertyAccessInfo& propertyInfo,
         const Condition& condition)
     {
-        auto dataRecord = DataRecord(txn->_txnBase, classInfo.id, classInfo.type);
-        auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(txn, classInfo.id, classInfo.superClassId);
         auto recordDescriptors = std::vector<RecordDescriptor> {};
-        std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> callback =
-            [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
-                auto rid = RecordId { classInfo.id, positionId };
-                auto record = RecordParser::parseRawDataWithBasicInfo(
-                    classInfo.name, rid, result, propertyIdMapInfo, classInfo.type, txn->_txnCtx->isVersionEnabled());
-                if (RecordCompare::compareRecordByCondition(record, propertyType, condition)) {
-                    recordDescriptors.emplace_back(RecordDescriptor { rid });
-                }
-            };
-        dataRecord.resultSetIter(callback);
+        scanByCondition(txn, classInfo, propertyInfo, condition,
+            [&](const PositionId& positionId, const storage_engine::lmdb::Result&) {
+                recordDescriptors.emplace_back(RecordDescriptor { classInfo.id, positionId });
+            });
         return recordDescriptors;
     }
 
     size_t DataRecordUtils::getCountRecordByCondition(const Transaction *txn,
         const ClassAccessInfo& classInfo,
-        const PropertyType& propertyType,
+        const PropertyAccessInfo& propertyInfo,
         const Condition& condition)
     {
-        auto dataRecord = DataRecord(txn->_txnBase, classInfo.id, classInfo.type);
-        auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(txn, classInfo.id, classInfo.superClassId);
         auto count = size_t {0};
-        std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> callback =
-            [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
-                auto rid = RecordId { classInfo.id, positionId };
-                auto record = RecordParser::parseRawDataWithBasicInfo(
-                    classInfo.name, rid, result, propertyIdMapInfo, classInfo.type, txn->_txnCtx->isVersionEnabled());
-                if (RecordCompare::compareRecordByCondition(record, propertyType, condition)) {
-                    ++count;
-                }
-            };
-        dataRecord.resultSetIter(callback);
+        scanByCondition(txn, classInfo, propertyInfo, condition,
+            [&](const PositionId&, const storage_engine::lmdb::Result&) {
+                ++count;
+            });
         return count;
     }
 
+    void DataRecordUtils::scanByCondition(const Transaction *txn,
+        const ClassAccessInfo& classInfo,
+        const PropertyAccessInfo& propertyInfo,
+        const Condition& condition,
+        const std::function<void(const PositionId&, const storage_engine::lmdb::Result&)>& callback)
+    {
+        auto dataRecord = DataRecord(txn->_txnBase, classInfo.id, classInfo.type);
+        auto matcher = compare::ConditionMatcher { condition, propertyInfo.type };
+        auto isEdge = classInfo.type == ClassType::EDGE;
+        auto isVersionEnabled = txn->_txnCtx->isVersionEnabled();
+        if (propertyInfo.id < INIT_NUM_PROPERTIES) {
+            // basic info such as @className is not kept in the raw data, so the whole record has to be parsed
+            auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(txn, classInfo.id, classInfo.superClassId);
+            dataRecord.resultSetIter([&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
+                auto record = RecordParser::parseRawDataWithBasicInfo(classInfo.name, RecordId { classInfo.id, positionId },
+                    result, propertyIdMapInfo, classInfo.type, isVersionEnabled);
+                if (matcher.match(record.get(propertyInfo.name))) {
+                    callback(positionId, result);
+                }
+            });
+            return;
+        }
+        auto kernel = matcher.getKernel();
+        if (kernel == nullptr) {
+            // only the value of the property is read until a record is known to satisfy the condition
+            dataRecord.resultSetIter([&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
+                auto value = RecordParser::parseRawDataProperty(result, propertyInfo.id, isEdge, isVersionEnabled);
+                if (matcher.match(value)) {
+                    callback(positionId, result);
+                }
+            });
+            return;
+        }
+
+        // numeric values of a batch are gathered into a column and compared together into a selection
+        auto width = kernel->width();
+        auto column = std::vector<unsigned char>(SCAN_BATCH_SIZE * width);
+        auto isPresent = std::vector<unsigned char>(SCAN_BATCH_SIZE);
+        auto selection = std::vector<unsigned char>(SCAN_BATCH_SIZE);
+        dataRecord.resultSetBatchIter(SCAN_BATCH_SIZE,
+            [&](const std::vector<PositionId>& positionIds, const std::vector<storage_engine::lmdb::Result>& results) {
+                auto count = positionIds.size();
+                for (size_t i = 0; i < count; ++i) {
+                    auto value = RecordParser::locateRawDataProperty(results[i], propertyInfo.id, isEdge, isVersionEnabled);
+                    auto slot = column.data() + i * width;
+                    memset(slot, 0, width);
+                    if (value.second > 0) {
+                        memcpy(slot, value.first, std::min(value.second, width));
+                    }
+                    isPresent[i] = static_cast<unsigned char>(value.second > 0);
+                }
+                kernel->matchBatch(column.data(), count, selection.data());
+                for (size_t i = 0; i < count; ++i) {
+                    if (selection[i] & isPresent[i]) {
+                        callback(positionIds[i], results[i]);
+                    }
+                }
+            });
+    }
+
     ResultSet DataRecordUtils::getResultSetByMultiCondition(const Transaction *txn,
         const ClassAccessInfo& classInfo,
         const PropertyNameMapInfo& propertyInfos,
@@ -174,17 +217,14 @@ namespace datarecord {
     {
         auto dataRecord = DataRecord(txn->_txnBase, classInfo.id, classInfo.type);
         auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(txn, classInfo.id, classInfo.superClassId);
-        auto propertyTypes = PropertyMapType {};
-        for (const auto& property : propertyInfos) {
-            propertyTypes.emplace(property.first, property.second.type);
-        }
+        auto matcher = compare::MultiConditionMatcher { multiCondition, propertyInfos };
         auto resultSet = ResultSet {};
         std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> callback =
             [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
                 auto rid = RecordId { classInfo.id, positionId };
                 auto record = RecordParser::parseRawDataWithBasicInfo(
                     classInfo.name, rid, result, propertyIdMapInfo, classInfo.type, txn->_txnCtx->isVersionEnabled());
-                if (multiCondition.execute(record, propertyTypes)) {
+                if (matcher.match(record)) {
                     resultSet.emplace_back(Result { RecordDescriptor { rid }, record });
                 }
             };
@@ -199,17 +239,14 @@ namespace datarecord {
     {
         auto dataRecord = DataRecord(txn->_txnBase, classInfo.id, classInfo.type);
         auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(txn, classInfo.id, classInfo.superClassId);
-        auto propertyTypes = PropertyMapType {};
-        for (const auto& property : propertyInfos) {
-            propertyTypes.emplace(property.first, property.second.type);
-        }
+        auto matcher = compare::MultiConditionMatcher { multiCondition, propertyInfos };
         auto recordDescriptors = std::vector<RecordDescriptor> {};
         std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> callback =
             [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
                 auto rid = RecordId { classInfo.id, positionId };
                 auto record = RecordParser::parseRawDataWithBasicInfo(
                     classInfo.name, rid, result, propertyIdMapInfo, classInfo.type, txn->_txnCtx->isVersionEnabled());
-                if (multiCondition.execute(record, propertyTypes)) {
+                if (matcher.match(record)) {
                     recordDescriptors.emplace_back(RecordDescriptor { rid });
                 }
             };
@@ -224,17 +261,14 @@ namespace datarecord {
     {
         auto dataRecord = DataRecord(txn->_txnBase, classInfo.id, classInfo.type);
         auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(txn, classInfo.id, classInfo.superClassId);
-        auto propertyTypes = PropertyMapType {};
-        for (const auto& property : propertyInfos) {
-            propertyTypes.emplace(property.first, property.second.type);
-        }
+        auto matcher = compare::MultiConditionMatcher { multiCondition, propertyInfos };
         auto count = size_t {0};
         std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> callback =
             [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
                 auto rid = RecordId { classInfo.id, positionId };
                 auto record = RecordParser::parseRawDataWithBasicInfo(
                     classInfo.name, rid, result, propertyIdMapInfo, classInfo.type, txn->_txnCtx->isVersionEnabled());
-                if (multiCondition.execute(record, propertyTypes)) {
+                if (matcher.match(record)) {
                     ++count;
                 }
             };
@@ -242,6 +276,42 @@ namespace datarecord {
         return count;
     }
 
+    ResultSet DataRecordUtils::getResultSetByMultiCondition(const Transaction *txn,
+        const ClassAccessInfo& classInfo,
+        const PropertyNameMapInfo& propertyInfos,
+        const MultiCondition& multiCondition,
+        const std::vector<RecordDescriptor>& recordDescriptors)
+    {
+        auto dataRecord = DataRecord(txn->_txnBase, classInfo.id, classInfo.type);
+        auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(txn, classInfo.id, classInfo.superClassId);
+        auto matcher = compare::MultiConditionMatcher { multiCondition, propertyInfos };
+        auto resultSet = ResultSet {};
+        for (const auto& recordDescriptor : recordDescriptors) {
+            auto result = dataRecord.getResult(recordDescriptor.rid.second);
+            auto record = RecordParser::parseRawDataWithBasicInfo(
+                classInfo.name, recordDescriptor.rid, result, propertyIdMapInfo, classInfo.type,
+                txn->_txnCtx->isVersionEnabled());
+            if (matcher.match(record)) {
+                resultSet.emplace_back(Result { recordDescriptor, record });
+            }
+        }
+        return resultSet;
+    }
+
+    std::vector<RecordDescriptor> DataRecordUtils::getRecordDescriptorByMultiCondition(const Transaction *txn,
+        const ClassAccessInfo& classInfo,
+        const PropertyNameMapInfo& propertyInfos,
+        const MultiCondition& multiCondition,
+        const std::vector<RecordDescriptor>& recordDescriptors)
+    {
+        auto result = std::vector<RecordDescriptor> {};
+        for (const auto& filteredResult :
+            getResultSetByMultiCondition(txn, classInfo, propertyInfos, multiCondition, recordDescriptors)) {
+            result.emplace_back(filteredResult.descriptor);
+        }
+        return result;
+    }
+
     ResultSet DataRecordUtils::getResultSetByCmpFunction(const Transaction *txn,
         const ClassAccessInfo& classInfo,
         bool (*condition)(const Record& record))
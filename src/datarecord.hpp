@@ -53,17 +53,17 @@ namespace datarecord {
 
         static ResultSet getResultSetByCondition(const Transaction *txn,
             const ClassAccessInfo& classInfo,
-            const PropertyType& propertyType,
+            const PropertyAccessInfo& propertyInfo,
             const Condition& condition);
 
         static std::vector<RecordDescriptor> getRecordDescriptorByCondition(const Transaction *txn,
             const ClassAccessInfo& classInfo,
-            const PropertyType& propertyType,
+            const PropertyAccessInfo& propertyInfo,
             const Condition& condition);
 
         static size_t getCountRecordByCondition(const Transaction *txn,
             const ClassAccessInfo& classInfo,
-            const PropertyType& propertyType,
+            const PropertyAccessInfo& propertyInfo,
             const Condition& condition);
 
         static ResultSet getResultSetByMultiCondition(const Transaction *txn,
@@ -81,6 +81,18 @@ namespace datarecord {
             const PropertyNameMapInfo& propertyInfos,
             const MultiCondition& multiCondition);
 
+        static ResultSet getResultSetByMultiCondition(const Transaction *txn,
+            const ClassAccessInfo& classInfo,
+            const PropertyNameMapInfo& propertyInfos,
+            const MultiCondition& multiCondition,
+            const std::vector<RecordDescriptor>& recordDescriptors);
+
+        static std::vector<RecordDescriptor> getRecordDescriptorByMultiCondition(const Transaction *txn,
+            const ClassAccessInfo& classInfo,
+            const PropertyNameMapInfo& propertyInfos,
+            const MultiCondition& multiCondition,
+            const std::vector<RecordDescriptor>& recordDescriptors);
+
 
         static ResultSet getResultSetByCmpFunction(const Transaction *txn,
             const ClassAccessInfo& classInfo,
@@ -94,6 +106,13 @@ namespace datarecord {
             const ClassAccessInfo& classInfo,
             bool (*condition)(const Record& record));
 
+    private:
+        // calls the callback with every record of the class whose property value satisfies the condition
+        static void scanByCondition(const Transaction *txn,
+            const ClassAccessInfo& classInfo,
+            const PropertyAccessInfo& propertyInfo,
+            const Condition& condition,
+            const std::function<void(const PositionId&, const storage_engine::lmdb::Result&)>& callback);
     };
 
 }
@@ -121,6 +121,13 @@ namespace datarecord {
             }
         }
 
+        size_t count() const
+        {
+            // the table also keeps the next position id under MAX_RECORD_NUM_EM
+            auto entries = size();
+            return (entries > 0) ? entries - 1 : 0;
+        }
+
         storage_engine::lmdb::Cursor getCursor() const
         {
             return cursor();
@@ -139,6 +146,34 @@ namespace datarecord {
             }
         }
 
+        // hands the records to the callback in batches of at most batchSize, whose values stay valid in the transaction
+        void resultSetBatchIter(size_t batchSize,
+            std::function<void(const std::vector<PositionId>&, const std::vector<storage_engine::lmdb::Result>&)> callback)
+        {
+            auto positionIds = std::vector<PositionId> {};
+            auto results = std::vector<storage_engine::lmdb::Result> {};
+            positionIds.reserve(batchSize);
+            results.reserve(batchSize);
+            auto cursorHandler = getCursor();
+            for (auto keyValue = cursorHandler.getNext();
+                 !keyValue.empty();
+                 keyValue = cursorHandler.getNext()) {
+                auto key = keyValue.key.data.numeric<PositionId>();
+                if (key == MAX_RECORD_NUM_EM)
+                    continue;
+                positionIds.emplace_back(key);
+                results.emplace_back(std::move(keyValue.val));
+                if (positionIds.size() == batchSize) {
+                    callback(positionIds, results);
+                    positionIds.clear();
+                    results.clear();
+                }
+            }
+            if (!positionIds.empty()) {
+                callback(positionIds, results);
+            }
+        }
+
         const ClassId& getClassId() const
         {
             return _classId;
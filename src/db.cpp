@@ -138,7 +138,8 @@ const std::vector<IndexDescriptor> Transaction::getIndexes(const ClassDescriptor
             indexInfo.id,
             indexInfo.classId,
             indexInfo.propertyId,
-            indexInfo.isUnique });
+            indexInfo.isUnique,
+            indexInfo.type });
     }
     return indexDescriptors;
 }
@@ -218,7 +219,8 @@ const IndexDescriptor Transaction::getIndex(const std::string& className, const
         indexInfo.id,
         indexInfo.classId,
         indexInfo.propertyId,
-        indexInfo.isUnique
+        indexInfo.isUnique,
+        indexInfo.type
     };
 }
 
@@ -0,0 +1,210 @@
+/*
+ *  Copyright (C) 2019, NogDB <https://nogdb.org>
+ *  <nogdb at throughwave dot co dot th>
+ *
+ *  This file is part of libnogdb, the NogDB core library in C++.
+ *
+ *  libnogdb is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <numeric>
+
+#include "algorithm.hpp"
+#include "validate.hpp"
+
+#include "nogdb/nogdb.h"
+
+namespace nogdb {
+
+GraphAnalytics Transaction::analytics() const
+{
+    return GraphAnalytics(this);
+}
+
+GraphAnalytics::GraphAnalytics(const Transaction* txn)
+{
+    BEGIN_VALIDATION(txn)
+        .isTxnCompleted();
+
+    // the adjacency cache of the context is reused when it holds the data of the transaction
+    _snapshot = (txn->getAdjacencySnapshot() != nullptr)
+        ? txn->_adjacencySnapshot
+        : std::make_shared<const algorithm::AdjacencySnapshot>(*txn);
+}
+
+size_t GraphAnalytics::getNumVertices() const
+{
+    return _snapshot->vertices.size();
+}
+
+size_t GraphAnalytics::getNumEdges() const
+{
+    return _snapshot->outNeighbours.size();
+}
+
+std::vector<std::pair<RecordDescriptor, double>> GraphAnalytics::pageRank(double dampingFactor,
+    unsigned int maxIterations,
+    double tolerance) const
+{
+    const auto& graph = *_snapshot;
+    auto numVertices = graph.vertices.size();
+    auto result = std::vector<std::pair<RecordDescriptor, double>> {};
+    if (numVertices == 0) {
+        return result;
+    }
+
+    auto numWorkers = graph.getNumWorkers();
+    auto ranks = std::vector<double>(numVertices, 1.0 / numVertices);
+    auto nextRanks = std::vector<double>(numVertices, 0.0);
+    auto contributions = std::vector<double>(numVertices, 0.0);
+    auto workerSums = std::vector<double>(numWorkers, 0.0);
+    for (auto iteration = 0U; iteration < maxIterations; ++iteration) {
+        // vertices without out-edges share their ranks with every vertex
+        auto danglingRank = 0.0;
+        for (auto i = size_t { 0 }; i < numVertices; ++i) {
+            auto outDegree = graph.outOffsets[i + 1] - graph.outOffsets[i];
+            if (outDegree == 0) {
+                danglingRank += ranks[i];
+                contributions[i] = 0.0;
+            } else {
+                contributions[i] = ranks[i] / outDegree;
+            }
+        }
+
+        // every vertex pulls the ranks of its in-neighbours, so that no two workers write to the same vertex
+        auto baseRank = (1.0 - dampingFactor + dampingFactor * danglingRank) / numVertices;
+        graph.runInParallel(numWorkers, [&](size_t worker, size_t begin, size_t end) {
+            auto difference = 0.0;
+            for (auto i = begin; i < end; ++i) {
+                auto rank = 0.0;
+                for (auto j = graph.inOffsets[i]; j < graph.inOffsets[i + 1]; ++j) {
+                    rank += contributions[graph.inNeighbours[j]];
+                }
+                nextRanks[i] = baseRank + dampingFactor * rank;
+                difference += std::fabs(nextRanks[i] - ranks[i]);
+            }
+            workerSums[worker] = difference;
+        });
+        ranks.swap(nextRanks);
+        if (std::accumulate(workerSums.cbegin(), workerSums.cend(), 0.0) < tolerance) {
+            break;
+        }
+    }
+
+    result.reserve(numVertices);
+    for (auto i = size_t { 0 }; i < numVertices; ++i) {
+        result.emplace_back(RecordDescriptor { graph.vertices[i] }, ranks[i]);
+    }
+    return result;
+}
+
+std::vector<std::pair<RecordDescriptor, size_t>> GraphAnalytics::getConnectedComponents() const
+{
+    const auto& graph = *_snapshot;
+    auto numVertices = graph.vertices.size();
+
+    // a union-find over the out-edges, which covers every edge once regardless of its direction
+    auto parents = std::vector<size_t>(numVertices);
+    std::iota(parents.begin(), parents.end(), size_t { 0 });
+    auto findRoot = [&parents](size_t vertex) {
+        while (parents[vertex] != vertex) {
+            parents[vertex] = parents[parents[vertex]];
+            vertex = parents[vertex];
+        }
+        return vertex;
+    };
+    for (auto i = size_t { 0 }; i < numVertices; ++i) {
+        for (auto j = graph.outOffsets[i]; j < graph.outOffsets[i + 1]; ++j) {
+            auto root = findRoot(i);
+            auto neighbourRoot = findRoot(graph.outNeighbours[j]);
+            if (root != neighbourRoot) {
+                parents[std::max(root, neighbourRoot)] = std::min(root, neighbourRoot);
+            }
+        }
+    }
+
+    // components are numbered in the order of their first vertices
+    auto componentIds = std::vector<size_t>(numVertices, numVertices);
+    auto numComponents = size_t { 0 };
+    auto result = std::vector<std::pair<RecordDescriptor, size_t>> {};
+    result.reserve(numVertices);
+    for (auto i = size_t { 0 }; i < numVertices; ++i) {
+        auto root = findRoot(i);
+        if (componentIds[root] == numVertices) {
+            componentIds[root] = numComponents++;
+        }
+        result.emplace_back(RecordDescriptor { graph.vertices[i] }, componentIds[root]);
+    }
+    return result;
+}
+
+unsigned long GraphAnalytics::countTriangles() const
+{
+    const auto& graph = *_snapshot;
+    auto numVertices = graph.vertices.size();
+    auto numWorkers = graph.getNumWorkers();
+
+    // each vertex keeps its distinct neighbours with greater indexes only, so that every triangle is found once
+    auto forwardNeighbours = std::vector<std::vector<size_t>>(numVertices);
+    graph.runInParallel(numWorkers, [&](size_t, size_t begin, size_t end) {
+        for (auto i = begin; i < end; ++i) {
+            auto& neighbours = forwardNeighbours[i];
+            for (auto j = graph.outOffsets[i]; j < graph.outOffsets[i + 1]; ++j) {
+                if (graph.outNeighbours[j] > i) {
+                    neighbours.emplace_back(graph.outNeighbours[j]);
+                }
+            }
+            for (auto j = graph.inOffsets[i]; j < graph.inOffsets[i + 1]; ++j) {
+                if (graph.inNeighbours[j] > i) {
+                    neighbours.emplace_back(graph.inNeighbours[j]);
+                }
+            }
+            std::sort(neighbours.begin(), neighbours.end());
+            neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+        }
+    });
+
+    auto workerCounts = std::vector<unsigned long>(numWorkers, 0UL);
+    graph.runInParallel(numWorkers, [&](size_t worker, size_t begin, size_t end) {
+        auto count = 0UL;
+        for (auto i = begin; i < end; ++i) {
+            const auto& neighbours = forwardNeighbours[i];
+            for (const auto& neighbour : neighbours) {
+                const auto& otherNeighbours = forwardNeighbours[neighbour];
+                auto first = neighbours.cbegin();
+                auto second = otherNeighbours.cbegin();
+                while (first != neighbours.cend() && second != otherNeighbours.cend()) {
+                    if (*first < *second) {
+                        ++first;
+                    } else if (*second < *first) {
+                        ++second;
+                    } else {
+                        ++count;
+                        ++first;
+                        ++second;
+                    }
+                }
+            }
+        }
+        workerCounts[worker] = count;
+    });
+    return std::accumulate(workerCounts.cbegin(), workerCounts.cend(), 0UL);
+}
+
+}
@@ -20,6 +20,7 @@
  */
 
 #include "index.hpp"
+#include "compare.hpp"
 
 namespace nogdb {
 namespace index {
@@ -28,7 +29,8 @@ namespace index {
     using parser::RecordParser;
 
     const std::vector<Condition::Comparator> IndexUtils::validComparators {
-        Condition::Comparator::EQUAL//,
+        Condition::Comparator::EQUAL,
+        Condition::Comparator::IN//,
     //            Condition::Comparator::BETWEEN_NO_BOUND,
     //            Condition::Comparator::BETWEEN,
     //            Condition::Comparator::BETWEEN_NO_UPPER,
@@ -39,60 +41,72 @@ namespace index {
     //            Condition::Comparator::GREATER
     };
 
+    const std::vector<Condition::Comparator> IndexUtils::validFullTextComparators {
+        Condition::Comparator::CONTAIN,
+        Condition::Comparator::BEGIN_WITH,
+        Condition::Comparator::END_WITH,
+        Condition::Comparator::LIKE
+    };
+
     void IndexUtils::initialize(const Transaction *txn,
         const PropertyAccessInfo& propertyInfo,
         const IndexAccessInfo& indexInfo,
-        const ClassId& superClassId,
         const ClassType& classType)
     {
         switch (propertyInfo.type) {
         case PropertyType::UNSIGNED_TINYINT:
-            createNumeric<uint64_t>(txn, propertyInfo, indexInfo, superClassId, classType, [](const Bytes& value) {
+            createNumeric<uint64_t>(txn, propertyInfo, indexInfo, classType, [](const Bytes& value) {
                 return static_cast<uint64_t>(value.toTinyIntU());
             });
             break;
         case PropertyType::UNSIGNED_SMALLINT:
-            createNumeric<uint64_t>(txn, propertyInfo, indexInfo, superClassId, classType, [](const Bytes& value) {
+            createNumeric<uint64_t>(txn, propertyInfo, indexInfo, classType, [](const Bytes& value) {
                 return static_cast<uint64_t>(value.toSmallIntU());
             });
             break;
         case PropertyType::UNSIGNED_INTEGER:
-            createNumeric<uint64_t>(txn, propertyInfo, indexInfo, superClassId, classType, [](const Bytes& value) {
+            createNumeric<uint64_t>(txn, propertyInfo, indexInfo, classType, [](const Bytes& value) {
                 return static_cast<uint64_t>(value.toIntU());
             });
             break;
         case PropertyType::UNSIGNED_BIGINT:
-            createNumeric<uint64_t>(txn, propertyInfo, indexInfo, superClassId, classType, [](const Bytes& value) {
+            createNumeric<uint64_t>(txn, propertyInfo, indexInfo, classType, [](const Bytes& value) {
                 return value.toBigIntU();
             });
             break;
         case PropertyType::TINYINT:
-            createSignedNumeric<int64_t>(txn, propertyInfo, indexInfo, superClassId, classType, [](const Bytes& value) {
+            createSignedNumeric<int64_t>(txn, propertyInfo, indexInfo, classType, [](const Bytes& value) {
                 return static_cast<int64_t>(value.toTinyInt());
             });
             break;
         case PropertyType::SMALLINT:
-            createSignedNumeric<int64_t>(txn, propertyInfo, indexInfo, superClassId, classType, [](const Bytes& value) {
+            createSignedNumeric<int64_t>(txn, propertyInfo, indexInfo, classType, [](const Bytes& value) {
                 return static_cast<int64_t>(value.toSmallInt());
             });
             break;
         case PropertyType::INTEGER:
-            createSignedNumeric<int64_t>(txn, propertyInfo, indexInfo, superClassId, classType, [](const Bytes& value) {
+            createSignedNumeric<int64_t>(txn, propertyInfo, indexInfo, classType, [](const Bytes& value) {
                 return static_cast<int64_t>(value.toInt());
             });
             break;
         case PropertyType::BIGINT:
-            createSignedNumeric<int64_t>(txn, propertyInfo, indexInfo, superClassId, classType, [](const Bytes& value) {
+            createSignedNumeric<int64_t>(txn, propertyInfo, indexInfo, classType, [](const Bytes& value) {
                 return value.toBigInt();
             });
             break;
         case PropertyType::REAL:
-            createSignedNumeric<double>(txn, propertyInfo, indexInfo, superClassId, classType, [](const Bytes& value) {
+            createSignedNumeric<double>(txn, propertyInfo, indexInfo, classType, [](const Bytes& value) {
                 return value.toReal();
             });
             break;
         case PropertyType::TEXT:
-            createString(txn, propertyInfo, indexInfo, superClassId, classType);
+            if (indexInfo.type == IndexType::FULLTEXT) {
+                createFullText(txn, propertyInfo, indexInfo, classType);
+            } else if (indexInfo.type == IndexType::HASH) {
+                createHash(txn, propertyInfo, indexInfo, classType);
+            } else {
+                createString(txn, propertyInfo, indexInfo, classType);
+            }
             break;
         default:
             break;
@@ -121,12 +135,19 @@ namespace index {
             break;
         }
         case PropertyType::TEXT: {
-            openIndexRecordString(txn, indexInfo).destroy();
+            if (indexInfo.type == IndexType::FULLTEXT) {
+                openIndexRecordFullText(txn, indexInfo).destroy();
+            } else if (indexInfo.type == IndexType::HASH) {
+                openIndexRecordHash(txn, indexInfo).destroy();
+            } else {
+                openIndexRecordString(txn, indexInfo).destroy();
+            }
             break;
         }
         default:
             break;
         }
+        IndexStatisticsAccess(txn->_txnBase).remove(indexInfo.id);
     }
 
     void IndexUtils::drop(const Transaction *txn,
@@ -180,7 +201,13 @@ namespace index {
                 case PropertyType::TEXT: {
                     auto valueString = value.toText();
                     if (!valueString.empty()) {
-                        insert(txn, indexInfo, posId, valueString);
+                        if (indexInfo.type == IndexType::FULLTEXT) {
+                            insertFullText(txn, indexInfo, posId, valueString);
+                        } else if (indexInfo.type == IndexType::HASH) {
+                            insertHash(txn, propertyInfo, indexInfo, posId, valueString);
+                        } else {
+                            insert(txn, indexInfo, posId, valueString);
+                        }
                     }
                     break;
                 }
@@ -248,7 +275,13 @@ namespace index {
             case PropertyType::TEXT: {
                 auto valueString = value.toText();
                 if (!valueString.empty()) {
-                    removeByCursor(txn, indexInfo, posId, valueString);
+                    if (indexInfo.type == IndexType::FULLTEXT) {
+                        removeFullText(txn, indexInfo, posId, valueString);
+                    } else if (indexInfo.type == IndexType::HASH) {
+                        removeHash(txn, indexInfo, posId, valueString);
+                    } else {
+                        removeByCursor(txn, indexInfo, posId, valueString);
+                    }
                 }
                 break;
             }
@@ -271,18 +304,112 @@ namespace index {
         }
     }
 
+    void IndexUtils::insert(const Transaction *txn,
+        const std::vector<RecordDescriptor>& recordDescriptors,
+        const std::vector<Record>& records,
+        const PropertyNameMapIndex& propertyNameMapIndex)
+    {
+        for (const auto& info : propertyNameMapIndex) {
+            auto& propertyInfo = info.second.first;
+            auto& indexInfo = info.second.second;
+            for (auto begin = size_t { 0 }; begin < records.size(); begin += INDEX_SORT_RUN_SIZE) {
+                auto end = std::min(begin + INDEX_SORT_RUN_SIZE, records.size());
+                for (const auto& entry :
+                    getSortedIndexEntries(propertyInfo, indexInfo, info.first, recordDescriptors, records, begin, end)) {
+                    insert(txn, propertyInfo, indexInfo, entry.first, entry.second);
+                }
+            }
+        }
+    }
+
+    void IndexUtils::remove(const Transaction *txn,
+        const std::vector<RecordDescriptor>& recordDescriptors,
+        const std::vector<Record>& records,
+        const PropertyNameMapIndex& propertyNameMapIndex)
+    {
+        for (const auto& info : propertyNameMapIndex) {
+            auto& propertyInfo = info.second.first;
+            auto& indexInfo = info.second.second;
+            for (auto begin = size_t { 0 }; begin < records.size(); begin += INDEX_SORT_RUN_SIZE) {
+                auto end = std::min(begin + INDEX_SORT_RUN_SIZE, records.size());
+                for (const auto& entry :
+                    getSortedIndexEntries(propertyInfo, indexInfo, info.first, recordDescriptors, records, begin, end)) {
+                    remove(txn, propertyInfo, indexInfo, entry.first, entry.second);
+                }
+            }
+        }
+    }
+
+    std::vector<std::pair<PositionId, Bytes>> IndexUtils::getSortedIndexEntries(const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        const std::string& propertyName,
+        const std::vector<RecordDescriptor>& recordDescriptors,
+        const std::vector<Record>& records,
+        size_t begin,
+        size_t end)
+    {
+        struct Entry {
+            std::pair<bool, std::string> key;
+            PositionId positionId;
+            Bytes value;
+        };
+        auto entries = std::vector<Entry> {};
+        for (size_t i = begin; i < end; ++i) {
+            auto value = records[i].get(propertyName);
+            if (!value.empty()) {
+                auto key = getIndexKey(propertyInfo, indexInfo, value);
+                entries.emplace_back(Entry { std::move(key), recordDescriptors[i].rid.second, std::move(value) });
+            }
+        }
+        // neighbouring keys of a table share their pages, so the pages are written one after another
+        auto isNumericKey = propertyInfo.type != PropertyType::TEXT || indexInfo.type == IndexType::HASH;
+        std::sort(entries.begin(), entries.end(), [isNumericKey](const Entry& lhs, const Entry& rhs) {
+            if (lhs.key.first != rhs.key.first) {
+                return lhs.key.first;
+            }
+            auto cmp = compareIndexKey(lhs.key.second, rhs.key.second, isNumericKey);
+            return (cmp != 0) ? cmp < 0 : lhs.positionId < rhs.positionId;
+        });
+        auto result = std::vector<std::pair<PositionId, Bytes>> {};
+        result.reserve(entries.size());
+        for (auto& entry : entries) {
+            result.emplace_back(entry.positionId, std::move(entry.value));
+        }
+        return result;
+    }
+
     std::pair<bool, IndexAccessInfo> IndexUtils::hasIndex(const Transaction *txn,
         const ClassAccessInfo& classInfo,
         const PropertyAccessInfo& propertyInfo,
         const Condition& condition)
     {
-        if (isValidComparator(condition)) {
-            // check if NOT is not used for EQUAL
-            if (condition.comp == Condition::Comparator::EQUAL && condition.isNegative) {
+        if (isValidComparator(condition) || isValidFullTextComparator(condition)) {
+            // check if NOT is not used for EQUAL and IN
+            if ((condition.comp == Condition::Comparator::EQUAL || condition.comp == Condition::Comparator::IN)
+                && condition.isNegative) {
                 return std::make_pair(false, IndexAccessInfo {});
             }
             auto indexInfo = txn->_adapter->dbIndex()->getInfo(classInfo.id, propertyInfo.id);
-            return std::make_pair(indexInfo.id != IndexId {}, indexInfo);
+            if (indexInfo.id == IndexId {}) {
+                return std::make_pair(false, IndexAccessInfo {});
+            }
+            if (indexInfo.type == IndexType::FULLTEXT) {
+                // a full-text index can only narrow down records when the search text yields some tokens
+                auto isSearchable = isValidFullTextComparator(condition)
+                    && !condition.isNegative
+                    && !getFullTextSearchTokens(condition).empty();
+                return std::make_pair(isSearchable, indexInfo);
+            }
+            if (indexInfo.type == IndexType::HASH) {
+                // hashes of case-sensitive values cannot answer case-insensitive lookups
+                auto isSearchable = isValidComparator(condition) && !condition.isIgnoreCase;
+                return std::make_pair(isSearchable, indexInfo);
+            }
+            // text keys are looked up as they are, so they cannot match values of other cases
+            if (condition.comp == Condition::Comparator::IN && condition.isIgnoreCase) {
+                return std::make_pair(false, indexInfo);
+            }
+            return std::make_pair(isValidComparator(condition), indexInfo);
         }
         return std::make_pair(false, IndexAccessInfo {});
     }
@@ -310,6 +437,25 @@ namespace index {
         return result;
     }
 
+    PropertyNameMapIndex IndexUtils::getIndexInfos(const Transaction *txn,
+        const ClassId& classId,
+        const PropertyNameMapInfo& propertyNameMapInfo)
+    {
+        auto result = PropertyNameMapIndex {};
+        auto indexInfos = txn->_adapter->dbIndex()->getInfos(classId);
+        if (indexInfos.empty()) {
+            return result;
+        }
+        for (const auto& property : propertyNameMapInfo) {
+            for (const auto& indexInfo : indexInfos) {
+                if (indexInfo.propertyId == property.second.id) {
+                    result.emplace(property.first, std::make_pair(property.second, indexInfo));
+                }
+            }
+        }
+        return result;
+    }
+
     std::pair<bool, PropertyIdMapIndex> IndexUtils::hasIndex(const Transaction *txn,
         const ClassAccessInfo& classInfo,
         const PropertyNameMapInfo& propertyInfos,
@@ -355,7 +501,23 @@ namespace index {
         bool isNegative)
     {
         auto isApplyNegative = condition.isNegative ^ isNegative;
+        if (indexInfo.type == IndexType::FULLTEXT) {
+            return getFullTextRecord(txn, propertyInfo, indexInfo, condition, isApplyNegative);
+        } else if (indexInfo.type == IndexType::HASH) {
+            auto result = getHashRecord(txn, propertyInfo, indexInfo, condition, isApplyNegative);
+            sortByRdesc(result);
+            return result;
+        }
         switch (condition.comp) {
+        case Condition::Comparator::IN: {
+            if (!isApplyNegative) {
+                auto result = getIn(txn, propertyInfo, indexInfo, condition.valueSet);
+                sortByRdesc(result);
+                return result;
+            } else {
+                return getRecordByScan(txn, propertyInfo, indexInfo, condition, isApplyNegative);
+            }
+        }
         case Condition::Comparator::EQUAL: {
             if (!isApplyNegative) {
                 auto result = getEqual(txn, propertyInfo, indexInfo, condition.valueBytes);
@@ -482,7 +644,19 @@ namespace index {
       bool isNegative)
   {
     auto isApplyNegative = condition.isNegative ^ isNegative;
+    if (indexInfo.type == IndexType::FULLTEXT) {
+      return getFullTextRecord(txn, propertyInfo, indexInfo, condition, isApplyNegative).size();
+    } else if (indexInfo.type == IndexType::HASH) {
+      return getHashRecord(txn, propertyInfo, indexInfo, condition, isApplyNegative).size();
+    }
     switch (condition.comp) {
+      case Condition::Comparator::IN: {
+        if (!isApplyNegative) {
+          return getIn(txn, propertyInfo, indexInfo, condition.valueSet).size();
+        } else {
+          return getRecordByScan(txn, propertyInfo, indexInfo, condition, isApplyNegative).size();
+        }
+      }
       case Condition::Comparator::EQUAL: {
         if (!isApplyNegative) {
           return getEqual(txn, propertyInfo, indexInfo, condition.valueBytes).size();
@@ -582,6 +756,376 @@ namespace index {
       return getRecordFromMultiCondition(txn, propertyInfos, propertyIndexInfo, conditions.root.get(), false).size();
     }
 
+    void IndexUtils::analyze(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo)
+    {
+        auto statistics = IndexStatistics {};
+        switch (propertyInfo.type) {
+        case PropertyType::UNSIGNED_TINYINT:
+        case PropertyType::UNSIGNED_SMALLINT:
+        case PropertyType::UNSIGNED_INTEGER:
+        case PropertyType::UNSIGNED_BIGINT: {
+            auto indexAccess = openIndexRecordPositive(txn, indexInfo);
+            analyzeIndexRecord(indexAccess, true, false, getBucketDepth(indexAccess.countEntries()), statistics);
+            break;
+        }
+        case PropertyType::TINYINT:
+        case PropertyType::SMALLINT:
+        case PropertyType::INTEGER:
+        case PropertyType::BIGINT:
+        case PropertyType::REAL: {
+            auto indexPositiveAccess = openIndexRecordPositive(txn, indexInfo);
+            auto indexNegativeAccess = openIndexRecordNegative(txn, indexInfo);
+            auto bucketDepth = getBucketDepth(indexPositiveAccess.countEntries() + indexNegativeAccess.countEntries());
+            analyzeIndexRecord(indexNegativeAccess, true, true, bucketDepth, statistics);
+            analyzeIndexRecord(indexPositiveAccess, true, false, bucketDepth, statistics);
+            break;
+        }
+        case PropertyType::TEXT: {
+            if (indexInfo.type == IndexType::FULLTEXT) {
+                // postings of tokens are counted directly from the index when searching
+                analyzeIndexRecord(openIndexRecordFullText(txn, indexInfo), false, false, 0, statistics);
+            } else if (indexInfo.type == IndexType::HASH) {
+                auto indexAccess = openIndexRecordHash(txn, indexInfo);
+                analyzeIndexRecord(indexAccess, true, false, getBucketDepth(indexAccess.countEntries()), statistics);
+            } else {
+                auto indexAccess = openIndexRecordString(txn, indexInfo);
+                analyzeIndexRecord(indexAccess, false, false, getBucketDepth(indexAccess.countEntries()), statistics);
+            }
+            break;
+        }
+        default:
+            break;
+        }
+        IndexStatisticsAccess(txn->_txnBase).create(indexInfo.id, statistics);
+    }
+
+    IndexStatistics IndexUtils::getStatistics(const Transaction *txn, const IndexAccessInfo& indexInfo)
+    {
+        try {
+            return IndexStatisticsAccess(txn->_txnBase).getStatistics(indexInfo.id);
+        } catch (const Error& err) {
+            // the statistics table cannot be created in a read-only transaction before any index is analyzed
+            if (err.code() == EACCES) {
+                return IndexStatistics {};
+            }
+            throw;
+        }
+    }
+
+    double IndexUtils::estimateRecord(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        const Condition& condition)
+    {
+        auto numOfEntries = static_cast<double>(countIndexEntries(txn, propertyInfo, indexInfo));
+        auto estimatedRecords = numOfEntries;
+        if (indexInfo.type == IndexType::FULLTEXT) {
+            // every record found must contain the rarest token of the search text
+            auto indexAccess = openIndexRecordFullText(txn, indexInfo);
+            for (const auto& token : getFullTextSearchTokens(condition)) {
+                estimatedRecords = std::min(estimatedRecords, static_cast<double>(indexAccess.countPostings(token)));
+            }
+        } else if (condition.comp == Condition::Comparator::EQUAL || condition.comp == Condition::Comparator::IN) {
+            auto statistics = getStatistics(txn, indexInfo);
+            auto isNumericKey = propertyInfo.type != PropertyType::TEXT || indexInfo.type == IndexType::HASH;
+            auto estimateEqual = [&](const Bytes& value) {
+                if (statistics.histogram.empty()) {
+                    return (indexInfo.isUnique)
+                        ? std::min(1.0, numOfEntries)
+                        : numOfEntries * DEFAULT_EQUAL_SELECTIVITY;
+                }
+                auto indexKey = getIndexKey(propertyInfo, indexInfo, value);
+                auto foundBucket = std::find_if(statistics.histogram.cbegin(), statistics.histogram.cend(),
+                    [&](const IndexHistogramBucket& bucket) {
+                        return bucket.isNegative == indexKey.first
+                            && compareIndexKey(indexKey.second, bucket.upperBound, isNumericKey) <= 0;
+                    });
+                if (foundBucket == statistics.histogram.cend()) {
+                    // keys beyond the analyzed range can only come from records added since then
+                    return (numOfEntries == static_cast<double>(statistics.entryCount))
+                        ? 0.0
+                        : std::min(1.0, numOfEntries);
+                }
+                auto entriesPerKey = static_cast<double>(foundBucket->count)
+                    / static_cast<double>(std::max(uint64_t { 1 }, foundBucket->distinctKeys));
+                // scale the statistics to the entries which have been added or removed since the last analysis
+                return entriesPerKey * numOfEntries / static_cast<double>(std::max(uint64_t { 1 }, statistics.entryCount));
+            };
+            if (condition.comp == Condition::Comparator::EQUAL) {
+                estimatedRecords = estimateEqual(condition.valueBytes);
+            } else {
+                auto estimatedInRecords = 0.0;
+                for (const auto& value : condition.valueSet) {
+                    estimatedInRecords += estimateEqual(value);
+                }
+                estimatedRecords = std::min(estimatedRecords, estimatedInRecords);
+            }
+        }
+        return (condition.isNegative) ? std::max(0.0, numOfEntries - estimatedRecords) : estimatedRecords;
+    }
+
+    IndexPlan IndexUtils::planCondition(const Transaction *txn,
+        const ClassAccessInfo& classInfo,
+        const PropertyAccessInfo& propertyInfo,
+        const Condition& condition,
+        bool searchIndexOnly,
+        bool isExplained)
+    {
+        auto indexPlan = IndexPlan {};
+        indexPlan.plan.className = classInfo.name;
+        indexPlan.plan.strategy = QueryPlan::Strategy::FULL_SCAN;
+        auto foundIndex = hasIndex(txn, classInfo, propertyInfo, condition);
+        if (!isExplained && (!foundIndex.first || searchIndexOnly)) {
+            // there is no other plan to compare with, so nothing needs to be estimated
+            if (foundIndex.first) {
+                indexPlan.plan.strategy = QueryPlan::Strategy::INDEX_SCAN;
+                indexPlan.plan.indexedProperties = { propertyInfo.name };
+                indexPlan.leadingPropertyInfo = propertyInfo;
+                indexPlan.leadingIndexInfo = foundIndex.second;
+            }
+            return indexPlan;
+        }
+        auto numOfRecords = static_cast<double>(DataRecord(txn->_txnBase, classInfo.id, classInfo.type).count());
+        indexPlan.plan.estimatedRecords = numOfRecords * getDefaultSelectivity(condition);
+        indexPlan.plan.estimatedCost = numOfRecords * COST_SCAN_RECORD;
+        if (foundIndex.first) {
+            auto estimatedRecords = estimateRecord(txn, propertyInfo, foundIndex.second, condition);
+            auto estimatedCost = estimatedRecords * (COST_INDEX_ENTRY + COST_FETCH_RECORD);
+            if (searchIndexOnly || estimatedCost <= indexPlan.plan.estimatedCost) {
+                indexPlan.plan.strategy = QueryPlan::Strategy::INDEX_SCAN;
+                indexPlan.plan.indexedProperties = { propertyInfo.name };
+                indexPlan.plan.estimatedCost = estimatedCost;
+                indexPlan.leadingPropertyInfo = propertyInfo;
+                indexPlan.leadingIndexInfo = foundIndex.second;
+            }
+            indexPlan.plan.estimatedRecords = estimatedRecords;
+        }
+        return indexPlan;
+    }
+
+    IndexPlan IndexUtils::planMultiCondition(const Transaction *txn,
+        const ClassAccessInfo& classInfo,
+        const PropertyNameMapInfo& propertyInfos,
+        const MultiCondition& conditions,
+        bool searchIndexOnly,
+        bool isExplained)
+    {
+        if (!isExplained && getIndexInfos(txn, classInfo.id, propertyInfos).empty()) {
+            // a class without indexes on the condition properties can only be scanned
+            auto indexPlan = IndexPlan {};
+            indexPlan.plan.className = classInfo.name;
+            indexPlan.plan.strategy = QueryPlan::Strategy::FULL_SCAN;
+            return indexPlan;
+        }
+        auto numOfRecords = static_cast<double>(DataRecord(txn->_txnBase, classInfo.id, classInfo.type).count());
+        auto indexCost = 0.0;
+        auto leadingRecords = 0.0;
+        auto indexPlan = IndexPlan {};
+        auto selectivity = estimateSelectivity(txn, classInfo, propertyInfos, conditions.root,
+            false, true, numOfRecords, indexCost, leadingRecords, indexPlan);
+        auto estimatedRecords = selectivity * numOfRecords;
+
+        indexPlan.plan.className = classInfo.name;
+        indexPlan.plan.strategy = QueryPlan::Strategy::FULL_SCAN;
+        indexPlan.plan.estimatedRecords = estimatedRecords;
+        indexPlan.plan.estimatedCost = numOfRecords * COST_SCAN_RECORD;
+        auto isPlanFound = !searchIndexOnly;
+
+        // reading only the most selective index and filtering its records trades index reads for record fetches
+        if (!searchIndexOnly && indexPlan.leadingCondition != nullptr) {
+            auto filterCost = leadingRecords * (COST_INDEX_ENTRY + COST_FETCH_RECORD);
+            if (filterCost <= indexPlan.plan.estimatedCost) {
+                indexPlan.plan.strategy = QueryPlan::Strategy::INDEX_WITH_FILTER;
+                indexPlan.plan.indexedProperties = { indexPlan.leadingPropertyInfo.name };
+                indexPlan.plan.estimatedCost = filterCost;
+            }
+        }
+
+        auto foundIndex = hasIndex(txn, classInfo, propertyInfos, conditions);
+        if (foundIndex.first) {
+            auto intersectionCost = indexCost + estimatedRecords * COST_FETCH_RECORD;
+            if (!isPlanFound || intersectionCost <= indexPlan.plan.estimatedCost) {
+                indexPlan.plan.strategy = QueryPlan::Strategy::INDEX_INTERSECTION;
+                indexPlan.plan.indexedProperties.clear();
+                for (const auto& propertyInfo : propertyInfos) {
+                    if (foundIndex.second.find(propertyInfo.second.id) != foundIndex.second.cend()) {
+                        indexPlan.plan.indexedProperties.emplace_back(propertyInfo.first);
+                    }
+                }
+                indexPlan.plan.estimatedCost = intersectionCost;
+                indexPlan.propertyIndexInfo = foundIndex.second;
+            }
+        }
+        return indexPlan;
+    }
+
+    void IndexUtils::analyzeIndexRecord(const IndexRecord& indexAccess,
+        bool isNumericKey,
+        bool isNegative,
+        uint64_t bucketDepth,
+        IndexStatistics& statistics)
+    {
+        auto histogram = HistogramBuilder { statistics, isNegative, bucketDepth };
+        auto cursorHandler = indexAccess.getCursor();
+        for (auto keyValue = cursorHandler.getNext();
+             !keyValue.empty();
+             keyValue = cursorHandler.getNext()) {
+            histogram.add((isNumericKey) ? toIndexKey(keyValue.key.data.numeric<uint64_t>()) : keyValue.key.data.string());
+        }
+        histogram.finish();
+    }
+
+    size_t IndexUtils::countIndexEntries(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo)
+    {
+        switch (propertyInfo.type) {
+        case PropertyType::UNSIGNED_TINYINT:
+        case PropertyType::UNSIGNED_SMALLINT:
+        case PropertyType::UNSIGNED_INTEGER:
+        case PropertyType::UNSIGNED_BIGINT:
+            return openIndexRecordPositive(txn, indexInfo).countEntries();
+        case PropertyType::TINYINT:
+        case PropertyType::SMALLINT:
+        case PropertyType::INTEGER:
+        case PropertyType::BIGINT:
+        case PropertyType::REAL:
+            return openIndexRecordPositive(txn, indexInfo).countEntries()
+                + openIndexRecordNegative(txn, indexInfo).countEntries();
+        case PropertyType::TEXT:
+            if (indexInfo.type == IndexType::FULLTEXT) {
+                return openIndexRecordFullText(txn, indexInfo).countEntries();
+            } else if (indexInfo.type == IndexType::HASH) {
+                return openIndexRecordHash(txn, indexInfo).countEntries();
+            } else {
+                return openIndexRecordString(txn, indexInfo).countEntries();
+            }
+        default:
+            break;
+        }
+        return size_t { 0 };
+    }
+
+    std::pair<bool, std::string> IndexUtils::getIndexKey(const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        const Bytes& value)
+    {
+        switch (propertyInfo.type) {
+        case PropertyType::UNSIGNED_TINYINT:
+            return std::make_pair(false, toIndexKey(static_cast<uint64_t>(value.toTinyIntU())));
+        case PropertyType::UNSIGNED_SMALLINT:
+            return std::make_pair(false, toIndexKey(static_cast<uint64_t>(value.toSmallIntU())));
+        case PropertyType::UNSIGNED_INTEGER:
+            return std::make_pair(false, toIndexKey(static_cast<uint64_t>(value.toIntU())));
+        case PropertyType::UNSIGNED_BIGINT:
+            return std::make_pair(false, toIndexKey(value.toBigIntU()));
+        case PropertyType::TINYINT: {
+            auto key = static_cast<int64_t>(value.toTinyInt());
+            return std::make_pair(key < 0, toIndexKey(key));
+        }
+        case PropertyType::SMALLINT: {
+            auto key = static_cast<int64_t>(value.toSmallInt());
+            return std::make_pair(key < 0, toIndexKey(key));
+        }
+        case PropertyType::INTEGER: {
+            auto key = static_cast<int64_t>(value.toInt());
+            return std::make_pair(key < 0, toIndexKey(key));
+        }
+        case PropertyType::BIGINT: {
+            auto key = value.toBigInt();
+            return std::make_pair(key < 0, toIndexKey(key));
+        }
+        case PropertyType::REAL: {
+            auto key = value.toReal();
+            return std::make_pair(key < 0, toIndexKey(key));
+        }
+        case PropertyType::TEXT:
+            return (indexInfo.type == IndexType::HASH)
+                ? std::make_pair(false, toIndexKey(hashIndexKey(value.toText())))
+                : std::make_pair(false, value.toText());
+        default:
+            break;
+        }
+        return std::make_pair(false, std::string {});
+    }
+
+    double IndexUtils::getDefaultSelectivity(const Condition& condition)
+    {
+        auto selectivity = DEFAULT_RANGE_SELECTIVITY;
+        if (condition.comp == Condition::Comparator::EQUAL) {
+            selectivity = DEFAULT_EQUAL_SELECTIVITY;
+        } else if (condition.comp == Condition::Comparator::IN) {
+            selectivity = std::min(1.0, DEFAULT_EQUAL_SELECTIVITY * condition.valueSet.size());
+        }
+        return (condition.isNegative) ? 1.0 - selectivity : selectivity;
+    }
+
+    double IndexUtils::estimateSelectivity(const Transaction *txn,
+        const ClassAccessInfo& classInfo,
+        const PropertyNameMapInfo& propertyInfos,
+        const std::shared_ptr<MultiCondition::ExprNode>& exprNode,
+        bool isNegative,
+        bool isConjunct,
+        double numOfRecords,
+        double& indexCost,
+        double& leadingRecords,
+        IndexPlan& indexPlan)
+    {
+        if (exprNode->checkIfCmpFunction()) {
+            return DEFAULT_RANGE_SELECTIVITY;
+        } else if (exprNode->checkIfCondition()) {
+            auto& condition = ((MultiCondition::ConditionNode*)exprNode.get())->getCondition();
+            auto isApplyNegative = condition.isNegative ^ isNegative;
+            auto positiveCondition = condition;
+            positiveCondition.isNegative = false;
+            auto foundProperty = propertyInfos.find(condition.propName);
+            if (foundProperty == propertyInfos.cend()) {
+                return getDefaultSelectivity(condition);
+            }
+            auto& propertyInfo = foundProperty->second;
+            auto foundIndex = hasIndex(txn, classInfo, propertyInfo, positiveCondition);
+            if (!foundIndex.first) {
+                positiveCondition.isNegative = isApplyNegative;
+                return getDefaultSelectivity(positiveCondition);
+            }
+            auto& indexInfo = foundIndex.second;
+            auto estimatedRecords = estimateRecord(txn, propertyInfo, indexInfo, positiveCondition);
+            auto selectivity = (numOfRecords > 0.0) ? std::min(1.0, estimatedRecords / numOfRecords) : 0.0;
+            if (!isApplyNegative) {
+                indexCost += (indexInfo.type == IndexType::FULLTEXT)
+                    ? estimatedRecords * (COST_INDEX_ENTRY + COST_FETCH_RECORD)
+                    : estimatedRecords * COST_INDEX_ENTRY;
+                if (isConjunct && (indexPlan.leadingCondition == nullptr || estimatedRecords < leadingRecords)) {
+                    indexPlan.leadingCondition = std::make_shared<Condition>(positiveCondition);
+                    indexPlan.leadingPropertyInfo = propertyInfo;
+                    indexPlan.leadingIndexInfo = indexInfo;
+                    leadingRecords = estimatedRecords;
+                }
+                return selectivity;
+            } else {
+                // negated equality reads all other entries of an ordered index and scans the class otherwise
+                indexCost += (indexInfo.type == IndexType::ORDERED && condition.comp == Condition::Comparator::EQUAL)
+                    ? (numOfRecords - estimatedRecords) * COST_INDEX_ENTRY
+                    : numOfRecords * COST_SCAN_RECORD;
+                return 1.0 - selectivity;
+            }
+        } else {
+            auto compositeNode = (MultiCondition::CompositeNode*)exprNode.get();
+            auto isApplyNegative = compositeNode->getIsNegative() ^ isNegative;
+            auto isAnd = (compositeNode->getOperator() == MultiCondition::Operator::AND && !isApplyNegative)
+                || (compositeNode->getOperator() == MultiCondition::Operator::OR && isApplyNegative);
+            auto leftSelectivity = estimateSelectivity(txn, classInfo, propertyInfos, compositeNode->getLeftNode(),
+                isApplyNegative, isConjunct && isAnd, numOfRecords, indexCost, leadingRecords, indexPlan);
+            auto rightSelectivity = estimateSelectivity(txn, classInfo, propertyInfos, compositeNode->getRightNode(),
+                isApplyNegative, isConjunct && isAnd, numOfRecords, indexCost, leadingRecords, indexPlan);
+            // conditions are assumed to be independent of each other
+            return (isAnd) ? leftSelectivity * rightSelectivity
+                           : leftSelectivity + rightSelectivity - leftSelectivity * rightSelectivity;
+        }
+    }
+
     IndexRecord IndexUtils::openIndexRecordPositive(const Transaction *txn, const IndexAccessInfo& indexInfo)
     {
         auto uniqueFlag = (indexInfo.isUnique) ? INDEX_TYPE_UNIQUE : INDEX_TYPE_NON_UNIQUE;
@@ -606,27 +1150,351 @@ namespace index {
         return indexAccess;
     }
 
+    IndexRecord IndexUtils::openIndexRecordFullText(const Transaction *txn, const IndexAccessInfo& indexInfo)
+    {
+        auto indexFlags = INDEX_TYPE_POSITIVE | INDEX_TYPE_STRING | INDEX_TYPE_NON_UNIQUE | INDEX_TYPE_FULLTEXT;
+        auto indexAccess = IndexRecord { txn->_txnBase, indexInfo.id, (unsigned int)indexFlags };
+        return indexAccess;
+    }
+
     void IndexUtils::createString(const Transaction *txn,
         const PropertyAccessInfo& propertyInfo,
         const IndexAccessInfo& indexInfo,
-        const ClassId& superClassId,
         const ClassType& classType)
     {
-        auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(txn, indexInfo.classId, superClassId);
-        require(!propertyIdMapInfo.empty());
+        auto entries = std::vector<std::pair<std::string, PositionId>> {};
+        collectIndexEntries(txn, propertyInfo, indexInfo, classType,
+            [&](const PositionId& positionId, const Bytes& bytesValue) {
+                auto value = bytesValue.toText();
+                if (!value.empty()) {
+                    entries.emplace_back(std::move(value), positionId);
+                }
+            });
+        auto statistics = IndexStatistics {};
+        auto histogram = HistogramBuilder { statistics, false, getBucketDepth(entries.size()) };
         auto indexAccess = openIndexRecordString(txn, indexInfo);
-        auto dataRecord = DataRecord(txn->_txnBase, indexInfo.classId, classType);
+        bulkLoad(indexAccess, entries, histogram, indexInfo.isUnique);
+        histogram.finish();
+        IndexStatisticsAccess(txn->_txnBase).create(indexInfo.id, statistics);
+    }
+
+    void IndexUtils::createFullText(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        const ClassType& classType)
+    {
+        auto entries = std::vector<std::pair<std::string, PositionId>> {};
+        collectIndexEntries(txn, propertyInfo, indexInfo, classType,
+            [&](const PositionId& positionId, const Bytes& bytesValue) {
+                for (const auto& token : getFullTextTokens(bytesValue.toText())) {
+                    entries.emplace_back(token, positionId);
+                }
+            });
+        // postings of tokens are counted directly from the index when searching
+        auto statistics = IndexStatistics {};
+        auto histogram = HistogramBuilder { statistics, false, 0 };
+        auto indexAccess = openIndexRecordFullText(txn, indexInfo);
+        bulkLoad(indexAccess, entries, histogram, false, true);
+        histogram.finish();
+        IndexStatisticsAccess(txn->_txnBase).create(indexInfo.id, statistics);
+    }
+
+    void IndexUtils::insertFullText(const Transaction *txn,
+        const IndexAccessInfo& indexInfo,
+        PositionId positionId,
+        const std::string& value)
+    {
+        auto indexAccess = openIndexRecordFullText(txn, indexInfo);
+        for (const auto& token : getFullTextTokens(value)) {
+            indexAccess.createPosting(token, positionId);
+        }
+    }
+
+    void IndexUtils::removeFullText(const Transaction *txn,
+        const IndexAccessInfo& indexInfo,
+        PositionId positionId,
+        const std::string& value)
+    {
+        auto indexAccess = openIndexRecordFullText(txn, indexInfo);
+        for (const auto& token : getFullTextTokens(value)) {
+            indexAccess.removePosting(token, positionId);
+        }
+    }
+
+    std::set<std::string> IndexUtils::getFullTextTokens(const std::string& text)
+    {
+        // tokens are case-folded n-grams so that any substring of a text can be looked up
+        auto result = std::set<std::string> {};
+        if (text.size() >= FULLTEXT_TOKEN_LENGTH) {
+            auto foldedText = text;
+            utils::string::toLowerCase(foldedText);
+            for (auto i = size_t { 0 }; i + FULLTEXT_TOKEN_LENGTH <= foldedText.size(); ++i) {
+                result.emplace(foldedText.substr(i, FULLTEXT_TOKEN_LENGTH));
+            }
+        }
+        return result;
+    }
+
+    std::set<std::string> IndexUtils::getFullTextSearchTokens(const Condition& condition)
+    {
+        auto searchText = condition.valueBytes.toText();
+        if (condition.comp != Condition::Comparator::LIKE) {
+            return getFullTextTokens(searchText);
+        }
+        // only literal fragments of a LIKE pattern (which is matched as a regular expression) must appear in a text
+        auto result = std::set<std::string> {};
+        auto fragment = std::string {};
+        for (const auto& c : searchText + "%") {
+            if (std::string { "%_.^$|()[]{}*+?\\" }.find(c) != std::string::npos) {
+                auto tokens = getFullTextTokens(fragment);
+                result.insert(tokens.cbegin(), tokens.cend());
+                fragment.clear();
+            } else {
+                fragment.push_back(c);
+            }
+        }
+        return result;
+    }
+
+    std::vector<RecordDescriptor> IndexUtils::getFullTextRecord(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        const Condition& condition,
+        bool isNegative)
+    {
+        auto result = std::vector<RecordDescriptor> {};
+        if (isNegative) {
+            // records without the tokens cannot be enumerated from postings
+            return getRecordByScan(txn, propertyInfo, indexInfo, condition, isNegative);
+        }
+
+        // intersect posting lists starting from the rarest token
+        auto indexAccess = openIndexRecordFullText(txn, indexInfo);
+        auto tokenCounts = std::vector<std::pair<size_t, std::string>> {};
+        for (const auto& token : getFullTextSearchTokens(condition)) {
+            auto count = indexAccess.countPostings(token);
+            if (count == 0) {
+                return result;
+            }
+            tokenCounts.emplace_back(count, token);
+        }
+        std::sort(tokenCounts.begin(), tokenCounts.end());
+        auto candidates = std::vector<PositionId> {};
+        for (const auto& tokenCount : tokenCounts) {
+            auto postings = indexAccess.getPostings(tokenCount.second);
+            if (candidates.empty()) {
+                candidates = std::move(postings);
+            } else {
+                auto intersection = std::vector<PositionId> {};
+                std::set_intersection(candidates.cbegin(), candidates.cend(),
+                    postings.cbegin(), postings.cend(), std::back_inserter(intersection));
+                candidates = std::move(intersection);
+            }
+            if (candidates.empty()) {
+                return result;
+            }
+        }
+
+        // n-grams only give candidates; the actual text has to be verified
+        auto cmpCondition = condition;
+        cmpCondition.isNegative = false;
+        auto compiledCondition = cmpCondition.compile(PropertyType::TEXT);
+        return verifyRecord(txn, propertyInfo, indexInfo, candidates, [&](const Bytes& value) {
+            return compiledCondition(value);
+        });
+    }
+
+    IndexRecord IndexUtils::openIndexRecordHash(const Transaction *txn, const IndexAccessInfo& indexInfo)
+    {
+        auto indexFlags = INDEX_TYPE_POSITIVE | INDEX_TYPE_NUMERIC | INDEX_TYPE_NON_UNIQUE | INDEX_TYPE_HASH;
+        auto indexAccess = IndexRecord { txn->_txnBase, indexInfo.id, (unsigned int)indexFlags };
+        return indexAccess;
+    }
+
+    void IndexUtils::createHash(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        const ClassType& classType)
+    {
+        auto entries = std::vector<std::pair<uint64_t, PositionId>> {};
+        collectIndexEntries(txn, propertyInfo, indexInfo, classType,
+            [&](const PositionId& positionId, const Bytes& bytesValue) {
+                entries.emplace_back(hashIndexKey(bytesValue.toText()), positionId);
+            });
+        auto statistics = IndexStatistics {};
+        auto histogram = HistogramBuilder { statistics, false, getBucketDepth(entries.size()) };
+        auto indexAccess = openIndexRecordHash(txn, indexInfo);
+        // hashes are stored as duplicated keys so that colliding values can live side by side
+        bulkLoad(indexAccess, entries, histogram, false, true);
+        histogram.finish();
+        if (indexInfo.isUnique) {
+            for (auto it = entries.cbegin(); it != entries.cend(); ++it) {
+                if (std::next(it) != entries.cend() && std::next(it)->first == it->first) {
+                    auto value = getPropertyValue(txn, propertyInfo, indexInfo, it->second).toText();
+                    if (hasHashValue(txn, propertyInfo, indexInfo, it->first, value, it->second)) {
+                        throw NOGDB_STORAGE_ERROR(MDB_KEYEXIST);
+                    }
+                }
+            }
+        }
+        IndexStatisticsAccess(txn->_txnBase).create(indexInfo.id, statistics);
+    }
+
+    void IndexUtils::insertHash(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        PositionId positionId,
+        const std::string& value)
+    {
+        auto hashValue = hashIndexKey(value);
+        // a unique constraint is decided by the actual values because different values may share a hash
+        if (indexInfo.isUnique && hasHashValue(txn, propertyInfo, indexInfo, hashValue, value, positionId)) {
+            throw NOGDB_STORAGE_ERROR(MDB_KEYEXIST);
+        }
+        openIndexRecordHash(txn, indexInfo).createPosting(hashValue, positionId);
+    }
+
+    void IndexUtils::removeHash(const Transaction *txn,
+        const IndexAccessInfo& indexInfo,
+        PositionId positionId,
+        const std::string& value)
+    {
+        openIndexRecordHash(txn, indexInfo).removePosting(hashIndexKey(value), positionId);
+    }
+
+    bool IndexUtils::hasHashValue(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        uint64_t hashValue,
+        const std::string& value,
+        PositionId excludedPositionId)
+    {
+        auto positionIds = openIndexRecordHash(txn, indexInfo).getPostings(hashValue);
+        positionIds.erase(std::remove(positionIds.begin(), positionIds.end(), excludedPositionId), positionIds.end());
+        return !verifyRecord(txn, propertyInfo, indexInfo, positionIds, [&](const Bytes& recordValue) {
+            return recordValue.toText() == value;
+        }).empty();
+    }
+
+    std::vector<RecordDescriptor> IndexUtils::getHashRecord(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        const Condition& condition,
+        bool isNegative)
+    {
+        if (isNegative) {
+            // records with other values are scattered over all hashes
+            return getRecordByScan(txn, propertyInfo, indexInfo, condition, isNegative);
+        }
+        if (condition.comp == Condition::Comparator::IN) {
+            auto values = std::unordered_set<std::string> {};
+            auto hashValues = std::vector<uint64_t> {};
+            for (const auto& valueBytes : condition.valueSet) {
+                auto value = valueBytes.toText();
+                hashValues.emplace_back(hashIndexKey(value));
+                values.emplace(std::move(value));
+            }
+            auto positionIds = multiSeekIndex(openIndexRecordHash(txn, indexInfo).getCursor(), hashValues);
+            return verifyRecord(txn, propertyInfo, indexInfo, positionIds, [&](const Bytes& recordValue) {
+                return values.find(recordValue.toText()) != values.cend();
+            });
+        }
+        auto value = condition.valueBytes.toText();
+        auto positionIds = openIndexRecordHash(txn, indexInfo).getPostings(hashIndexKey(value));
+        // resolve hash collisions against the stored values
+        return verifyRecord(txn, propertyInfo, indexInfo, positionIds, [&](const Bytes& recordValue) {
+            return recordValue.toText() == value;
+        });
+    }
+
+    uint64_t IndexUtils::hashIndexKey(const std::string& value)
+    {
+        // 64-bit FNV-1a; hashes are persisted in index tables so the function must never change
+        auto hashValue = uint64_t { 14695981039346656037ULL };
+        for (const auto& c : value) {
+            hashValue ^= static_cast<uint8_t>(c);
+            hashValue *= uint64_t { 1099511628211ULL };
+        }
+        return hashValue;
+    }
+
+    Bytes IndexUtils::getPropertyValue(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        PositionId positionId)
+    {
+        auto classInfo = txn->_adapter->dbClass()->getInfo(indexInfo.classId);
+        auto dataRecord = DataRecord(txn->_txnBase, indexInfo.classId, classInfo.type);
+        return RecordParser::parseRawDataProperty(dataRecord.getResult(positionId),
+            propertyInfo.id, classInfo.type == ClassType::EDGE, txn->_txnCtx->isVersionEnabled());
+    }
+
+    std::vector<RecordDescriptor> IndexUtils::verifyRecord(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        const std::vector<PositionId>& positionIds,
+        const std::function<bool(const Bytes&)>& predicate)
+    {
+        auto result = std::vector<RecordDescriptor> {};
+        if (positionIds.empty()) {
+            return result;
+        }
+        auto classInfo = txn->_adapter->dbClass()->getInfo(indexInfo.classId);
+        auto isEdge = classInfo.type == ClassType::EDGE;
+        auto isVersionEnabled = txn->_txnCtx->isVersionEnabled();
+        auto dataRecord = DataRecord(txn->_txnBase, indexInfo.classId, classInfo.type);
+        for (const auto& positionId : positionIds) {
+            auto value = RecordParser::parseRawDataProperty(
+                dataRecord.getResult(positionId), propertyInfo.id, isEdge, isVersionEnabled);
+            if (!value.empty() && predicate(value)) {
+                result.emplace_back(RecordDescriptor { indexInfo.classId, positionId });
+            }
+        }
+        return result;
+    }
+
+    std::vector<RecordDescriptor> IndexUtils::getRecordByScan(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        const Condition& condition,
+        bool isNegative)
+    {
+        auto result = std::vector<RecordDescriptor> {};
+        auto classInfo = txn->_adapter->dbClass()->getInfo(indexInfo.classId);
+        auto isEdge = classInfo.type == ClassType::EDGE;
+        auto isVersionEnabled = txn->_txnCtx->isVersionEnabled();
+        auto cmpCondition = condition;
+        cmpCondition.isNegative = isNegative;
+        auto compiledCondition = cmpCondition.compile(propertyInfo.type);
         std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> callback =
+            [&](const PositionId& positionId, const storage_engine::lmdb::Result& rawData) {
+                auto value = RecordParser::parseRawDataProperty(rawData, propertyInfo.id, isEdge, isVersionEnabled);
+                if (!value.empty() && compiledCondition(value)) {
+                    result.emplace_back(RecordDescriptor { indexInfo.classId, positionId });
+                }
+            };
+        DataRecord(txn->_txnBase, indexInfo.classId, classInfo.type).resultSetIter(callback);
+        return result;
+    }
+
+    void IndexUtils::collectIndexEntries(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        const ClassType& classType,
+        const std::function<void(const PositionId&, const Bytes&)>& callback)
+    {
+        auto dataRecord = DataRecord(txn->_txnBase, indexInfo.classId, classType);
+        auto isEdge = classType == ClassType::EDGE;
+        auto isVersionEnabled = txn->_txnCtx->isVersionEnabled();
+        std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> iterCallback =
             [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
-                auto const record = RecordParser::parseRawData(
-                    result, propertyIdMapInfo, classType == ClassType::EDGE, txn->_txnCtx->isVersionEnabled());
-                auto value = record.get(propertyInfo.name).toText();
-                if (!value.empty()) {
-                    auto indexRecord = Blob(sizeof(PositionId)).append(&positionId, sizeof(PositionId));
-                    indexAccess.create(value, indexRecord);
+                // decode only the indexed property rather than the whole record
+                auto bytesValue = RecordParser::parseRawDataProperty(result, propertyInfo.id, isEdge, isVersionEnabled);
+                if (!bytesValue.empty()) {
+                    callback(positionId, bytesValue);
                 }
             };
-        dataRecord.resultSetIter(callback);
+        dataRecord.resultSetIter(iterCallback);
     }
 
     void IndexUtils::insert(const Transaction *txn,
@@ -733,6 +1601,76 @@ namespace index {
         return getLessCommon(txn, propertyInfo, indexInfo, value, false);
     }
 
+    std::vector<RecordDescriptor> IndexUtils::getIn(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        const std::vector<Bytes>& values)
+    {
+        switch (propertyInfo.type) {
+        case PropertyType::UNSIGNED_TINYINT:
+        case PropertyType::UNSIGNED_SMALLINT:
+        case PropertyType::UNSIGNED_INTEGER:
+        case PropertyType::UNSIGNED_BIGINT: {
+            auto keys = std::vector<uint64_t> {};
+            for (const auto& value : values) {
+                if (propertyInfo.type == PropertyType::UNSIGNED_TINYINT) {
+                    keys.emplace_back(static_cast<uint64_t>(value.toTinyIntU()));
+                } else if (propertyInfo.type == PropertyType::UNSIGNED_SMALLINT) {
+                    keys.emplace_back(static_cast<uint64_t>(value.toSmallIntU()));
+                } else if (propertyInfo.type == PropertyType::UNSIGNED_INTEGER) {
+                    keys.emplace_back(static_cast<uint64_t>(value.toIntU()));
+                } else {
+                    keys.emplace_back(value.toBigIntU());
+                }
+            }
+            auto result = std::vector<RecordDescriptor> {};
+            for (const auto& positionId : multiSeekIndex(openIndexRecordPositive(txn, indexInfo).getCursor(), keys)) {
+                result.emplace_back(RecordDescriptor { indexInfo.classId, positionId });
+            }
+            return result;
+        }
+        case PropertyType::TINYINT:
+        case PropertyType::SMALLINT:
+        case PropertyType::INTEGER:
+        case PropertyType::BIGINT: {
+            auto keys = std::vector<int64_t> {};
+            for (const auto& value : values) {
+                if (propertyInfo.type == PropertyType::TINYINT) {
+                    keys.emplace_back(static_cast<int64_t>(value.toTinyInt()));
+                } else if (propertyInfo.type == PropertyType::SMALLINT) {
+                    keys.emplace_back(static_cast<int64_t>(value.toSmallInt()));
+                } else if (propertyInfo.type == PropertyType::INTEGER) {
+                    keys.emplace_back(static_cast<int64_t>(value.toInt()));
+                } else {
+                    keys.emplace_back(value.toBigInt());
+                }
+            }
+            return getInNumeric(txn, indexInfo, keys);
+        }
+        case PropertyType::REAL: {
+            auto keys = std::vector<double> {};
+            for (const auto& value : values) {
+                keys.emplace_back(value.toReal());
+            }
+            return getInNumeric(txn, indexInfo, keys);
+        }
+        case PropertyType::TEXT: {
+            auto keys = std::vector<std::string> {};
+            for (const auto& value : values) {
+                keys.emplace_back(value.toText());
+            }
+            auto result = std::vector<RecordDescriptor> {};
+            for (const auto& positionId : multiSeekIndex(openIndexRecordString(txn, indexInfo).getCursor(), keys)) {
+                result.emplace_back(RecordDescriptor { indexInfo.classId, positionId });
+            }
+            return result;
+        }
+        default:
+            break;
+        }
+        return std::vector<RecordDescriptor> {};
+    }
+
     std::vector<RecordDescriptor> IndexUtils::getEqual(const Transaction *txn,
         const PropertyAccessInfo& propertyInfo,
         const IndexAccessInfo& indexInfo,
@@ -22,7 +22,11 @@
 #pragma once
 
 #include <algorithm>
+#include <cstring>
 #include <functional>
+#include <set>
+#include <iterator>
+#include <memory>
 #include <type_traits>
 #include <unordered_set>
 #include <vector>
@@ -43,15 +47,40 @@ namespace index {
     using namespace schema;
     using parser::RecordParser;
 
+    // length of n-gram tokens (in bytes) stored in full-text indexes
+    constexpr size_t FULLTEXT_TOKEN_LENGTH = 3;
+
+    // number of equi-depth buckets kept in the histogram of an index
+    constexpr size_t INDEX_HISTOGRAM_BUCKETS = 32;
+
+    // relative costs of reading one record from a class table, one entry from an index table
+    // and one record looked up by its position id
+    constexpr double COST_SCAN_RECORD = 1.0;
+    constexpr double COST_INDEX_ENTRY = 0.05;
+    constexpr double COST_FETCH_RECORD = 1.5;
+
+    // selectivities assumed for predicates which cannot be estimated from an index
+    constexpr double DEFAULT_EQUAL_SELECTIVITY = 0.1;
+    constexpr double DEFAULT_RANGE_SELECTIVITY = 0.5;
+
     typedef std::map<PropertyId, IndexAccessInfo> PropertyIdMapIndex;
     typedef std::map<std::string, std::pair<PropertyAccessInfo, IndexAccessInfo>> PropertyNameMapIndex;
 
+    struct IndexPlan {
+        QueryPlan plan {};
+        // indexes of all conditions for INDEX_INTERSECTION
+        PropertyIdMapIndex propertyIndexInfo {};
+        // the condition answered by an index for INDEX_WITH_FILTER
+        std::shared_ptr<Condition> leadingCondition {};
+        PropertyAccessInfo leadingPropertyInfo {};
+        IndexAccessInfo leadingIndexInfo {};
+    };
+
     struct IndexUtils {
 
         static void initialize(const Transaction *txn,
             const PropertyAccessInfo& propertyInfo,
             const IndexAccessInfo& indexInfo,
-            const ClassId& superClassId,
             const ClassType& classType);
 
         static void drop(const Transaction *txn,
@@ -84,11 +113,27 @@ namespace index {
             const Record& record,
             const PropertyNameMapIndex& propertyNameMapIndex);
 
+        // the entries of many records of a class, written in the key order of each index table
+        static void insert(const Transaction *txn,
+            const std::vector<RecordDescriptor>& recordDescriptors,
+            const std::vector<Record>& records,
+            const PropertyNameMapIndex& propertyNameMapIndex);
+
+        static void remove(const Transaction *txn,
+            const std::vector<RecordDescriptor>& recordDescriptors,
+            const std::vector<Record>& records,
+            const PropertyNameMapIndex& propertyNameMapIndex);
+
         static PropertyNameMapIndex getIndexInfos(const Transaction *txn,
             const RecordDescriptor& recordDescriptor,
             const Record& record,
             const PropertyNameMapInfo& propertyNameMapInfo);
 
+        // every index of a class, whichever properties its records have
+        static PropertyNameMapIndex getIndexInfos(const Transaction *txn,
+            const ClassId& classId,
+            const PropertyNameMapInfo& propertyNameMapInfo);
+
         static std::pair<bool, IndexAccessInfo> hasIndex(const Transaction *txn,
             const ClassAccessInfo& classInfo,
             const PropertyAccessInfo& propertyInfo,
@@ -121,9 +166,37 @@ namespace index {
             const PropertyIdMapIndex& propertyIndexInfo,
             const MultiCondition& conditions);
 
+        static void analyze(const Transaction *txn,
+            const PropertyAccessInfo& propertyInfo,
+            const IndexAccessInfo& indexInfo);
+
+        static adapter::index::IndexStatistics getStatistics(const Transaction *txn,
+            const IndexAccessInfo& indexInfo);
+
+        static double estimateRecord(const Transaction *txn,
+            const PropertyAccessInfo& propertyInfo,
+            const IndexAccessInfo& indexInfo,
+            const Condition& condition);
+
+        static IndexPlan planCondition(const Transaction *txn,
+            const ClassAccessInfo& classInfo,
+            const PropertyAccessInfo& propertyInfo,
+            const Condition& condition,
+            bool searchIndexOnly,
+            bool isExplained = false);
+
+        static IndexPlan planMultiCondition(const Transaction *txn,
+            const ClassAccessInfo& classInfo,
+            const PropertyNameMapInfo& propertyInfos,
+            const MultiCondition& conditions,
+            bool searchIndexOnly,
+            bool isExplained = false);
+
     protected:
         static const std::vector<Condition::Comparator> validComparators;
 
+        static const std::vector<Condition::Comparator> validFullTextComparators;
+
     private:
 
         static adapter::index::IndexRecord openIndexRecordPositive(const Transaction *txn,
@@ -135,65 +208,389 @@ namespace index {
         static adapter::index::IndexRecord openIndexRecordString(const Transaction *txn,
             const IndexAccessInfo& indexInfo);
 
+        static adapter::index::IndexRecord openIndexRecordFullText(const Transaction *txn,
+            const IndexAccessInfo& indexInfo);
+
+        static adapter::index::IndexRecord openIndexRecordHash(const Transaction *txn,
+            const IndexAccessInfo& indexInfo);
+
         template <typename T>
         static void createNumeric(const Transaction *txn,
             const PropertyAccessInfo& propertyInfo,
             const IndexAccessInfo& indexInfo,
-            const ClassId& superClassId,
             const ClassType& classType,
             T (*valueRetrieve)(const Bytes&))
         {
-            auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(txn, indexInfo.classId, superClassId);
-            require(!propertyIdMapInfo.empty());
+            auto entries = std::vector<std::pair<T, PositionId>> {};
+            collectIndexEntries(txn, propertyInfo, indexInfo, classType,
+                [&](const PositionId& positionId, const Bytes& bytesValue) {
+                    entries.emplace_back(valueRetrieve(bytesValue), positionId);
+                });
+            auto statistics = adapter::index::IndexStatistics {};
+            auto histogram = HistogramBuilder { statistics, false, getBucketDepth(entries.size()) };
             auto indexAccess = openIndexRecordPositive(txn, indexInfo);
-            auto dataRecord = DataRecord(txn->_txnBase, indexInfo.classId, classType);
-            std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> callback =
-                [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
-                    auto const record = RecordParser::parseRawData(
-                        result, propertyIdMapInfo, classType == ClassType::EDGE, txn->_txnCtx->isVersionEnabled());
-                    auto bytesValue = record.get(propertyInfo.name);
-                    if (!bytesValue.empty()) {
-                        auto indexRecord = Blob(sizeof(PositionId)).append(&positionId, sizeof(PositionId));
-                        indexAccess.create(valueRetrieve(bytesValue), indexRecord);
-                    }
-                };
-            dataRecord.resultSetIter(callback);
+            bulkLoad(indexAccess, entries, histogram, indexInfo.isUnique);
+            histogram.finish();
+            adapter::index::IndexStatisticsAccess(txn->_txnBase).create(indexInfo.id, statistics);
         }
 
         template <typename T>
         static void createSignedNumeric(const Transaction *txn,
             const PropertyAccessInfo& propertyInfo,
             const IndexAccessInfo& indexInfo,
-            const ClassId& superClassId,
             const ClassType& classType,
             T (*valueRetrieve)(const Bytes&))
         {
-            auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(txn, indexInfo.classId, superClassId);
-            require(!propertyIdMapInfo.empty());
-            auto indexPositiveAccess = openIndexRecordPositive(txn, indexInfo);
+            auto positiveEntries = std::vector<std::pair<T, PositionId>> {};
+            auto negativeEntries = std::vector<std::pair<T, PositionId>> {};
+            collectIndexEntries(txn, propertyInfo, indexInfo, classType,
+                [&](const PositionId& positionId, const Bytes& bytesValue) {
+                    auto value = valueRetrieve(bytesValue);
+                    (value >= 0) ? positiveEntries.emplace_back(value, positionId)
+                                 : negativeEntries.emplace_back(value, positionId);
+                });
+            auto statistics = adapter::index::IndexStatistics {};
+            auto bucketDepth = getBucketDepth(positiveEntries.size() + negativeEntries.size());
+            auto negativeHistogram = HistogramBuilder { statistics, true, bucketDepth };
             auto indexNegativeAccess = openIndexRecordNegative(txn, indexInfo);
-            auto dataRecord = DataRecord(txn->_txnBase, indexInfo.classId, classType);
-            std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> callback =
-                [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
-                    auto const record = RecordParser::parseRawData(
-                        result, propertyIdMapInfo, classType == ClassType::EDGE, txn->_txnCtx->isVersionEnabled());
-                    auto bytesValue = record.get(propertyInfo.name);
-                    if (!bytesValue.empty()) {
-                        auto indexRecord = Blob(sizeof(PositionId)).append(&positionId, sizeof(PositionId));
-                        auto value = valueRetrieve(bytesValue);
-                        (value >= 0) ? indexPositiveAccess.create(value, indexRecord)
-                                     : indexNegativeAccess.create(value, indexRecord);
-                    }
-                };
-            dataRecord.resultSetIter(callback);
+            bulkLoad(indexNegativeAccess, negativeEntries, negativeHistogram, indexInfo.isUnique);
+            negativeHistogram.finish();
+            auto positiveHistogram = HistogramBuilder { statistics, false, bucketDepth };
+            auto indexPositiveAccess = openIndexRecordPositive(txn, indexInfo);
+            bulkLoad(indexPositiveAccess, positiveEntries, positiveHistogram, indexInfo.isUnique);
+            positiveHistogram.finish();
+            adapter::index::IndexStatisticsAccess(txn->_txnBase).create(indexInfo.id, statistics);
         }
 
         static void createString(const Transaction *txn,
             const PropertyAccessInfo& propertyInfo,
             const IndexAccessInfo& indexInfo,
-            const ClassId& superClassId,
             const ClassType& classType);
 
+        static void createFullText(const Transaction *txn,
+            const PropertyAccessInfo& propertyInfo,
+            const IndexAccessInfo& indexInfo,
+            const ClassType& classType);
+
+        static void insertFullText(const Transaction *txn,
+            const IndexAccessInfo& indexInfo,
+            PositionId positionId,
+            const std::string& value);
+
+        static void removeFullText(const Transaction *txn,
+            const IndexAccessInfo& indexInfo,
+            PositionId positionId,
+            const std::string& value);
+
+        // the values of the records in [begin, end), in the order of their keys in the index table
+        static std::vector<std::pair<PositionId, Bytes>> getSortedIndexEntries(const PropertyAccessInfo& propertyInfo,
+            const IndexAccessInfo& indexInfo,
+            const std::string& propertyName,
+            const std::vector<RecordDescriptor>& recordDescriptors,
+            const std::vector<Record>& records,
+            size_t begin,
+            size_t end);
+
+        static std::set<std::string> getFullTextTokens(const std::string& text);
+
+        static std::set<std::string> getFullTextSearchTokens(const Condition& condition);
+
+        static std::vector<RecordDescriptor> getFullTextRecord(const Transaction *txn,
+            const PropertyAccessInfo& propertyInfo,
+            const IndexAccessInfo& indexInfo,
+            const Condition& condition,
+            bool isNegative);
+
+        static void createHash(const Transaction *txn,
+            const PropertyAccessInfo& propertyInfo,
+            const IndexAccessInfo& indexInfo,
+            const ClassType& classType);
+
+        static void insertHash(const Transaction *txn,
+            const PropertyAccessInfo& propertyInfo,
+            const IndexAccessInfo& indexInfo,
+            PositionId positionId,
+            const std::string& value);
+
+        static void removeHash(const Transaction *txn,
+            const IndexAccessInfo& indexInfo,
+            PositionId positionId,
+            const std::string& value);
+
+        static bool hasHashValue(const Transaction *txn,
+            const PropertyAccessInfo& propertyInfo,
+            const IndexAccessInfo& indexInfo,
+            uint64_t hashValue,
+            const std::string& value,
+            PositionId excludedPositionId);
+
+        static std::vector<RecordDescriptor> getHashRecord(const Transaction *txn,
+            const PropertyAccessInfo& propertyInfo,
+            const IndexAccessInfo& indexInfo,
+            const Condition& condition,
+            bool isNegative);
+
+        static uint64_t hashIndexKey(const std::string& value);
+
+        static Bytes getPropertyValue(const Transaction *txn,
+            const PropertyAccessInfo& propertyInfo,
+            const IndexAccessInfo& indexInfo,
+            PositionId positionId);
+
+        static std::vector<RecordDescriptor> verifyRecord(const Transaction *txn,
+            const PropertyAccessInfo& propertyInfo,
+            const IndexAccessInfo& indexInfo,
+            const std::vector<PositionId>& positionIds,
+            const std::function<bool(const Bytes&)>& predicate);
+
+        static std::vector<RecordDescriptor> getRecordByScan(const Transaction *txn,
+            const PropertyAccessInfo& propertyInfo,
+            const IndexAccessInfo& indexInfo,
+            const Condition& condition,
+            bool isNegative);
+
+        /**
+         * Count keys, given in the order of an index table, into equi-depth buckets of the statistics.
+         */
+        class HistogramBuilder {
+        public:
+            HistogramBuilder(adapter::index::IndexStatistics& statistics, bool isNegative, uint64_t bucketDepth)
+                : _statistics { statistics }
+                , _bucket { isNegative, "", 0, 0 }
+                , _bucketDepth { bucketDepth }
+            {
+            }
+
+            void add(const std::string& key)
+            {
+                if (_bucket.count == 0 || key != _currentKey) {
+                    // equal keys never span two buckets, otherwise their number of entries would be split
+                    if (_bucketDepth > 0 && _bucket.count >= _bucketDepth) {
+                        _bucket.upperBound = _currentKey;
+                        _statistics.histogram.emplace_back(_bucket);
+                        _bucket = adapter::index::IndexHistogramBucket { _bucket.isNegative, "", 0, 0 };
+                    }
+                    ++_bucket.distinctKeys;
+                    ++_statistics.distinctKeys;
+                    _currentKey = key;
+                }
+                ++_bucket.count;
+                ++_statistics.entryCount;
+            }
+
+            void finish()
+            {
+                if (_bucketDepth > 0 && _bucket.count > 0) {
+                    _bucket.upperBound = _currentKey;
+                    _statistics.histogram.emplace_back(_bucket);
+                }
+            }
+
+        private:
+            adapter::index::IndexStatistics& _statistics;
+            adapter::index::IndexHistogramBucket _bucket;
+            std::string _currentKey {};
+            uint64_t _bucketDepth;
+        };
+
+        // buckets are only closed on a key boundary, so a bucket may hold more entries than its depth
+        inline static uint64_t getBucketDepth(size_t numOfEntries)
+        {
+            return std::max(uint64_t { 1 }, static_cast<uint64_t>(numOfEntries / INDEX_HISTOGRAM_BUCKETS));
+        }
+
+        static void analyzeIndexRecord(const adapter::index::IndexRecord& indexAccess,
+            bool isNumericKey,
+            bool isNegative,
+            uint64_t bucketDepth,
+            adapter::index::IndexStatistics& statistics);
+
+        static size_t countIndexEntries(const Transaction *txn,
+            const PropertyAccessInfo& propertyInfo,
+            const IndexAccessInfo& indexInfo);
+
+        static std::pair<bool, std::string> getIndexKey(const PropertyAccessInfo& propertyInfo,
+            const IndexAccessInfo& indexInfo,
+            const Bytes& value);
+
+        static double getDefaultSelectivity(const Condition& condition);
+
+        static double estimateSelectivity(const Transaction *txn,
+            const ClassAccessInfo& classInfo,
+            const PropertyNameMapInfo& propertyInfos,
+            const std::shared_ptr<MultiCondition::ExprNode>& exprNode,
+            bool isNegative,
+            bool isConjunct,
+            double numOfRecords,
+            double& indexCost,
+            double& leadingRecords,
+            IndexPlan& indexPlan);
+
+        /**
+         * Histogram bounds keep numeric keys as the bit pattern of the MDB_INTEGERKEY tables
+         * so that they can be compared in the same order as the index tables themselves.
+         */
+        template <typename T>
+        inline static std::string toIndexKey(const T& value)
+        {
+            static_assert(sizeof(T) == sizeof(uint64_t), "numeric index keys must be 64 bits long");
+            return std::string(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        inline static std::string toIndexKey(const std::string& value)
+        {
+            return value;
+        }
+
+        inline static int compareIndexKey(const std::string& lhs, const std::string& rhs, bool isNumericKey)
+        {
+            if (isNumericKey) {
+                auto lhsKey = uint64_t {};
+                auto rhsKey = uint64_t {};
+                memcpy(&lhsKey, lhs.data(), sizeof(uint64_t));
+                memcpy(&rhsKey, rhs.data(), sizeof(uint64_t));
+                return (lhsKey < rhsKey) ? -1 : ((lhsKey > rhsKey) ? 1 : 0);
+            }
+            return lhs.compare(rhs);
+        }
+
+        static std::vector<RecordDescriptor> getIn(const Transaction *txn,
+            const PropertyAccessInfo& propertyInfo,
+            const IndexAccessInfo& indexInfo,
+            const std::vector<Bytes>& values);
+
+        template <typename T>
+        static std::vector<RecordDescriptor> getInNumeric(const Transaction *txn,
+            const IndexAccessInfo& indexInfo,
+            std::vector<T>& keys)
+        {
+            auto result = std::vector<RecordDescriptor> {};
+            auto negativeEnd = std::partition(keys.begin(), keys.end(), [](const T& key) { return key < 0; });
+            auto negativeKeys = std::vector<T>(keys.begin(), negativeEnd);
+            auto positiveKeys = std::vector<T>(negativeEnd, keys.end());
+            if (!negativeKeys.empty()) {
+                auto positionIds = multiSeekIndex(openIndexRecordNegative(txn, indexInfo).getCursor(), negativeKeys);
+                for (const auto& positionId : positionIds) {
+                    result.emplace_back(RecordDescriptor { indexInfo.classId, positionId });
+                }
+            }
+            if (!positiveKeys.empty()) {
+                auto positionIds = multiSeekIndex(openIndexRecordPositive(txn, indexInfo).getCursor(), positiveKeys);
+                for (const auto& positionId : positionIds) {
+                    result.emplace_back(RecordDescriptor { indexInfo.classId, positionId });
+                }
+            }
+            return result;
+        }
+
+        /**
+         * Look up many keys with a single cursor: keys are visited in the order of the index table,
+         * so each MDB_SET_RANGE continues from where the previous one stopped and keys which fall
+         * between two entries already read are skipped without touching the tree.
+         */
+        template <typename K>
+        static std::vector<PositionId> multiSeekIndex(const storage_engine::lmdb::Cursor& cursorHandler,
+            std::vector<K>& keys)
+        {
+            auto result = std::vector<PositionId> {};
+            std::sort(keys.begin(), keys.end(),
+                [](const K& lhs, const K& rhs) { return compareIndexKey(lhs, rhs) < 0; });
+            keys.erase(std::unique(keys.begin(), keys.end(),
+                           [](const K& lhs, const K& rhs) { return compareIndexKey(lhs, rhs) == 0; }),
+                keys.end());
+            auto keyValue = storage_engine::lmdb::CursorResult {};
+            auto isPositioned = false;
+            for (const auto& key : keys) {
+                if (!isPositioned || compareIndexKey(readIndexKey<K>(keyValue), key) < 0) {
+                    keyValue = cursorHandler.findRange(key);
+                    isPositioned = true;
+                }
+                while (!keyValue.empty() && compareIndexKey(readIndexKey<K>(keyValue), key) == 0) {
+                    result.emplace_back(keyValue.val.data.template numeric<PositionId>());
+                    keyValue = cursorHandler.getNext();
+                }
+                if (keyValue.empty()) {
+                    break;
+                }
+            }
+            return result;
+        }
+
+        template <typename K>
+        inline static typename std::enable_if<std::is_arithmetic<K>::value, K>::type
+        readIndexKey(const storage_engine::lmdb::CursorResult& keyValue)
+        {
+            return keyValue.key.data.template numeric<K>();
+        }
+
+        template <typename K>
+        inline static typename std::enable_if<std::is_same<K, std::string>::value, K>::type
+        readIndexKey(const storage_engine::lmdb::CursorResult& keyValue)
+        {
+            return keyValue.key.data.string();
+        }
+
+        static void collectIndexEntries(const Transaction *txn,
+            const PropertyAccessInfo& propertyInfo,
+            const IndexAccessInfo& indexInfo,
+            const ClassType& classType,
+            const std::function<void(const PositionId&, const Bytes&)>& callback);
+
+        /**
+         * Numeric index keys are stored in MDB_INTEGERKEY tables which compare their keys
+         * as unsigned integers, so the bit pattern is the actual sort order of the table
+         * (e.g. negative values of REAL are kept in reverse order).
+         */
+        template <typename T>
+        inline static int compareIndexKey(const T& lhs, const T& rhs)
+        {
+            static_assert(sizeof(T) == sizeof(uint64_t), "numeric index keys must be 64 bits long");
+            auto lhsKey = uint64_t {};
+            auto rhsKey = uint64_t {};
+            memcpy(&lhsKey, &lhs, sizeof(T));
+            memcpy(&rhsKey, &rhs, sizeof(T));
+            return (lhsKey < rhsKey) ? -1 : ((lhsKey > rhsKey) ? 1 : 0);
+        }
+
+        inline static int compareIndexKey(const std::string& lhs, const std::string& rhs)
+        {
+            return lhs.compare(rhs);
+        }
+
+        /**
+         * Sort all entries in the order of the index table and write them with MDB_APPEND(DUP),
+         * which fills pages sequentially instead of searching the tree for every key.
+         * A duplicated key in a unique index causes MDB_KEYEXIST as a normal insertion does.
+         * The sorted keys are also counted into the histogram, so a new index needs no analysis.
+         * Entries are sorted in memory, so building an index keeps one key and position id per record.
+         */
+        template <typename K>
+        static void bulkLoad(adapter::index::IndexRecord& indexAccess,
+            std::vector<std::pair<K, PositionId>>& entries,
+            HistogramBuilder& histogram,
+            bool isUnique,
+            bool isNumericDup = false)
+        {
+            std::sort(entries.begin(), entries.end(),
+                [isNumericDup](const std::pair<K, PositionId>& lhs, const std::pair<K, PositionId>& rhs) {
+                    auto cmp = compareIndexKey(lhs.first, rhs.first);
+                    if (cmp != 0) {
+                        return cmp < 0;
+                    }
+                    // duplicated values are compared as raw bytes in MDB_DUPSORT tables unless MDB_INTEGERDUP is set
+                    return (isNumericDup) ? (lhs.second < rhs.second)
+                                          : (memcmp(&lhs.second, &rhs.second, sizeof(PositionId)) < 0);
+                });
+            for (auto it = entries.cbegin(); it != entries.cend(); ++it) {
+                auto isDuplicate = !isUnique
+                    && it != entries.cbegin()
+                    && compareIndexKey(std::prev(it)->first, it->first) == 0;
+                auto indexRecord = Blob(sizeof(PositionId)).append(&it->second, sizeof(PositionId));
+                indexAccess.createSorted(it->first, indexRecord, isDuplicate);
+                histogram.add(toIndexKey(it->first));
+            }
+        }
+
         template <typename T>
         static void insert(const Transaction *txn,
             const IndexAccessInfo& indexInfo,
@@ -291,6 +688,13 @@ namespace index {
                 condition.comp) != validComparators.cend();
         }
 
+        inline static bool isValidFullTextComparator(const Condition& condition)
+        {
+            return std::find(validFullTextComparators.cbegin(),
+                validFullTextComparators.cend(),
+                condition.comp) != validFullTextComparators.cend();
+        }
+
         static std::vector<RecordDescriptor> getRecordFromMultiCondition(const Transaction *txn,
             const PropertyNameMapInfo& propertyInfos,
             const PropertyIdMapIndex& propertyIndexInfo,
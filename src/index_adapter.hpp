@@ -21,7 +21,9 @@
 
 #pragma once
 
+#include <cstring>
 #include <string>
+#include <vector>
 
 #include "constant.hpp"
 #include "datarecord_adapter.hpp"
@@ -35,6 +37,8 @@
 #define INDEX_TYPE_STRING 2 //0010
 #define INDEX_TYPE_UNIQUE 0 //0000
 #define INDEX_TYPE_NON_UNIQUE 4 //0100
+#define INDEX_TYPE_FULLTEXT 8 //1000
+#define INDEX_TYPE_HASH 16 //10000
 
 namespace nogdb {
 namespace adapter {
@@ -45,7 +49,7 @@ namespace index {
     public:
         IndexRecord(const storage_engine::LMDBTxn* const txn, const IndexId& indexId, const unsigned int flags)
             : LMDBKeyValAccess(txn, buildIndexName(indexId, getPositiveFlag(flags)), getNumericFlag(flags),
-                getUniqueFlag(flags), false, !getUniqueFlag(flags))
+                getUniqueFlag(flags), false, !getUniqueFlag(flags), getNumericDupFlag(flags))
             , _positive { getPositiveFlag(flags) }
             , _numeric { getNumericFlag(flags) }
             , _unique { getUniqueFlag(flags) }
@@ -74,6 +78,71 @@ namespace index {
             put(key, blob);
         }
 
+        template <typename K>
+        void createSorted(const K& key, const Blob& blob, bool duplicate = false)
+        {
+            append(key, blob, duplicate);
+        }
+
+        /**
+         * Full-text index raw record format in lmdb data storage:
+         * {token<string>} -> {positionId<uint32>} (sorted duplicates, one per record containing the token)
+         * Hash index raw record format in lmdb data storage:
+         * {hash<uint64>} -> {positionId<uint32>} (sorted duplicates, one per record whose value has the hash)
+         */
+        template <typename K>
+        void createPosting(const K& token, const PositionId& positionId)
+        {
+            put(token, positionId);
+        }
+
+        template <typename K>
+        void removePosting(const K& token, const PositionId& positionId)
+        {
+            del(token, positionId);
+        }
+
+        void removePosting(const std::string& token, const PositionId& positionId)
+        {
+            del(storage_engine::lmdb::Key { token }, positionId);
+        }
+
+        template <typename K>
+        std::vector<PositionId> getPostings(const K& token) const
+        {
+            auto result = std::vector<PositionId> {};
+            auto cursorHandler = cursor();
+            auto keyValue = cursorHandler.find(token);
+            if (keyValue.empty()) {
+                return result;
+            }
+            // a single duplicate is not kept in a sub-page so it cannot be fetched as multiple values
+            if (cursorHandler.count() == 1) {
+                result.emplace_back(keyValue.val.data.template numeric<PositionId>());
+                return result;
+            }
+            for (auto values = cursorHandler.getMultiple();
+                 !values.empty();
+                 values = cursorHandler.getNextMultiple()) {
+                auto offset = result.size();
+                result.resize(offset + values.val.data.size() / sizeof(PositionId));
+                memcpy(result.data() + offset, values.val.data.data(), values.val.data.size());
+            }
+            return result;
+        }
+
+        template <typename K>
+        size_t countPostings(const K& token) const
+        {
+            auto cursorHandler = cursor();
+            return (cursorHandler.find(token).empty()) ? size_t { 0 } : cursorHandler.count();
+        }
+
+        size_t countEntries() const
+        {
+            return size();
+        }
+
         void destroy()
         {
             drop(true);
@@ -113,6 +182,112 @@ namespace index {
         {
             return ((flags & INDEX_TYPE_NON_UNIQUE) == INDEX_TYPE_UNIQUE);
         }
+
+        static bool getNumericDupFlag(const unsigned int flags)
+        {
+            // posting lists of full-text and hash indexes are kept as sorted fixed-size position ids
+            return ((flags & (INDEX_TYPE_FULLTEXT | INDEX_TYPE_HASH)) != 0);
+        }
+    };
+
+    struct IndexHistogramBucket {
+        IndexHistogramBucket() = default;
+
+        IndexHistogramBucket(bool _isNegative, const std::string& _upperBound, uint64_t _count, uint64_t _distinctKeys)
+            : isNegative { _isNegative }
+            , upperBound { _upperBound }
+            , count { _count }
+            , distinctKeys { _distinctKeys }
+        {
+        }
+
+        bool isNegative { false };
+        std::string upperBound {};
+        uint64_t count { 0 };
+        uint64_t distinctKeys { 0 };
+    };
+
+    struct IndexStatistics {
+        uint64_t entryCount { 0 };
+        uint64_t distinctKeys { 0 };
+        std::vector<IndexHistogramBucket> histogram {};
+    };
+
+    class IndexStatisticsAccess : public storage_engine::adapter::LMDBKeyValAccess {
+    public:
+        IndexStatisticsAccess(const storage_engine::LMDBTxn* const txn)
+            : LMDBKeyValAccess(txn, TB_INDEX_STATISTICS, true, true, false, true)
+        {
+        }
+
+        virtual ~IndexStatisticsAccess() noexcept = default;
+
+        IndexStatisticsAccess(IndexStatisticsAccess&& other) noexcept = default;
+
+        IndexStatisticsAccess& operator=(IndexStatisticsAccess&& other) noexcept = default;
+
+        /**
+         * Index statistics raw record format in lmdb data storage:
+         * {indexId<uint32>} -> {entryCount<uint64>}{distinctKeys<uint64>}{numOfBuckets<uint32>}
+         *                      {isNegative<uint8>}{count<uint64>}{distinctKeys<uint64>}{size<uint32>}{upperBound}...
+         * where upper bounds are raw index keys in the order of the index table of the bucket.
+         */
+        void create(const IndexId& indexId, const IndexStatistics& statistics)
+        {
+            auto totalLength = 2 * sizeof(uint64_t) + sizeof(uint32_t);
+            for (const auto& bucket : statistics.histogram) {
+                totalLength += sizeof(uint8_t) + 2 * sizeof(uint64_t) + sizeof(uint32_t) + bucket.upperBound.size();
+            }
+            auto value = Blob(totalLength);
+            value.append(&statistics.entryCount, sizeof(uint64_t));
+            value.append(&statistics.distinctKeys, sizeof(uint64_t));
+            auto numOfBuckets = static_cast<uint32_t>(statistics.histogram.size());
+            value.append(&numOfBuckets, sizeof(uint32_t));
+            for (const auto& bucket : statistics.histogram) {
+                auto isNegative = (bucket.isNegative) ? uint8_t { 1 } : uint8_t { 0 };
+                value.append(&isNegative, sizeof(uint8_t));
+                value.append(&bucket.count, sizeof(uint64_t));
+                value.append(&bucket.distinctKeys, sizeof(uint64_t));
+                auto boundSize = static_cast<uint32_t>(bucket.upperBound.size());
+                value.append(&boundSize, sizeof(uint32_t));
+                value.append(bucket.upperBound.data(), boundSize);
+            }
+            put(indexId, value);
+        }
+
+        void remove(const IndexId& indexId)
+        {
+            if (!get(indexId).empty) {
+                del(indexId);
+            }
+        }
+
+        IndexStatistics getStatistics(const IndexId& indexId) const
+        {
+            auto statistics = IndexStatistics {};
+            auto result = get(indexId);
+            if (result.empty) {
+                return statistics;
+            }
+            auto blob = result.data.blob();
+            auto offset = blob.retrieve(&statistics.entryCount, 0, sizeof(uint64_t));
+            offset = blob.retrieve(&statistics.distinctKeys, offset, sizeof(uint64_t));
+            auto numOfBuckets = uint32_t {};
+            offset = blob.retrieve(&numOfBuckets, offset, sizeof(uint32_t));
+            statistics.histogram.resize(numOfBuckets);
+            for (auto& bucket : statistics.histogram) {
+                auto isNegative = uint8_t {};
+                offset = blob.retrieve(&isNegative, offset, sizeof(uint8_t));
+                bucket.isNegative = isNegative == 1;
+                offset = blob.retrieve(&bucket.count, offset, sizeof(uint64_t));
+                offset = blob.retrieve(&bucket.distinctKeys, offset, sizeof(uint64_t));
+                auto boundSize = uint32_t {};
+                offset = blob.retrieve(&boundSize, offset, sizeof(uint32_t));
+                bucket.upperBound.resize(boundSize);
+                offset = blob.retrieve(&bucket.upperBound[0], offset, boundSize);
+            }
+            return statistics;
+        }
     };
 
 }
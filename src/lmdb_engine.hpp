@@ -26,6 +26,7 @@
 
 #include "datatype.hpp"
 #include "lmdb/lmdb.h"
+#include "utils.hpp"
 
 #include "nogdb/nogdb_errors.h"
 
@@ -325,6 +326,11 @@ namespace lmdb {
             return mdb_txn_env(_handle);
         }
 
+        size_t id() const noexcept
+        {
+            return static_cast<size_t>(mdb_txn_id(_handle));
+        }
+
         void commit()
         {
             if (auto error = mdb_txn_commit(_handle)) {
@@ -360,10 +366,13 @@ namespace lmdb {
         static DBi open(TransactionHandler* const txnHandler,
             const std::string& dbName,
             bool numericKey = false,
-            bool unique = true)
+            bool unique = true,
+            bool numericDup = false)
         {
             DBHandler dbHandler = 0;
             auto flags = ((numericKey) ? MDB_INTEGERKEY : 0U) | ((!unique) ? MDB_DUPSORT : 0U);
+            // fixed-size unsigned integer duplicates are packed in pages and kept in numeric order
+            flags |= (!unique && numericDup) ? (MDB_DUPFIXED | MDB_INTEGERDUP) : 0U;
             if (auto error = mdb_open(txnHandler, dbName.c_str(), MDB_CREATE | flags, &dbHandler)) {
                 throw NOGDB_STORAGE_ERROR(error);
             } else {
@@ -578,6 +587,29 @@ namespace lmdb {
             dbPut(Key { key }, Value { val }, LMDB_PUT_FLAGS_GENERATE(append, overwrite));
         }
 
+        /**
+         * Bulk loading helpers which require keys (and duplicated values of the same key)
+         * to be written in the sorted order of the database, otherwise MDB_KEYEXIST is raised
+         */
+        template <typename K>
+        void append(const K& key,
+            const Blob& blob,
+            bool duplicate = false)
+        {
+            dbPut(Key { &key, sizeof(K) },
+                Value { blob.bytes(), blob.size() },
+                (duplicate) ? MDB_APPENDDUP : MDB_APPEND);
+        }
+
+        void append(const std::string& key,
+            const Blob& blob,
+            bool duplicate = false)
+        {
+            dbPut(Key { key },
+                Value { blob.bytes(), blob.size() },
+                (duplicate) ? MDB_APPENDDUP : MDB_APPEND);
+        }
+
         template <typename K>
         void del(const K& key)
         {
@@ -649,6 +681,7 @@ namespace lmdb {
         inline bool dbGet(const MDB_val* const key,
             MDB_val* const data) const
         {
+            utils::profiler::countRead();
             if (auto error = mdb_get(_txn, _handle, const_cast<MDB_val*>(key), data)) {
                 if (error != MDB_NOTFOUND) {
                     throw NOGDB_STORAGE_ERROR(error);
@@ -785,6 +818,25 @@ namespace lmdb {
             return get(MDB_PREV_DUP);
         }
 
+        CursorResult getMultiple() const
+        {
+            return get(MDB_GET_MULTIPLE);
+        }
+
+        CursorResult getNextMultiple() const
+        {
+            return get(MDB_NEXT_MULTIPLE);
+        }
+
+        size_t count() const
+        {
+            size_t result {};
+            if (auto error = mdb_cursor_count(_handle, &result)) {
+                throw NOGDB_STORAGE_ERROR(error);
+            }
+            return result;
+        }
+
         template <typename K>
         CursorResult find(const K& key) const
         {
@@ -804,6 +856,7 @@ namespace lmdb {
     private:
         CursorResult get(const MDB_cursor_op op) const
         {
+            utils::profiler::countRead();
             CursorResult result {};
             if (auto error = mdb_cursor_get(_handle, result.key.data, result.val.data, op)) {
                 if (error != MDB_NOTFOUND) {
@@ -818,6 +871,7 @@ namespace lmdb {
         template <typename K>
         CursorResult dbFind(const K& key, const MDB_cursor_op op) const
         {
+            utils::profiler::countRead();
             CursorResult result {};
             result.key.data = Key { &key, sizeof(K) };
             if (auto error = mdb_cursor_get(_handle, result.key.data, result.val.data, op)) {
@@ -832,6 +886,7 @@ namespace lmdb {
 
         CursorResult dbFind(const std::string& key, const MDB_cursor_op op) const
         {
+            utils::profiler::countRead();
             CursorResult result {};
             result.key.data = Key { key };
             if (auto error = mdb_cursor_get(_handle, result.key.data, result.val.data, op)) {
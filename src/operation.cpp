@@ -31,6 +31,7 @@
 #include "relation.hpp"
 #include "schema.hpp"
 #include "schema_adapter.hpp"
+#include "utils.hpp"
 
 #include "nogdb/nogdb.h"
 
@@ -113,6 +114,99 @@ const RecordDescriptor Transaction::addEdge(const std::string& className,
     }
 }
 
+const std::vector<RecordDescriptor> Transaction::addVertices(const std::string& className,
+    const std::vector<Record>& records)
+{
+    BEGIN_VALIDATION(this)
+        .isTxnValid()
+        .isTxnCompleted()
+        .isClassNameValid(className);
+
+    auto vertexClassInfo = SchemaUtils::getValidClassInfo(this, className, ClassType::VERTEX);
+    auto propertyNameMapInfo = SchemaUtils::getPropertyNameMapInfo(
+        this, vertexClassInfo.id, vertexClassInfo.superClassId);
+    // every record is parsed before the first one is written
+    auto recordBlobs = std::vector<Blob> {};
+    recordBlobs.reserve(records.size());
+    for (const auto& record : records) {
+        recordBlobs.emplace_back(RecordParser::parseRecord(record, propertyNameMapInfo));
+    }
+    try {
+        auto vertexDataRecord = DataRecord(_txnBase, vertexClassInfo.id, ClassType::VERTEX);
+        auto recordDescriptors = std::vector<RecordDescriptor> {};
+        recordDescriptors.reserve(records.size());
+        for (const auto& recordBlob : recordBlobs) {
+            auto positionId = PositionId { 0 };
+            if (_txnCtx->isVersionEnabled()) {
+                auto newRecordBlob = RecordParser::parseVertexRecordWithVersion(recordBlob, VersionId { 1 });
+                positionId = vertexDataRecord.insert(newRecordBlob);
+                _updatedRecords.insert(RecordId { vertexClassInfo.id, positionId });
+            } else {
+                positionId = vertexDataRecord.insert(recordBlob);
+            }
+            recordDescriptors.push_back(RecordDescriptor { vertexClassInfo.id, positionId });
+        }
+        auto indexInfos = IndexUtils::getIndexInfos(this, vertexClassInfo.id, propertyNameMapInfo);
+        IndexUtils::insert(this, recordDescriptors, records, indexInfos);
+        return recordDescriptors;
+    } catch (const Error& error) {
+        rollback();
+        throw NOGDB_FATAL_ERROR(error);
+    }
+}
+
+const std::vector<RecordDescriptor> Transaction::addEdges(const std::string& className,
+    const std::vector<std::pair<RecordDescriptor, RecordDescriptor>>& srcDstVertexRecordDescriptors,
+    const Record& record)
+{
+    auto validators = BEGIN_VALIDATION(this)
+                          .isTxnValid()
+                          .isTxnCompleted()
+                          .isClassNameValid(className);
+
+    // a vertex joined to many others is looked up only once
+    auto srcVertices = std::set<RecordDescriptor> {};
+    auto dstVertices = std::set<RecordDescriptor> {};
+    for (const auto& srcDstVertex : srcDstVertexRecordDescriptors) {
+        if (srcVertices.insert(srcDstVertex.first).second) {
+            validators.isExistingSrcVertex(srcDstVertex.first);
+        }
+        if (dstVertices.insert(srcDstVertex.second).second) {
+            validators.isExistingDstVertex(srcDstVertex.second);
+        }
+    }
+
+    auto edgeClassInfo = SchemaUtils::getValidClassInfo(this, className, ClassType::EDGE);
+    auto propertyNameMapInfo = SchemaUtils::getPropertyNameMapInfo(
+        this, edgeClassInfo.id, edgeClassInfo.superClassId);
+    auto recordBlob = RecordParser::parseRecord(record, propertyNameMapInfo);
+    try {
+        auto edgeDataRecord = DataRecord(_txnBase, edgeClassInfo.id, ClassType::EDGE);
+        auto recordDescriptors = std::vector<RecordDescriptor> {};
+        recordDescriptors.reserve(srcDstVertexRecordDescriptors.size());
+        for (const auto& srcDstVertex : srcDstVertexRecordDescriptors) {
+            auto vertexBlob = RecordParser::parseEdgeVertexSrcDst(srcDstVertex.first.rid, srcDstVertex.second.rid);
+            auto positionId = PositionId { 0 };
+            if (_txnCtx->isVersionEnabled()) {
+                auto newRecordBlob = RecordParser::parseEdgeRecordWithVersion(vertexBlob, recordBlob, VersionId { 1 });
+                positionId = edgeDataRecord.insert(newRecordBlob);
+                _updatedRecords.insert(RecordId { edgeClassInfo.id, positionId });
+            } else {
+                positionId = edgeDataRecord.insert(vertexBlob + recordBlob);
+            }
+            auto recordDescriptor = RecordDescriptor { edgeClassInfo.id, positionId };
+            _graph->addRel(recordDescriptor.rid, srcDstVertex.first.rid, srcDstVertex.second.rid);
+            recordDescriptors.push_back(recordDescriptor);
+        }
+        auto indexInfos = IndexUtils::getIndexInfos(this, edgeClassInfo.id, propertyNameMapInfo);
+        IndexUtils::insert(this, recordDescriptors, std::vector<Record>(recordDescriptors.size(), record), indexInfos);
+        return recordDescriptors;
+    } catch (const Error& error) {
+        rollback();
+        throw NOGDB_FATAL_ERROR(error);
+    }
+}
+
 void Transaction::update(const RecordDescriptor& recordDescriptor, const Record& record)
 {
     BEGIN_VALIDATION(this)
@@ -164,6 +258,97 @@ void Transaction::update(const RecordDescriptor& recordDescriptor, const Record&
     }
 }
 
+void Transaction::updateProperties(const std::vector<RecordDescriptor>& recordDescriptors, const Record& properties)
+{
+    BEGIN_VALIDATION(this)
+        .isTxnValid()
+        .isTxnCompleted();
+
+    // records are written class by class in the order of their positions
+    auto classRecords = std::map<ClassId, std::set<PositionId>> {};
+    for (const auto& recordDescriptor : recordDescriptors) {
+        classRecords[recordDescriptor.rid.first].insert(recordDescriptor.rid.second);
+    }
+
+    // every record is looked up and parsed before the first one is written
+    struct ClassBatch {
+        ClassAccessInfo classInfo;
+        PropertyNameMapIndex indexInfos;
+        std::vector<RecordDescriptor> recordDescriptors;
+        std::vector<Record> existingRecords;
+        std::vector<Record> updatedRecords;
+        std::vector<Blob> updatedRecordBlobs;
+    };
+    auto batches = std::vector<ClassBatch> {};
+    for (const auto& classRecord : classRecords) {
+        auto classInfo = SchemaUtils::getExistingClass(this, classRecord.first);
+        auto isEdge = classInfo.type == ClassType::EDGE;
+        auto propertyNameMapInfo = SchemaUtils::getPropertyNameMapInfo(this, classInfo.id, classInfo.superClassId);
+        auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(this, classInfo.id, classInfo.superClassId);
+        auto dataRecord = DataRecord(_txnBase, classInfo.id, classInfo.type);
+        // only the indexes of the given properties can change
+        auto indexInfos = IndexUtils::getIndexInfos(this, classInfo.id, propertyNameMapInfo);
+        for (auto it = indexInfos.begin(); it != indexInfos.end();) {
+            it = properties.getAll().count(it->first) ? std::next(it) : indexInfos.erase(it);
+        }
+        auto batch = ClassBatch { classInfo, std::move(indexInfos), {}, {}, {}, {} };
+        for (const auto& positionId : classRecord.second) {
+            auto existingRecord = RecordParser::parseRawData(
+                dataRecord.getResult(positionId), propertyIdMapInfo, isEdge, _txnCtx->isVersionEnabled());
+            auto record = existingRecord;
+            for (const auto& property : properties.getAll()) {
+                record.set(property.first, property.second);
+            }
+            batch.updatedRecordBlobs.push_back(RecordParser::parseRecord(record, propertyNameMapInfo));
+            batch.recordDescriptors.push_back(RecordDescriptor { classInfo.id, positionId });
+            batch.existingRecords.push_back(std::move(existingRecord));
+            batch.updatedRecords.push_back(std::move(record));
+        }
+        batches.push_back(std::move(batch));
+    }
+
+    try {
+        for (const auto& batch : batches) {
+            auto isEdge = batch.classInfo.type == ClassType::EDGE;
+            auto dataRecord = DataRecord(_txnBase, batch.classInfo.id, batch.classInfo.type);
+            for (size_t i = 0; i < batch.recordDescriptors.size(); ++i) {
+                auto& recordId = batch.recordDescriptors[i].rid;
+                auto& newRecordBlob = batch.updatedRecordBlobs[i];
+                // the raw data is read again as it does not outlive the writes before it
+                auto recordResult = dataRecord.getResult(recordId.second);
+
+                // insert an updated record
+                auto updateRecordBlob = Blob {};
+                if (_txnCtx->isVersionEnabled()) {
+                    if (_updatedRecords.find(recordId) == _updatedRecords.cend()) {
+                        auto versionId = RecordParser::parseRawDataVersionId(recordResult);
+                        if (isEdge) {
+                            auto vertexBlob = RecordParser::parseEdgeRawDataVertexSrcDstAsBlob(
+                                recordResult, _txnCtx->isVersionEnabled());
+                            updateRecordBlob = RecordParser::parseEdgeRecordWithVersion(
+                                vertexBlob, newRecordBlob, versionId + 1);
+                        } else {
+                            updateRecordBlob = RecordParser::parseVertexRecordWithVersion(newRecordBlob, versionId + 1);
+                        }
+                        _updatedRecords.insert(recordId);
+                    } else {
+                        updateRecordBlob = RecordParser::parseOnlyUpdateRecord(recordResult, newRecordBlob, isEdge, true);
+                    }
+                } else {
+                    updateRecordBlob = RecordParser::parseOnlyUpdateRecord(recordResult, newRecordBlob, isEdge, false);
+                }
+                dataRecord.update(recordId.second, updateRecordBlob);
+            }
+
+            IndexUtils::remove(this, batch.recordDescriptors, batch.existingRecords, batch.indexInfos);
+            IndexUtils::insert(this, batch.recordDescriptors, batch.updatedRecords, batch.indexInfos);
+        }
+    } catch (const Error& error) {
+        rollback();
+        throw NOGDB_FATAL_ERROR(error);
+    }
+}
+
 void Transaction::updateSrc(const RecordDescriptor& recordDescriptor,
     const RecordDescriptor& newSrcVertexRecordDescriptor)
 {
@@ -185,24 +370,9 @@ void Transaction::updateSrc(const RecordDescriptor& recordDescriptor,
             recordResult, newSrcVertexRecordDescriptor.rid, _txnCtx->isVersionEnabled());
         if (_txnCtx->isVersionEnabled()) {
             // update version of old src vertex
-            if (_updatedRecords.find(srcDstVertex.first) == _updatedRecords.cend()) {
-                auto oldSrcVertexDataRecord = DataRecord(_txnBase, srcDstVertex.first.first, ClassType::VERTEX);
-                auto oldSrcVertexRecordResult = oldSrcVertexDataRecord.getResult(srcDstVertex.first.second);
-                auto versionId = RecordParser::parseRawDataVersionId(oldSrcVertexRecordResult);
-                auto updateRecordBlob = RecordParser::parseOnlyUpdateVersion(oldSrcVertexRecordResult, versionId + 1);
-                oldSrcVertexDataRecord.update(srcDstVertex.first.second, updateRecordBlob);
-                _updatedRecords.insert(srcDstVertex.first);
-            }
+            updateVersion(srcDstVertex.first);
             // update version of new src vertex
-            if (_updatedRecords.find(newSrcVertexRecordDescriptor.rid) == _updatedRecords.cend()) {
-                auto newSrcVertexDataRecord = DataRecord(
-                    _txnBase, newSrcVertexRecordDescriptor.rid.first, ClassType::VERTEX);
-                auto newSrcVertexRecordResult = newSrcVertexDataRecord.getResult(newSrcVertexRecordDescriptor.rid.second);
-                auto versionId = RecordParser::parseRawDataVersionId(newSrcVertexRecordResult);
-                auto updateRecordBlob = RecordParser::parseOnlyUpdateVersion(newSrcVertexRecordResult, versionId + 1);
-                newSrcVertexDataRecord.update(newSrcVertexRecordDescriptor.rid.second, updateRecordBlob);
-                _updatedRecords.insert(newSrcVertexRecordDescriptor.rid);
-            }
+            updateVersion(newSrcVertexRecordDescriptor.rid);
             // update version of edge
             if (_updatedRecords.find(recordDescriptor.rid) == _updatedRecords.cend()) {
                 auto edgeVersionId = RecordParser::parseRawDataVersionId(recordResult);
@@ -238,24 +408,9 @@ void Transaction::updateDst(const RecordDescriptor& recordDescriptor,
             recordResult, newDstVertexRecordDescriptor.rid, _txnCtx->isVersionEnabled());
         if (_txnCtx->isVersionEnabled()) {
             // update version of old dst vertex
-            if (_updatedRecords.find(srcDstVertex.second) == _updatedRecords.cend()) {
-                auto oldDstVertexDataRecord = DataRecord(_txnBase, srcDstVertex.second.first, ClassType::VERTEX);
-                auto oldDstVertexRecordResult = oldDstVertexDataRecord.getResult(srcDstVertex.second.second);
-                auto versionId = RecordParser::parseRawDataVersionId(oldDstVertexRecordResult);
-                auto updateRecordBlob = RecordParser::parseOnlyUpdateVersion(oldDstVertexRecordResult, versionId + 1);
-                oldDstVertexDataRecord.update(srcDstVertex.second.second, updateRecordBlob);
-                _updatedRecords.insert(srcDstVertex.second);
-            }
+            updateVersion(srcDstVertex.second);
             // update version of new dst vertex
-            if (_updatedRecords.find(newDstVertexRecordDescriptor.rid) == _updatedRecords.cend()) {
-                auto newDstVertexDataRecord = DataRecord(
-                    _txnBase, newDstVertexRecordDescriptor.rid.first, ClassType::VERTEX);
-                auto newDstVertexRecordResult = newDstVertexDataRecord.getResult(newDstVertexRecordDescriptor.rid.second);
-                auto versionId = RecordParser::parseRawDataVersionId(newDstVertexRecordResult);
-                auto updateRecordBlob = RecordParser::parseOnlyUpdateVersion(newDstVertexRecordResult, versionId + 1);
-                newDstVertexDataRecord.update(newDstVertexRecordDescriptor.rid.second, updateRecordBlob);
-                _updatedRecords.insert(newDstVertexRecordDescriptor.rid);
-            }
+            updateVersion(newDstVertexRecordDescriptor.rid);
             // update version of edge
             if (_updatedRecords.find(recordDescriptor.rid) == _updatedRecords.cend()) {
                 auto edgeVersionId = RecordParser::parseRawDataVersionId(recordResult);
@@ -291,38 +446,15 @@ void Transaction::remove(const RecordDescriptor& recordDescriptor)
             _graph->removeRelFromEdge(recordDescriptor.rid, srcDstVertex.first, srcDstVertex.second);
             if (_txnCtx->isVersionEnabled()) {
                 // update version of src vertex
-                if (_updatedRecords.find(srcDstVertex.first) == _updatedRecords.cend()) {
-                    auto srcVertexDataRecord = DataRecord(
-                        _txnBase, srcDstVertex.first.first, ClassType::VERTEX);
-                    auto srcVertexRecordResult = srcVertexDataRecord.getResult(srcDstVertex.first.second);
-                    auto versionId = RecordParser::parseRawDataVersionId(srcVertexRecordResult);
-                    auto updateRecordBlob = RecordParser::parseOnlyUpdateVersion(srcVertexRecordResult, versionId + 1);
-                    srcVertexDataRecord.update(srcDstVertex.first.second, updateRecordBlob);
-                    _updatedRecords.insert(srcDstVertex.first);
-                }
+                updateVersion(srcDstVertex.first);
                 // update version of dst vertex
-                if (_updatedRecords.find(srcDstVertex.second) == _updatedRecords.cend()) {
-                    auto dstVertexDataRecord = DataRecord(
-                        _txnBase, srcDstVertex.second.first, ClassType::VERTEX);
-                    auto dstVertexRecordResult = dstVertexDataRecord.getResult(srcDstVertex.second.second);
-                    auto versionId = RecordParser::parseRawDataVersionId(dstVertexRecordResult);
-                    auto updateRecordBlob = RecordParser::parseOnlyUpdateVersion(dstVertexRecordResult, versionId + 1);
-                    dstVertexDataRecord.update(srcDstVertex.second.second, updateRecordBlob);
-                    _updatedRecords.insert(srcDstVertex.second);
-                }
+                updateVersion(srcDstVertex.second);
             }
         } else {
             auto neighbours = _graph->removeRelFromVertex(recordDescriptor.rid);
             if (_txnCtx->isVersionEnabled()) {
                 for (const auto& neighbour : neighbours) {
-                    if (_updatedRecords.find(neighbour) == _updatedRecords.cend()) {
-                        auto neighbourDataRecord = DataRecord(_txnBase, neighbour.first, ClassType::VERTEX);
-                        auto neighbourRecordResult = neighbourDataRecord.getResult(neighbour.second);
-                        auto versionId = RecordParser::parseRawDataVersionId(neighbourRecordResult);
-                        auto updateRecordBlob = RecordParser::parseOnlyUpdateVersion(neighbourRecordResult, versionId + 1);
-                        neighbourDataRecord.update(neighbour.second, updateRecordBlob);
-                        _updatedRecords.insert(neighbour);
-                    }
+                    updateVersion(neighbour);
                 }
             }
         }
@@ -337,6 +469,89 @@ void Transaction::remove(const RecordDescriptor& recordDescriptor)
     }
 }
 
+void Transaction::remove(const std::vector<RecordDescriptor>& recordDescriptors)
+{
+    BEGIN_VALIDATION(this)
+        .isTxnValid()
+        .isTxnCompleted();
+
+    // edges go before vertices so that the edges of a removed vertex have not already gone with it
+    auto classRecords = std::map<ClassId, std::set<PositionId>> {};
+    for (const auto& recordDescriptor : recordDescriptors) {
+        classRecords[recordDescriptor.rid.first].insert(recordDescriptor.rid.second);
+    }
+    auto classInfos = std::vector<ClassAccessInfo> {};
+    for (const auto& classRecord : classRecords) {
+        classInfos.push_back(SchemaUtils::getExistingClass(this, classRecord.first));
+    }
+    std::stable_partition(classInfos.begin(), classInfos.end(), [](const ClassAccessInfo& classInfo) {
+        return classInfo.type == ClassType::EDGE;
+    });
+
+    // every record is looked up before the first one is removed, as a missing record is not a failure of the storage
+    struct ClassBatch {
+        ClassAccessInfo classInfo;
+        PropertyNameMapInfo propertyNameMapInfo;
+        std::vector<RecordDescriptor> recordDescriptors;
+        std::vector<Record> records;
+        std::vector<std::pair<RecordId, RecordId>> srcDstVertices;
+    };
+    auto batches = std::vector<ClassBatch> {};
+    for (const auto& classInfo : classInfos) {
+        auto isEdge = classInfo.type == ClassType::EDGE;
+        auto dataRecord = DataRecord(_txnBase, classInfo.id, classInfo.type);
+        auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(this, classInfo.id, classInfo.superClassId);
+        auto batch = ClassBatch {
+            classInfo,
+            SchemaUtils::getPropertyNameMapInfo(this, classInfo.id, classInfo.superClassId),
+            {}, {}, {}
+        };
+        for (const auto& positionId : classRecords[classInfo.id]) {
+            auto recordResult = dataRecord.getResult(positionId);
+            batch.recordDescriptors.push_back(RecordDescriptor { classInfo.id, positionId });
+            batch.records.push_back(RecordParser::parseRawData(
+                recordResult, propertyIdMapInfo, isEdge, _txnCtx->isVersionEnabled()));
+            if (isEdge) {
+                batch.srcDstVertices.push_back(RecordParser::parseEdgeRawDataVertexSrcDst(
+                    recordResult, _txnCtx->isVersionEnabled()));
+            }
+        }
+        batches.push_back(std::move(batch));
+    }
+
+    try {
+        for (const auto& batch : batches) {
+            auto dataRecord = DataRecord(_txnBase, batch.classInfo.id, batch.classInfo.type);
+            for (size_t i = 0; i < batch.recordDescriptors.size(); ++i) {
+                auto& recordId = batch.recordDescriptors[i].rid;
+                if (batch.classInfo.type == ClassType::EDGE) {
+                    auto& srcDstVertex = batch.srcDstVertices[i];
+                    _graph->removeRelFromEdge(recordId, srcDstVertex.first, srcDstVertex.second);
+                    if (_txnCtx->isVersionEnabled()) {
+                        updateVersion(srcDstVertex.first);
+                        updateVersion(srcDstVertex.second);
+                    }
+                } else {
+                    auto neighbours = _graph->removeRelFromVertex(recordId);
+                    if (_txnCtx->isVersionEnabled()) {
+                        for (const auto& neighbour : neighbours) {
+                            updateVersion(neighbour);
+                        }
+                    }
+                }
+                dataRecord.remove(recordId.second);
+            }
+
+            // remove index if applied in the records
+            auto indexInfos = IndexUtils::getIndexInfos(this, batch.classInfo.id, batch.propertyNameMapInfo);
+            IndexUtils::remove(this, batch.recordDescriptors, batch.records, indexInfos);
+        }
+    } catch (const Error& error) {
+        rollback();
+        throw NOGDB_FATAL_ERROR(error);
+    }
+}
+
 void Transaction::removeAll(const std::string& className)
 {
     BEGIN_VALIDATION(this)
@@ -358,42 +573,15 @@ void Transaction::removeAll(const std::string& className)
                     _graph->removeRelFromEdge(recordId, srcDstVertex.first, srcDstVertex.second);
                     if (_txnCtx->isVersionEnabled()) {
                         // update version of src vertex
-                        if (_updatedRecords.find(srcDstVertex.first) == _updatedRecords.cend()) {
-                            auto srcVertexDataRecord = DataRecord(
-                                _txnBase, srcDstVertex.first.first, ClassType::VERTEX);
-                            auto srcVertexRecordResult = srcVertexDataRecord.getResult(srcDstVertex.first.second);
-                            auto versionId = RecordParser::parseRawDataVersionId(srcVertexRecordResult);
-                            auto updateRecordBlob = RecordParser::parseOnlyUpdateVersion(
-                                srcVertexRecordResult, versionId + 1);
-                            srcVertexDataRecord.update(srcDstVertex.first.second, updateRecordBlob);
-                            _updatedRecords.insert(srcDstVertex.first);
-                        }
+                        updateVersion(srcDstVertex.first);
                         // update version of dst vertex
-                        if (_updatedRecords.find(srcDstVertex.second) == _updatedRecords.cend()) {
-                            auto dstVertexDataRecord = DataRecord(
-                                _txnBase, srcDstVertex.second.first, ClassType::VERTEX);
-                            auto dstVertexRecordResult = dstVertexDataRecord.getResult(srcDstVertex.second.second);
-                            auto versionId = RecordParser::parseRawDataVersionId(dstVertexRecordResult);
-                            auto updateRecordBlob = RecordParser::parseOnlyUpdateVersion(
-                                dstVertexRecordResult, versionId + 1);
-                            dstVertexDataRecord.update(srcDstVertex.second.second, updateRecordBlob);
-                            _updatedRecords.insert(srcDstVertex.second);
-                        }
+                        updateVersion(srcDstVertex.second);
                     }
                 } else {
                     auto neighbours = _graph->removeRelFromVertex(recordId);
                     if (_txnCtx->isVersionEnabled()) {
                         for (const auto& neighbour : neighbours) {
-                            if (_updatedRecords.find(neighbour) == _updatedRecords.cend()) {
-                                auto neighbourDataRecord = DataRecord(
-                                    _txnBase, neighbour.first, ClassType::VERTEX);
-                                auto neighbourRecordResult = neighbourDataRecord.getResult(neighbour.second);
-                                auto versionId = RecordParser::parseRawDataVersionId(neighbourRecordResult);
-                                auto updateRecordBlob = RecordParser::parseOnlyUpdateVersion(
-                                    neighbourRecordResult, versionId + 1);
-                                neighbourDataRecord.update(neighbour.second, updateRecordBlob);
-                                _updatedRecords.insert(neighbour);
-                            }
+                            updateVersion(neighbour);
                         }
                     }
                 }
@@ -409,6 +597,18 @@ void Transaction::removeAll(const std::string& className)
     }
 }
 
+void Transaction::updateVersion(const RecordId& recordId)
+{
+    if (_updatedRecords.find(recordId) == _updatedRecords.cend()) {
+        auto vertexDataRecord = DataRecord(_txnBase, recordId.first, ClassType::VERTEX);
+        auto vertexRecordResult = vertexDataRecord.getResult(recordId.second);
+        auto versionId = RecordParser::parseRawDataVersionId(vertexRecordResult);
+        auto updateRecordBlob = RecordParser::parseOnlyUpdateVersion(vertexRecordResult, versionId + 1);
+        vertexDataRecord.update(recordId.second, updateRecordBlob);
+        _updatedRecords.insert(recordId);
+    }
+}
+
 Result Transaction::fetchSrc(const RecordDescriptor& recordDescriptor) const
 {
     BEGIN_VALIDATION(this)
@@ -696,6 +896,69 @@ unsigned long FindOperationBuilder::count() const
     }
 }
 
+std::vector<QueryPlan> FindOperationBuilder::explain() const
+{
+    BEGIN_VALIDATION(_txn)
+        .isTxnCompleted()
+        .isClassNameValid(_className);
+
+    auto classInfo = SchemaUtils::getExistingClass(_txn, _className);
+    auto classInfos = std::vector<ClassAccessInfo> { classInfo };
+    if (_includeSubClassOf) {
+        for (const auto& classNameMapInfo : SchemaUtils::getSubClassInfos(_txn, classInfo.id)) {
+            classInfos.emplace_back(classNameMapInfo.second);
+        }
+    }
+    auto result = std::vector<QueryPlan> {};
+    for (const auto& currentClassInfo : classInfos) {
+        auto propertyNameMapInfo =
+            SchemaUtils::getPropertyNameMapInfo(_txn, currentClassInfo.id, currentClassInfo.superClassId);
+        switch (_conditionType) {
+        case ConditionType::CONDITION:
+            result.emplace_back(RecordCompare::explainCondition(
+                *_txn, currentClassInfo, propertyNameMapInfo, *_condition, _indexed));
+            break;
+        case ConditionType::MULTI_CONDITION:
+            result.emplace_back(RecordCompare::explainMultiCondition(
+                *_txn, currentClassInfo, propertyNameMapInfo, *_multiCondition, _indexed));
+            break;
+        default: {
+            // a compare function can only be evaluated on every record of the class
+            auto numOfRecords =
+                static_cast<double>(DataRecord(_txn->_txnBase, currentClassInfo.id, currentClassInfo.type).count());
+            auto queryPlan = QueryPlan {};
+            queryPlan.className = currentClassInfo.name;
+            queryPlan.strategy = QueryPlan::Strategy::FULL_SCAN;
+            queryPlan.estimatedRecords = (_conditionType == ConditionType::COMPARE_FUNCTION)
+                ? numOfRecords * DEFAULT_RANGE_SELECTIVITY
+                : numOfRecords;
+            queryPlan.estimatedCost = numOfRecords * COST_SCAN_RECORD;
+            result.emplace_back(queryPlan);
+            break;
+        }
+        }
+    }
+    return result;
+}
+
+QueryPlanNode FindOperationBuilder::profile() const
+{
+    auto result = QueryPlanNode {};
+    result.operation = "FIND";
+    result.plans = explain();
+    auto stopwatch = utils::profiler::Stopwatch {};
+    {
+        utils::profiler::StopwatchScope running { stopwatch };
+        auto cursor = getCursor();
+        while (cursor.next()) {
+            ++result.rows;
+        }
+    }
+    result.reads = stopwatch.reads;
+    result.elapsedTime = stopwatch.elapsed;
+    return result;
+}
+
 ResultSet FindEdgeOperationBuilder::get() const
 {
     BEGIN_VALIDATION(_txn)
@@ -778,39 +1041,47 @@ unsigned long FindEdgeOperationBuilder::count() const
         .isTxnCompleted()
         .isExistingVertex(_rdesc);
 
-    auto edgeRecordIds = std::vector<RecordId> {};
-    switch (_direction) {
-    case EdgeDirection::IN: {
-        edgeRecordIds = _txn->_graph->getInEdges(_rdesc.rid);
-        break;
-    }
-    case EdgeDirection::OUT: {
-        edgeRecordIds = _txn->_graph->getOutEdges(_rdesc.rid);
-        break;
-    }
-    default: {
-        auto recordIds = std::set<RecordId> {};
-        auto inEdgeRecordIds = _txn->_graph->getInEdges(_rdesc.rid);
-        auto outEdgeRecordIds = _txn->_graph->getOutEdges(_rdesc.rid);
-        recordIds.insert(inEdgeRecordIds.cbegin(), inEdgeRecordIds.cend());
-        recordIds.insert(outEdgeRecordIds.cbegin(), outEdgeRecordIds.cend());
-        edgeRecordIds.assign(recordIds.cbegin(), recordIds.cend());
-        break;
-    }
+    auto classFilter = RecordCompare::getFilterClasses(*_txn, _filter);
+    if (RecordCompare::isEveryRecordAccepted(classFilter)) {
+        // a degree is the number of relation entries of the vertex, which needs no edge to be read
+        switch (_direction) {
+        case EdgeDirection::IN:
+            return static_cast<unsigned long>(_txn->_graph->countInEdges(_rdesc.rid));
+        case EdgeDirection::OUT:
+            return static_cast<unsigned long>(_txn->_graph->countOutEdges(_rdesc.rid));
+        default:
+            // an edge from the vertex to itself is both an in-edge and an out-edge
+            return static_cast<unsigned long>(_txn->_graph->countInEdges(_rdesc.rid)
+                + _txn->_graph->countOutEdges(_rdesc.rid) - _txn->_graph->countLoopEdges(_rdesc.rid));
+        }
     }
+
     auto result = 0UL;
-    auto classFilter = RecordCompare::getFilterClasses(*_txn, _filter);
-    for (const auto& recordId : edgeRecordIds) {
-        auto edgeRecordDescriptor = RecordDescriptor { recordId };
-        auto filterRecord = RecordCompare::filterRecord(*_txn, edgeRecordDescriptor, _filter, classFilter);
-        if (filterRecord != RecordDescriptor {}) {
+    auto countEdge = [&](const RecordId& recordId) {
+        if (RecordCompare::filterRecord(*_txn, RecordDescriptor { recordId }, _filter, classFilter)
+            != RecordDescriptor {}) {
             ++result;
         }
+    };
+    if (_direction != EdgeDirection::OUT) {
+        for (const auto& recordId : _txn->_graph->getInEdges(_rdesc.rid)) {
+            countEdge(recordId);
+        }
+    }
+    if (_direction != EdgeDirection::IN) {
+        for (const auto& edgeNeighbour : _txn->_graph->getOutEdgeAndNeighbours(_rdesc.rid)) {
+            // loop edges have already been counted among the in-edges
+            if (_direction == EdgeDirection::OUT || edgeNeighbour.second != _rdesc.rid) {
+                countEdge(edgeNeighbour.first);
+            }
+        }
     }
     return result;
 }
 
-ResultSet TraverseOperationBuilder::get() const
+template <typename T>
+T TraverseOperationBuilder::traverse(
+    const std::function<T(const adapter::relation::Direction&, bool)>& traversal) const
 {
     BEGIN_VALIDATION(_txn)
         .isTxnCompleted()
@@ -827,37 +1098,92 @@ ResultSet TraverseOperationBuilder::get() const
     default:
         break;
     }
+    return traversal(direction, _strategy == TraversalStrategy::DEPTH_FIRST);
+}
 
-    return algorithm::GraphTraversal::breadthFirstSearch(
-        *_txn, _rdescs, _minDepth, _maxDepth, direction, _edgeFilter, _vertexFilter);
+ResultSet TraverseOperationBuilder::get() const
+{
+    return traverse<ResultSet>([this](const adapter::relation::Direction& direction, bool isDepthFirst) {
+        return (isDepthFirst)
+            ? algorithm::GraphTraversal::depthFirstSearch(
+                  *_txn, _rdescs, _minDepth, _maxDepth, direction, _edgeFilter, _vertexFilter)
+            : algorithm::GraphTraversal::breadthFirstSearch(
+                  *_txn, _rdescs, _minDepth, _maxDepth, direction, _edgeFilter, _vertexFilter);
+    });
 }
 
 ResultSetCursor TraverseOperationBuilder::getCursor() const
+{
+    return traverse<ResultSetCursor>([this](const adapter::relation::Direction& direction, bool isDepthFirst) {
+        auto result = (isDepthFirst)
+            ? algorithm::GraphTraversal::depthFirstSearchRdesc(
+                  *_txn, _rdescs, _minDepth, _maxDepth, direction, _edgeFilter, _vertexFilter)
+            : algorithm::GraphTraversal::breadthFirstSearchRdesc(
+                  *_txn, _rdescs, _minDepth, _maxDepth, direction, _edgeFilter, _vertexFilter);
+        return std::move(ResultSetCursor { *_txn }.addMetadata(result));
+    });
+}
+
+TraverseCursor TraverseOperationBuilder::getStream() const
+{
+    return traverse<TraverseCursor>([this](const adapter::relation::Direction& direction, bool isDepthFirst) {
+        auto state = std::unique_ptr<algorithm::TraversalState>(new algorithm::TraversalState(
+            *_txn, _rdescs, _minDepth, _maxDepth, direction, isDepthFirst, _edgeFilter, _vertexFilter));
+        return TraverseCursor { *_txn, std::move(state) };
+    });
+}
+
+QueryPlanNode TraverseOperationBuilder::explain() const
 {
     BEGIN_VALIDATION(_txn)
         .isTxnCompleted()
         .isExistingVertices(_rdescs);
 
-    auto direction = adapter::relation::Direction::ALL;
-    switch (_direction) {
-    case EdgeDirection::IN:
-        direction = adapter::relation::Direction::IN;
-        break;
-    case EdgeDirection::OUT:
-        direction = adapter::relation::Direction::OUT;
-        break;
-    default:
-        break;
+    auto result = QueryPlanNode {};
+    result.operation = "TRAVERSE";
+    return result;
+}
+
+QueryPlanNode TraverseOperationBuilder::profile() const
+{
+    auto result = explain();
+    auto stopwatch = utils::profiler::Stopwatch {};
+    {
+        utils::profiler::StopwatchScope running { stopwatch };
+        auto cursor = getStream();
+        while (cursor.next()) {
+            ++result.rows;
+        }
     }
+    result.reads = stopwatch.reads;
+    result.elapsedTime = stopwatch.elapsed;
+    return result;
+}
 
-    auto result = algorithm::GraphTraversal::breadthFirstSearchRdesc(
-        *_txn, _rdescs, _minDepth, _maxDepth, direction, _edgeFilter, _vertexFilter);
-    return std::move(ResultSetCursor { *_txn }.addMetadata(result));
+TraversalPaths TraverseOperationBuilder::getPaths() const
+{
+    return traverse<TraversalPaths>([this](const adapter::relation::Direction& direction, bool isDepthFirst) {
+        auto state = algorithm::TraversalState { *_txn, _rdescs, _minDepth, _maxDepth, direction, isDepthFirst,
+            _edgeFilter, _vertexFilter };
+        auto paths = TraversalPaths {};
+        auto node = algorithm::TraversalNode {};
+        while (state.nextNode(node)) {
+            paths.nodes.emplace_back(TraversalPaths::Node { node.vertex, node.edge, node.parent, node.depth });
+        }
+        return paths;
+    });
 }
 
 unsigned long TraverseOperationBuilder::count() const
 {
-    return static_cast<unsigned long>(getCursor().count());
+    // vertices are counted as they are found, without keeping a descriptor for any of them
+    return traverse<unsigned long>([this](const adapter::relation::Direction& direction, bool isDepthFirst) {
+        return (isDepthFirst)
+            ? algorithm::GraphTraversal::depthFirstSearchCount(
+                  *_txn, _rdescs, _minDepth, _maxDepth, direction, _edgeFilter, _vertexFilter)
+            : algorithm::GraphTraversal::breadthFirstSearchCount(
+                  *_txn, _rdescs, _minDepth, _maxDepth, direction, _edgeFilter, _vertexFilter);
+    });
 }
 
 ResultSet ShortestPathOperationBuilder::get() const
@@ -867,8 +1193,13 @@ ResultSet ShortestPathOperationBuilder::get() const
         .isExistingSrcVertex(_srcRdesc)
         .isExistingDstVertex(_dstRdesc);
 
+    if (!_weightPropName.empty()) {
+        BEGIN_VALIDATION(_txn).isPropertyNameValid(_weightPropName);
+        return algorithm::GraphTraversal::dijkstraShortestPath(*_txn, _srcRdesc, _dstRdesc,
+            _minDepth, _maxDepth, _weightPropName, _heuristic, _edgeFilter, _vertexFilter);
+    }
     return algorithm::GraphTraversal::bfsShortestPath(
-        *_txn, _srcRdesc, _dstRdesc, _edgeFilter, _vertexFilter);
+        *_txn, _srcRdesc, _dstRdesc, _minDepth, _maxDepth, _edgeFilter, _vertexFilter);
 }
 
 ResultSetCursor ShortestPathOperationBuilder::getCursor() const
@@ -878,8 +1209,14 @@ ResultSetCursor ShortestPathOperationBuilder::getCursor() const
         .isExistingSrcVertex(_srcRdesc)
         .isExistingDstVertex(_dstRdesc);
 
+    if (!_weightPropName.empty()) {
+        BEGIN_VALIDATION(_txn).isPropertyNameValid(_weightPropName);
+        auto result = algorithm::GraphTraversal::dijkstraShortestPathRdesc(*_txn, _srcRdesc, _dstRdesc,
+            _minDepth, _maxDepth, _weightPropName, _heuristic, _edgeFilter, _vertexFilter);
+        return std::move(ResultSetCursor { *_txn }.addMetadata(result));
+    }
     auto result = algorithm::GraphTraversal::bfsShortestPathRdesc(
-        *_txn, _srcRdesc, _dstRdesc, _edgeFilter, _vertexFilter);
+        *_txn, _srcRdesc, _dstRdesc, _minDepth, _maxDepth, _edgeFilter, _vertexFilter);
     return std::move(ResultSetCursor { *_txn }.addMetadata(result));
 }
 
@@ -187,6 +187,63 @@ namespace parser {
         return parseRawData(rawData, propertyInfos, classType == ClassType::EDGE, enableVersion);
     }
 
+    Bytes RecordParser::parseRawDataProperty(const storage_engine::lmdb::Result& rawData,
+        const PropertyId& propertyId,
+        bool isEdge,
+        bool enableVersion)
+    {
+        auto value = locateRawDataProperty(rawData, propertyId, isEdge, enableVersion);
+        return (value.second > 0) ? Bytes { value.first, value.second } : Bytes {};
+    }
+
+    std::pair<const unsigned char*, size_t> RecordParser::locateRawDataProperty(
+        const storage_engine::lmdb::Result& rawData,
+        const PropertyId& propertyId,
+        bool isEdge,
+        bool enableVersion)
+    {
+        auto notFound = std::pair<const unsigned char*, size_t> { nullptr, 0 };
+        if (rawData.empty) {
+            return notFound;
+        }
+        // walk through property blocks in place to find the value of the requested property
+        auto rawDataBytes = rawData.data.data<Blob::Byte>();
+        auto rawDataSize = rawData.data.size();
+        auto offset = size_t { 0 };
+        offset += (isEdge) ? VERTEX_SRC_DST_RAW_DATA_LENGTH : size_t { 0 };
+        offset += (enableVersion) ? RECORD_VERSION_DATA_LENGTH : size_t { 0 };
+        if (rawDataSize <= offset + 1) {
+            return notFound;
+        }
+        while (offset + sizeof(PropertyId) + sizeof(uint8_t) <= rawDataSize) {
+            auto currentPropertyId = PropertyId {};
+            auto optionFlag = uint8_t {};
+            memcpy(&currentPropertyId, rawDataBytes + offset, sizeof(PropertyId));
+            offset += sizeof(PropertyId);
+            memcpy(&optionFlag, rawDataBytes + offset, sizeof(optionFlag));
+            auto propertySize = size_t {};
+            if ((optionFlag & 0x1) == 1) {
+                auto tmpSize = uint32_t {};
+                memcpy(&tmpSize, rawDataBytes + offset, sizeof(uint32_t));
+                offset += sizeof(uint32_t);
+                propertySize = static_cast<size_t>(tmpSize >> 1);
+            } else {
+                auto tmpSize = uint8_t {};
+                memcpy(&tmpSize, rawDataBytes + offset, sizeof(uint8_t));
+                offset += sizeof(uint8_t);
+                propertySize = static_cast<size_t>(tmpSize >> 1);
+            }
+            if (currentPropertyId == propertyId) {
+                require(offset + propertySize <= rawDataSize);
+                return (propertySize > 0)
+                    ? std::pair<const unsigned char*, size_t> { rawDataBytes + offset, propertySize }
+                    : notFound;
+            }
+            offset += propertySize;
+        }
+        return notFound;
+    }
+
     Record RecordParser::parseRawDataWithBasicInfo(const std::string& className,
         const RecordId& rid,
         const storage_engine::lmdb::Result& rawData,
@@ -68,6 +68,17 @@ namespace parser {
             const ClassType& classType,
             bool enableVersion);
 
+        static Bytes parseRawDataProperty(const storage_engine::lmdb::Result& rawData,
+            const PropertyId& propertyId,
+            bool isEdge,
+            bool enableVersion);
+
+        // the value is left in the raw data, and its size is zero when the record does not have the property
+        static std::pair<const unsigned char*, size_t> locateRawDataProperty(const storage_engine::lmdb::Result& rawData,
+            const PropertyId& propertyId,
+            bool isEdge,
+            bool enableVersion);
+
         static Blob& parseOnlyUpdateVersion(Blob& blob, VersionId versionId);
 
         static Blob parseOnlyUpdateVersion(const storage_engine::lmdb::Result& rawData, VersionId versionId);
@@ -122,6 +122,36 @@ void Transaction::dropProperty(const std::string& className, const std::string&
 const IndexDescriptor Transaction::addIndex(const std::string& className,
     const std::string& propertyName,
     bool isUnique)
+{
+    // unique text values such as uuids and emails are looked up by equality, so fixed-width hashes replace
+    // the whole strings as keys; an ordered unique text index is still made by asking for IndexType::ORDERED
+    if (isUnique) {
+        BEGIN_VALIDATION(this)
+            .isTxnValid()
+            .isTxnCompleted()
+            .isClassNameValid(className)
+            .isPropertyNameValid(propertyName);
+
+        auto foundClass = SchemaUtils::getExistingClass(this, className);
+        auto foundProperty = SchemaUtils::getExistingPropertyExtend(this, foundClass.id, propertyName);
+        if (foundProperty.type == PropertyType::TEXT) {
+            return addIndex(className, propertyName, true, IndexType::HASH);
+        }
+    }
+    return addIndex(className, propertyName, isUnique, IndexType::ORDERED);
+}
+
+const IndexDescriptor Transaction::addIndex(const std::string& className,
+    const std::string& propertyName,
+    const IndexType& type)
+{
+    return addIndex(className, propertyName, false, type);
+}
+
+const IndexDescriptor Transaction::addIndex(const std::string& className,
+    const std::string& propertyName,
+    bool isUnique,
+    const IndexType& type)
 {
     BEGIN_VALIDATION(this)
         .isTxnValid()
@@ -135,24 +165,32 @@ const IndexDescriptor Transaction::addIndex(const std::string& className,
     if (foundProperty.type == PropertyType::BLOB || foundProperty.type == PropertyType::UNDEFINED) {
         throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_INVALID_PROPTYPE_INDEX);
     }
+    if (type != IndexType::ORDERED && foundProperty.type != PropertyType::TEXT) {
+        throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_INVALID_PROPTYPE_INDEX);
+    }
+    // a record is indexed under each of its words, so words are not unique to a record
+    if (isUnique && type == IndexType::FULLTEXT) {
+        throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_INVALID_INDEX_CONSTRAINT);
+    }
     auto indexInfo = _adapter->dbIndex()->getInfo(foundClass.id, foundProperty.id);
     if (indexInfo.id != IndexId {}) {
         throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_DUPLICATE_INDEX);
     }
     try {
         auto indexId = _adapter->dbInfo()->getMaxIndexId() + IndexId { 1 };
-        auto indexProps = IndexAccessInfo { foundClass.id, foundProperty.id, indexId, isUnique };
+        auto indexProps = IndexAccessInfo { foundClass.id, foundProperty.id, indexId, isUnique, type };
         // create index metadata in schema
         _adapter->dbIndex()->create(indexProps);
-        // create index record in index database
-        IndexUtils::initialize(this, foundProperty, indexProps, foundClass.superClassId, foundClass.type);
+        // create index record and its statistics in index database
+        IndexUtils::initialize(this, foundProperty, indexProps, foundClass.type);
         _adapter->dbInfo()->setMaxIndexId(indexId);
         _adapter->dbInfo()->setNumIndexId(_adapter->dbInfo()->getNumIndexId() + IndexId { 1 });
         return IndexDescriptor {
             indexId,
             foundClass.id,
             foundProperty.id,
-            isUnique
+            isUnique,
+            type
         };
     } catch (const Error& err) {
         if (err.code() == MDB_KEYEXIST) {
@@ -196,4 +234,30 @@ void Transaction::dropIndex(const std::string& className, const std::string& pro
     }
 }
 
+void Transaction::analyze(const std::string& className)
+{
+    BEGIN_VALIDATION(this)
+        .isTxnValid()
+        .isTxnCompleted()
+        .isClassNameValid(className);
+
+    auto foundClass = SchemaUtils::getExistingClass(this, className);
+    auto propertyInfos = SchemaUtils::getPropertyIdMapInfo(this, foundClass.id, foundClass.superClassId);
+    try {
+        // rebuild the statistics of every index of the class from its current entries
+        for (const auto& indexInfo : _adapter->dbIndex()->getInfos(foundClass.id)) {
+            auto foundProperty = propertyInfos.find(indexInfo.propertyId);
+            if (foundProperty != propertyInfos.cend()) {
+                IndexUtils::analyze(this, foundProperty->second, indexInfo);
+            }
+        }
+    } catch (const Error& err) {
+        rollback();
+        throw NOGDB_FATAL_ERROR(err);
+    } catch (...) {
+        rollback();
+        std::rethrow_exception(std::current_exception());
+    }
+}
+
 }
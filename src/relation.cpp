@@ -110,6 +110,21 @@ namespace relation {
         return _outRel->getEdges(recordId);
     }
 
+    size_t GraphUtils::countInEdges(const RecordId& recordId) const
+    {
+        return _inRel->countEdges(recordId);
+    }
+
+    size_t GraphUtils::countOutEdges(const RecordId& recordId) const
+    {
+        return _outRel->countEdges(recordId);
+    }
+
+    size_t GraphUtils::countLoopEdges(const RecordId& recordId) const
+    {
+        return _outRel->countEdges(recordId, recordId);
+    }
+
     std::vector<std::pair<RecordId, RecordId>> GraphUtils::getInEdgeAndNeighbours(const RecordId& recordId) const
     {
         return _inRel->getEdgeAndNeighbours(recordId);
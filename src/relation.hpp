@@ -79,6 +79,13 @@ namespace relation {
 
         std::vector<RecordId> getOutEdges(const RecordId& recordId) const;
 
+        size_t countInEdges(const RecordId& recordId) const;
+
+        size_t countOutEdges(const RecordId& recordId) const;
+
+        // the number of edges whose source and destination are both the vertex
+        size_t countLoopEdges(const RecordId& recordId) const;
+
         std::vector<std::pair<RecordId, RecordId>> getInEdgeAndNeighbours(const RecordId& recordId) const;
 
         std::vector<std::pair<RecordId, RecordId>> getOutEdgeAndNeighbours(const RecordId& recordId) const;
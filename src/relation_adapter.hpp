@@ -22,6 +22,7 @@
 #pragma once
 
 #include <cstdlib>
+#include <functional>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -74,6 +75,12 @@ namespace relation {
         {
         }
 
+        RelationAccess(const storage_engine::LMDBTxn* const txn, const RelationAccess& other)
+            : LMDBKeyValAccess(txn, other)
+            , _direction { other._direction }
+        {
+        }
+
         virtual ~RelationAccess() noexcept = default;
 
         void create(const RelationAccessInfo& props)
@@ -162,6 +169,28 @@ namespace relation {
             return result;
         }
 
+        size_t countEdges(const RecordId& vertexId) const
+        {
+            // the edges of a vertex are the duplicated values of its key, which lmdb counts without reading them
+            auto cursorHandler = cursor();
+            auto keyValue = cursorHandler.find(rid2str(vertexId));
+            return keyValue.empty() ? size_t { 0 } : cursorHandler.count();
+        }
+
+        size_t countEdges(const RecordId& vertexId, const RecordId& neighborId) const
+        {
+            auto result = size_t { 0 };
+            auto cursorHandler = cursor();
+            for (auto keyValue = cursorHandler.find(rid2str(vertexId));
+                 !keyValue.empty();
+                 keyValue = cursorHandler.getNextDup()) {
+                if (parseNeighborId(keyValue.val.data.blob()) == neighborId) {
+                    ++result;
+                }
+            }
+            return result;
+        }
+
         std::vector<std::pair<RecordId, RecordId>> getEdgeAndNeighbours(const RecordId& vertexId) const
         {
             auto result = std::vector<std::pair<RecordId, RecordId>> {};
@@ -178,6 +207,17 @@ namespace relation {
             return result;
         }
 
+        void relationIter(std::function<void(const RecordId&, const RecordId&, const RecordId&)> callback) const
+        {
+            auto cursorHandler = cursor();
+            for (auto keyValue = cursorHandler.getNext();
+                 !keyValue.empty();
+                 keyValue = cursorHandler.getNext()) {
+                auto blob = keyValue.val.data.blob();
+                callback(str2rid(keyValue.key.data.string()), parseEdgeId(blob), parseNeighborId(blob));
+            }
+        }
+
         Direction getDirection() const
         {
             return _direction;
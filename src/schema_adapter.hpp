@@ -486,16 +486,21 @@ namespace schema {
 
     /**
    * Raw record format in lmdb data storage:
-   * {classId<uint16>}{propertyId<uint16>} -> {id<uint16>}{isUnique<uint8>}
+   * {classId<uint16>}{propertyId<uint16>} -> {id<uint16>}{isUnique<uint8>}{type<uint8>}
    */
     struct IndexAccessInfo {
         IndexAccessInfo() = default;
 
-        IndexAccessInfo(const ClassId& _classId, const PropertyId& _propertyId, const IndexId& _id, bool _isUnique)
+        IndexAccessInfo(const ClassId& _classId,
+            const PropertyId& _propertyId,
+            const IndexId& _id,
+            bool _isUnique,
+            const IndexType& _type = IndexType::ORDERED)
             : classId { _classId }
             , propertyId { _propertyId }
             , id { _id }
             , isUnique { _isUnique }
+            , type { _type }
         {
         }
 
@@ -503,6 +508,7 @@ namespace schema {
         PropertyId propertyId { 0 };
         IndexId id { 0 };
         bool isUnique { true };
+        IndexType type { IndexType::ORDERED };
     };
 
     class IndexAccess : public storage_engine::adapter::LMDBKeyValAccess {
@@ -579,7 +585,8 @@ namespace schema {
                 classId,
                 propertyId,
                 parseIndexId(blob),
-                parseIsUnique(blob)
+                parseIsUnique(blob),
+                parseIndexType(blob)
             };
         }
 
@@ -597,14 +604,27 @@ namespace schema {
             return isUnique == 1;
         }
 
+        static IndexType parseIndexType(const Blob& blob)
+        {
+            // index metadata created before index types were introduced has no type field
+            if (blob.size() < sizeof(IndexId) + 2 * sizeof(uint8_t)) {
+                return IndexType::ORDERED;
+            }
+            auto type = uint8_t {};
+            blob.retrieve(&type, sizeof(IndexId) + sizeof(uint8_t), sizeof(uint8_t));
+            return static_cast<IndexType>(type);
+        }
+
     private:
         void createOrUpdate(const IndexAccessInfo& props)
         {
-            auto totalLength = sizeof(IndexId) + sizeof(uint8_t);
+            auto totalLength = sizeof(IndexId) + 2 * sizeof(uint8_t);
             auto value = Blob(totalLength);
             value.append(&props.id, sizeof(IndexId));
             auto isUnique = (props.isUnique) ? uint8_t { 1 } : uint8_t { 0 };
             value.append(&isUnique, sizeof(isUnique));
+            auto type = static_cast<uint8_t>(props.type);
+            value.append(&type, sizeof(type));
             put(buildKey(props.classId, props.propertyId), value);
         }
 
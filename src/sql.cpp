@@ -22,7 +22,11 @@
 #include <cassert>
 #include <cstring>
 #include <functional>
+#include <iomanip>
+#include <list>
+#include <mutex>
 #include <numeric>
+#include <unordered_map>
 
 #include "constant.hpp"
 #include "sql.hpp"
@@ -357,8 +361,10 @@ Function::Function(const string& name_, vector<Projection>&& args_)
     static const auto nameMap = map<string, Id, StringCaseCompare>(
         {
             { "COUNT", Id::COUNT },
+            { "SUM", Id::SUM },
             { "MIN", Id::MIN },
             { "MAX", Id::MAX },
+            { "AVG", Id::AVG },
             { "IN", Id::IN },
             { "INE", Id::IN_E },
             { "INV", Id::IN_V },
@@ -420,23 +426,6 @@ Bytes Function::execute(Transaction& txn, const Result& input) const
     return func(txn, input, this->args);
 }
 
-Bytes Function::executeAggregateResult(const ResultSet& input) const
-{
-    function<Bytes(const ResultSet&, const vector<Projection>&)> func;
-    switch (this->id) {
-    case Id::COUNT:
-        func = count;
-        break;
-    case Id::MAX:
-        //            func = max; break;
-    case Id::MIN:
-        //            func = min; break;
-    default:
-        throw NOGDB_SQL_ERROR(NOGDB_SQL_INVALID_FUNCTION_NAME);
-    }
-    return func(input, this->args);
-}
-
 Bytes Function::executeExpand(Transaction& txn, ResultSet& input) const
 {
     return expand(txn, input, args);
@@ -446,8 +435,10 @@ bool Function::isAggregateResult() const
 {
     switch (this->id) {
     case Id::COUNT:
+    case Id::SUM:
     case Id::MIN:
     case Id::MAX:
+    case Id::AVG:
         return true;
     default:
         return false;
@@ -478,30 +469,6 @@ bool Function::isExpand() const
 
 #pragma mark-- private
 
-Bytes Function::count(const ResultSet& input, const vector<Projection>& args)
-{
-    if (args.empty()) {
-        return Bytes(input.size(), PropertyType(nogdb::PropertyType::UNSIGNED_BIGINT));
-    } else if (args.size() == 1 && args[0].type == ProjectionType::PROPERTY) {
-        string propName = args[0].get<string>();
-        size_t result = 0;
-        for (const auto& row : input) {
-            if (!row.record.get(propName).empty()) {
-                result++;
-            }
-        }
-        return Bytes(result, PropertyType(nogdb::PropertyType::UNSIGNED_BIGINT));
-    } else {
-        throw NOGDB_SQL_ERROR(NOGDB_SQL_INVALID_FUNCTION_ARGS);
-    }
-}
-
-//Bytes Function::min(Transaction &txn, const ResultSet &input, const vector<Projection> &args) {
-//}
-//
-//Bytes Function::max(Transaction &txn, const ResultSet &input, const vector<Projection> &args) {
-//}
-
 Bytes Function::walkIn(nogdb::Transaction& txn, const Result& input, const vector<Projection>& args)
 {
     ResultSet results {};
@@ -613,11 +580,204 @@ vector<string> Function::argsToClassFilter(const vector<Projection>& args)
     return filter;
 }
 
+#pragma mark - Aggregator
+
+static bool isSignedType(nogdb::PropertyType type)
+{
+    switch (type) {
+    case nogdb::PropertyType::TINYINT:
+    case nogdb::PropertyType::SMALLINT:
+    case nogdb::PropertyType::INTEGER:
+    case nogdb::PropertyType::BIGINT:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool isUnsignedType(nogdb::PropertyType type)
+{
+    switch (type) {
+    case nogdb::PropertyType::UNSIGNED_TINYINT:
+    case nogdb::PropertyType::UNSIGNED_SMALLINT:
+    case nogdb::PropertyType::UNSIGNED_INTEGER:
+    case nogdb::PropertyType::UNSIGNED_BIGINT:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static long long toSigned(const Bytes& value)
+{
+    switch (value.type()) {
+    case nogdb::PropertyType::TINYINT:
+        return value.toTinyInt();
+    case nogdb::PropertyType::SMALLINT:
+        return value.toSmallInt();
+    case nogdb::PropertyType::INTEGER:
+        return value.toInt();
+    default:
+        return value.toBigInt();
+    }
+}
+
+static unsigned long long toUnsigned(const Bytes& value)
+{
+    switch (value.type()) {
+    case nogdb::PropertyType::UNSIGNED_TINYINT:
+        return value.toTinyIntU();
+    case nogdb::PropertyType::UNSIGNED_SMALLINT:
+        return value.toSmallIntU();
+    case nogdb::PropertyType::UNSIGNED_INTEGER:
+        return value.toIntU();
+    default:
+        return value.toBigIntU();
+    }
+}
+
+static double toDouble(const Bytes& value)
+{
+    if (isSignedType(value.type())) {
+        return static_cast<double>(toSigned(value));
+    } else if (isUnsignedType(value.type())) {
+        return static_cast<double>(toUnsigned(value));
+    } else {
+        return value.toReal();
+    }
+}
+
+Aggregator::Aggregator(const Function& func)
+    : id(func.id)
+    , isCountAll(func.args.empty())
+{
+    switch (this->id) {
+    case Function::Id::COUNT:
+        if (func.args.size() > 1) {
+            throw NOGDB_SQL_ERROR(NOGDB_SQL_INVALID_FUNCTION_ARGS);
+        }
+        break;
+    case Function::Id::SUM:
+    case Function::Id::MIN:
+    case Function::Id::MAX:
+    case Function::Id::AVG:
+        if (func.args.size() != 1) {
+            throw NOGDB_SQL_ERROR(NOGDB_SQL_INVALID_FUNCTION_ARGS);
+        }
+        break;
+    default:
+        throw NOGDB_SQL_ERROR(NOGDB_SQL_INVALID_FUNCTION_NAME);
+    }
+}
+
+void Aggregator::add(const Bytes& value)
+{
+    if (this->id == Function::Id::COUNT) {
+        if (this->isCountAll || !value.empty()) {
+            this->count++;
+        }
+        return;
+    }
+    if (value.empty()) {
+        return;
+    }
+    this->count++;
+    switch (this->id) {
+    case Function::Id::SUM:
+    case Function::Id::AVG:
+        if (isSignedType(value.type())) {
+            this->integerSum += static_cast<unsigned long long>(toSigned(value));
+            this->hasSigned = true;
+        } else if (isUnsignedType(value.type())) {
+            this->integerSum += toUnsigned(value);
+        } else if (value.type() == nogdb::PropertyType::REAL) {
+            this->hasReal = true;
+        } else {
+            throw NOGDB_SQL_ERROR(NOGDB_SQL_INVALID_FUNCTION_ARGS);
+        }
+        this->realSum += toDouble(value);
+        break;
+    case Function::Id::MIN:
+        if (this->count == 1 || Aggregator::compare(value, this->extreme) < 0) {
+            this->extreme = value;
+        }
+        break;
+    case Function::Id::MAX:
+        if (this->count == 1 || Aggregator::compare(value, this->extreme) > 0) {
+            this->extreme = value;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+Bytes Aggregator::result() const
+{
+    switch (this->id) {
+    case Function::Id::COUNT:
+        return Bytes(this->count, PropertyType(nogdb::PropertyType::UNSIGNED_BIGINT));
+    case Function::Id::SUM:
+        if (this->count == 0) {
+            return Bytes();
+        } else if (this->hasReal) {
+            return Bytes(this->realSum, PropertyType(nogdb::PropertyType::REAL));
+        } else if (this->hasSigned) {
+            return Bytes(static_cast<long long>(this->integerSum), PropertyType(nogdb::PropertyType::BIGINT));
+        } else {
+            return Bytes(this->integerSum, PropertyType(nogdb::PropertyType::UNSIGNED_BIGINT));
+        }
+    case Function::Id::AVG:
+        if (this->count == 0) {
+            return Bytes();
+        }
+        return Bytes(this->realSum / this->count, PropertyType(nogdb::PropertyType::REAL));
+    default:
+        return this->extreme;
+    }
+}
+
+#pragma mark-- private
+
+int Aggregator::compare(const Bytes& lhs, const Bytes& rhs)
+{
+    auto isNumber = [](nogdb::PropertyType type) {
+        return isSignedType(type) || isUnsignedType(type) || type == nogdb::PropertyType::REAL;
+    };
+    if (isNumber(lhs.type()) && isNumber(rhs.type())) {
+        if (lhs.type() == nogdb::PropertyType::REAL || rhs.type() == nogdb::PropertyType::REAL) {
+            auto l = toDouble(lhs), r = toDouble(rhs);
+            return (l < r) ? -1 : (r < l);
+        } else if (isUnsignedType(lhs.type()) && isUnsignedType(rhs.type())) {
+            auto l = toUnsigned(lhs), r = toUnsigned(rhs);
+            return (l < r) ? -1 : (r < l);
+        } else {
+            // a negative value is smaller than every unsigned value
+            auto lNegative = isSignedType(lhs.type()) && toSigned(lhs) < 0;
+            auto rNegative = isSignedType(rhs.type()) && toSigned(rhs) < 0;
+            if (lNegative != rNegative) {
+                return lNegative ? -1 : 1;
+            }
+            auto l = isSignedType(lhs.type()) ? static_cast<unsigned long long>(toSigned(lhs)) : toUnsigned(lhs);
+            auto r = isSignedType(rhs.type()) ? static_cast<unsigned long long>(toSigned(rhs)) : toUnsigned(rhs);
+            return (l < r) ? -1 : (r < l);
+        }
+    }
+    // text and any other values are ordered by their bytes
+    auto cmp = memcmp(lhs.getRaw(), rhs.getRaw(), min(lhs.size(), rhs.size()));
+    if (cmp != 0) {
+        return cmp;
+    }
+    return (lhs.size() < rhs.size()) ? -1 : (rhs.size() < lhs.size());
+}
+
 #pragma mark - Parser process
 
 // define token space and illegal follow sqlite3
 #define TK_SPACE 0xFFFE
 #define TK_ILLEGAL 0xFFFF
+// a '?' or ':name' placeholder of a prepared statement, never passed to the parser
+#define TK_VARIABLE 0xFFFD
 
 /* Character classes for tokenizing
  **
@@ -692,6 +852,7 @@ static int keywordCode(const char* z, int n, int* pType)
     static const auto kw = map<string, int, StringCaseCompare>(
         {
             { "ALTER", TK_ALTER },
+            { "ANALYZE", TK_ANALYZE },
             { "AND", TK_AND },
             { "AS", TK_AS },
             { "ASC", TK_ASC },
@@ -707,6 +868,7 @@ static int keywordCode(const char* z, int n, int* pType)
             { "EDGE", TK_EDGE },
             { "END", TK_END },
             { "EXISTS", TK_EXISTS },
+            { "EXPLAIN", TK_EXPLAIN },
             { "EXTENDS", TK_EXTENDS },
             { "FROM", TK_FROM },
             { "GROUP", TK_GROUP },
@@ -721,6 +883,7 @@ static int keywordCode(const char* z, int n, int* pType)
             { "NULL", TK_NULL },
             { "OR", TK_OR },
             { "ORDER", TK_ORDER },
+            { "PROFILE", TK_PROFILE },
             { "PROPERTY", TK_PROPERTY },
             { "SELECT", TK_SELECT },
             { "SET", TK_SET },
@@ -729,6 +892,7 @@ static int keywordCode(const char* z, int n, int* pType)
             { "TO", TK_TO },
             { "TRAVERSE", TK_TRAVERSE },
             { "UPDATE", TK_UPDATE },
+            { "VALUES", TK_VALUES },
             { "VERTEX", TK_VERTEX },
             { "WHERE", TK_WHERE },
             { "WITH", TK_WITH },
@@ -890,13 +1054,21 @@ static int getTokenID(const unsigned char* z, int* tokenType)
         }
         return 1;
     case CC_VARNUM:
-        return -1;
+        *tokenType = TK_VARIABLE;
+        return 1;
     case CC_DOLLAR:
         return -1;
     case CC_VARALPHA:
         if (z[0] == '#') {
             *tokenType = TK_SHARP;
         } else if (z[0] == ':') {
+            if (aiClass[z[1]] <= CC_KYWD) {
+                // ':name' is a named placeholder, while ':' followed by a digit belongs to a record id
+                for (i = 2; aiClass[z[i]] <= CC_KYWD || aiClass[z[i]] == CC_DIGIT; i++) {
+                }
+                *tokenType = TK_VARIABLE;
+                return i;
+            }
             *tokenType = TK_COLON;
         } else if (z[0] == '@') {
             *tokenType = TK_AT;
@@ -948,44 +1120,330 @@ static int getTokenID(const unsigned char* z, int* tokenType)
     return i;
 }
 
-const nogdb::SQL::Result nogdb::SQL::execute(Transaction& txn, const std::string& sql)
-{
-    auto parser = sql_parser::Context::create(txn);
+#pragma mark - TokenList
+
+constexpr size_t TokenList::NO_SLOT;
 
-    const char* zSql = sql.c_str();
-    int n = 0; /* Length of the next token token */
+TokenList::TokenList(const string& sql_)
+    : sql(sql_)
+{
+    const unsigned char* zSql = (const unsigned char*)this->sql.c_str();
+    const unsigned char* z = zSql;
+    int n; /* Length of the next token token */
     int tokenType; /* type of the next token */
-    int lastTokenParsed = -1; /* type of the previous token */
 
-    while (1) {
-        if (zSql[0] != '\0') {
-            n = getTokenID((unsigned char*)zSql, &tokenType);
-        } else {
-            /* Upon reaching the end of input, call the parser two more times
-       * with tokens TK_SEMI and 0, in that order. */
-            if (lastTokenParsed == TK_SEMI) {
-                tokenType = 0;
-            } else if (lastTokenParsed == 0) {
-                break;
+    while (z[0] != '\0') {
+        n = getTokenID(z, &tokenType);
+        if (n == -1 || tokenType == TK_ILLEGAL) {
+            throw NOGDB_SQL_ERROR(NOGDB_SQL_UNRECOGNIZED_TOKEN);
+        }
+        auto offset = static_cast<size_t>(z - zSql);
+        if (tokenType == TK_VARIABLE) {
+            if (n == 1) {
+                this->items.push_back({ tokenType, offset, n, this->numPositionals++ });
             } else {
-                tokenType = TK_SEMI;
+                // named slots follow the positional ones, so they are numbered once all of them are counted
+                auto name = this->sql.substr(offset + 1, n - 1);
+                auto namedSlot = this->namedSlots.emplace(name, this->namedSlots.size()).first->second;
+                this->items.push_back({ tokenType, offset, n, namedSlot });
             }
-            zSql -= n;
+        } else if (tokenType != TK_SPACE) {
+            this->items.push_back({ tokenType, offset, n, NO_SLOT });
+        }
+        z += n;
+    }
+    for (auto& namedSlot : this->namedSlots) {
+        namedSlot.second += this->numPositionals;
+    }
+    for (auto& item : this->items) {
+        if (item.type == TK_VARIABLE && item.length > 1) {
+            item.slot += this->numPositionals;
         }
-        if (tokenType >= TK_SPACE || n == -1) {
-            if (tokenType == TK_ILLEGAL || n == -1) {
-                throw NOGDB_SQL_ERROR(NOGDB_SQL_UNRECOGNIZED_TOKEN);
+    }
+}
+
+/*
+ * The least recently used tokens are evicted once more than SQL_TOKEN_CACHE_SIZE statements are cached.
+ * Only lexing is saved: the grammar runs a statement while parsing it, so each execution parses again.
+ * Token lists are immutable, so one list is shared by every statement and transaction with the same sql.
+ */
+class TokenCache {
+public:
+    shared_ptr<const TokenList> get(const string& sql)
+    {
+        {
+            lock_guard<mutex> lock { _mutex };
+            auto found = _index.find(sql);
+            if (found != _index.end()) {
+                _entries.splice(_entries.begin(), _entries, found->second);
+                return found->second->second;
             }
-            zSql += n;
+        }
+        // lex outside of the lock, the tokens of a statement missed by two threads at once are only kept once
+        auto tokens = make_shared<const TokenList>(sql);
+        lock_guard<mutex> lock { _mutex };
+        auto found = _index.find(sql);
+        if (found != _index.end()) {
+            _entries.splice(_entries.begin(), _entries, found->second);
+            return found->second->second;
+        }
+        _entries.emplace_front(sql, tokens);
+        _index.emplace(sql, _entries.begin());
+        if (_entries.size() > nogdb::SQL_TOKEN_CACHE_SIZE) {
+            _index.erase(_entries.back().first);
+            _entries.pop_back();
+        }
+        return tokens;
+    }
+
+private:
+    using Entries = list<pair<string, shared_ptr<const TokenList>>>;
+
+    mutex _mutex {};
+    Entries _entries {};
+    unordered_map<string, Entries::iterator> _index {};
+};
+
+shared_ptr<const TokenList> TokenList::get(const string& sql)
+{
+    static TokenCache cache {};
+    return cache.get(sql);
+}
+
+#pragma mark - Statement
+
+nogdb::SQL::Statement::Statement(shared_ptr<const TokenList> tokens)
+    : _tokens(move(tokens))
+    , _values(_tokens->numSlots())
+{
+}
+
+nogdb::SQL::Statement& nogdb::SQL::Statement::bind(size_t index, double value)
+{
+    return setValue(positionalSlot(index), literal(value));
+}
+
+nogdb::SQL::Statement& nogdb::SQL::Statement::bind(size_t index, const string& value)
+{
+    return setValue(positionalSlot(index), literal(value));
+}
+
+nogdb::SQL::Statement& nogdb::SQL::Statement::bind(size_t index, const char* value)
+{
+    return (value != nullptr) ? setValue(positionalSlot(index), literal(string(value))) : setValue(positionalSlot(index), literal(nullptr));
+}
+
+nogdb::SQL::Statement& nogdb::SQL::Statement::bind(size_t index, const RecordDescriptor& value)
+{
+    return setValue(positionalSlot(index), literal(value));
+}
+
+nogdb::SQL::Statement& nogdb::SQL::Statement::bind(size_t index, nullptr_t)
+{
+    return setValue(positionalSlot(index), literal(nullptr));
+}
+
+nogdb::SQL::Statement& nogdb::SQL::Statement::bind(const string& name, double value)
+{
+    return setValue(namedSlot(name), literal(value));
+}
+
+nogdb::SQL::Statement& nogdb::SQL::Statement::bind(const string& name, const string& value)
+{
+    return setValue(namedSlot(name), literal(value));
+}
+
+nogdb::SQL::Statement& nogdb::SQL::Statement::bind(const string& name, const char* value)
+{
+    return (value != nullptr) ? setValue(namedSlot(name), literal(string(value))) : setValue(namedSlot(name), literal(nullptr));
+}
+
+nogdb::SQL::Statement& nogdb::SQL::Statement::bind(const string& name, const RecordDescriptor& value)
+{
+    return setValue(namedSlot(name), literal(value));
+}
+
+nogdb::SQL::Statement& nogdb::SQL::Statement::bind(const string& name, nullptr_t)
+{
+    return setValue(namedSlot(name), literal(nullptr));
+}
+
+const nogdb::SQL::Result nogdb::SQL::Statement::execute(Transaction& txn) const
+{
+    return execute(txn, false);
+}
+
+const nogdb::SQL::Result nogdb::SQL::Statement::stream(Transaction& txn) const
+{
+    return execute(txn, true);
+}
+
+const nogdb::SQL::Result nogdb::SQL::Statement::execute(Transaction& txn, bool streaming) const
+{
+    for (const auto& value : this->_values) {
+        if (value.empty()) {
+            throw NOGDB_SQL_ERROR(NOGDB_SQL_UNBOUND_PARAMETER);
+        }
+    }
+
+    auto parser = sql_parser::Context::create(txn);
+    parser->streaming = streaming;
+    Token lastToken { this->_tokens->sql.c_str(), 0, -1 }; /* the previous token */
+    auto parse = [&](Token token) {
+        lastToken = token;
+        parser->parse(token.t, move(token));
+        if (parser->rc != sql_parser::Context::SQL_OK) {
+            throw parser->result.get<Error>();
+        }
+    };
+
+    for (const auto& item : this->_tokens->items) {
+        if (item.slot == TokenList::NO_SLOT) {
+            parse({ this->_tokens->sql.c_str() + item.offset, item.length, item.type });
         } else {
-            parser->parse(tokenType, { zSql, n, tokenType });
-            lastTokenParsed = tokenType;
-            zSql += n;
-            if (parser->rc != sql_parser::Context::SQL_OK) {
-                throw parser->result.get<Error>();
+            for (const auto& token : this->_values[item.slot]) {
+                parse({ token.second.c_str(), (int)token.second.size(), token.first });
             }
         }
     }
+    /* Upon reaching the end of input, call the parser two more times
+     * with tokens TK_SEMI and 0, in that order. */
+    if (lastToken.t != TK_SEMI) {
+        parse({ lastToken.z, lastToken.n, TK_SEMI });
+    }
+    parse({ lastToken.z, lastToken.n, 0 });
 
     return parser->result;
 }
+
+size_t nogdb::SQL::Statement::positionalSlot(size_t index) const
+{
+    if (index >= this->_tokens->numPositionals) {
+        throw NOGDB_SQL_ERROR(NOGDB_SQL_INVALID_PARAMETER);
+    }
+    return index;
+}
+
+size_t nogdb::SQL::Statement::namedSlot(const string& name) const
+{
+    auto found = this->_tokens->namedSlots.find((!name.empty() && name[0] == ':') ? name.substr(1) : name);
+    if (found == this->_tokens->namedSlots.cend()) {
+        throw NOGDB_SQL_ERROR(NOGDB_SQL_INVALID_PARAMETER);
+    }
+    return found->second;
+}
+
+nogdb::SQL::Statement& nogdb::SQL::Statement::setValue(size_t slot, Literal&& value)
+{
+    this->_values[slot] = move(value);
+    return *this;
+}
+
+nogdb::SQL::Statement::Literal nogdb::SQL::Statement::literal(long long value)
+{
+    return Literal { { (value < 0) ? TK_SIGNED : TK_UNSIGNED, std::to_string(value) } };
+}
+
+nogdb::SQL::Statement::Literal nogdb::SQL::Statement::literal(unsigned long long value)
+{
+    return Literal { { TK_UNSIGNED, std::to_string(value) } };
+}
+
+nogdb::SQL::Statement::Literal nogdb::SQL::Statement::literal(double value)
+{
+    stringstream buff;
+    buff << setprecision(17) << value;
+    return Literal { { TK_FLOAT, buff.str() } };
+}
+
+nogdb::SQL::Statement::Literal nogdb::SQL::Statement::literal(const string& value)
+{
+    // quote the same way as Token::dequote reads it back
+    string quoted = "'";
+    for (const char c : value) {
+        if (c == '\'' || c == '\\') {
+            quoted += '\\';
+        }
+        quoted += c;
+    }
+    quoted += '\'';
+    return Literal { { TK_STRING, quoted } };
+}
+
+nogdb::SQL::Statement::Literal nogdb::SQL::Statement::literal(const RecordDescriptor& value)
+{
+    return Literal {
+        { TK_SHARP, "#" },
+        { TK_UNSIGNED, std::to_string(value.rid.first) },
+        { TK_COLON, ":" },
+        { TK_UNSIGNED, std::to_string(value.rid.second) },
+    };
+}
+
+nogdb::SQL::Statement::Literal nogdb::SQL::Statement::literal(nullptr_t)
+{
+    return Literal { { TK_NULL, "NULL" } };
+}
+
+#pragma mark - Cursor
+
+nogdb::SQL::Cursor::Cursor(unique_ptr<RowSource> source)
+    : _source(move(source))
+{
+}
+
+nogdb::SQL::Cursor::~Cursor() noexcept {}
+
+nogdb::SQL::Cursor::Cursor(Cursor&& cursor) noexcept
+    : _source(move(cursor._source))
+    , _result(move(cursor._result))
+{
+}
+
+nogdb::SQL::Cursor& nogdb::SQL::Cursor::operator=(Cursor&& cursor) noexcept
+{
+    if (this != &cursor) {
+        _source = move(cursor._source);
+        _result = move(cursor._result);
+    }
+    return *this;
+}
+
+bool nogdb::SQL::Cursor::next()
+{
+    if (_source == nullptr || !_source->next()) {
+        // every row has been pulled, so the stages are released at once
+        _source.reset();
+        _result = nogdb::Result {};
+        return false;
+    }
+    _result = _source->get().toBaseResult();
+    return true;
+}
+
+const nogdb::Result& nogdb::SQL::Cursor::operator*() const
+{
+    return _result;
+}
+
+const nogdb::Result* nogdb::SQL::Cursor::operator->() const
+{
+    return &(operator*());
+}
+
+#pragma mark - SQL
+
+const nogdb::SQL::Result nogdb::SQL::execute(Transaction& txn, const std::string& sql)
+{
+    return prepare(sql).execute(txn);
+}
+
+const nogdb::SQL::Result nogdb::SQL::stream(Transaction& txn, const std::string& sql)
+{
+    return prepare(sql).stream(txn);
+}
+
+nogdb::SQL::Statement nogdb::SQL::prepare(const std::string& sql)
+{
+    return Statement(TokenList::get(sql));
+}
@@ -252,8 +252,10 @@ namespace sql_parser {
         enum class Id {
             UNDEFINED,
             COUNT,
+            SUM,
             MIN,
             MAX,
+            AVG,
             IN,
             IN_E,
             IN_V,
@@ -276,8 +278,6 @@ namespace sql_parser {
 
         Bytes execute(Transaction& txn, const Result& input) const;
 
-        Bytes executeAggregateResult(const ResultSet& input) const;
-
         Bytes executeExpand(Transaction& txn, ResultSet& input) const;
 
         bool isAggregateResult() const;
@@ -287,10 +287,6 @@ namespace sql_parser {
         bool isExpand() const;
 
     private:
-        static Bytes count(const ResultSet& input, const vector<Projection>& args);
-
-        //            static Bytes min(const ResultSet &input, const vector<Projection> &args);
-        //            static Bytes max(const ResultSet &input, const vector<Projection> &args);
         static Bytes walkIn(Transaction& txn, const Result& input, const vector<Projection>& args);
 
         static Bytes walkInEdge(Transaction& txn, const Result& input, const vector<Projection>& args);
@@ -314,6 +310,34 @@ namespace sql_parser {
         static vector<string> argsToClassFilter(const vector<Projection>& args);
     };
 
+    /*
+     * The running state of an aggregate function over the rows of one group. The value
+     * of the function argument is added row by row, so the rows of a group are never
+     * kept together. Empty values are skipped, as NULL values are in SQL.
+     */
+    class Aggregator {
+    public:
+        explicit Aggregator(const Function& func);
+
+        // adds a row with the value of the argument, which is ignored by count() without an argument
+        void add(const Bytes& value);
+
+        Bytes result() const;
+
+    private:
+        static int compare(const Bytes& lhs, const Bytes& rhs);
+
+        Function::Id id;
+        bool isCountAll;
+        unsigned long long count { 0 };
+        // integers are summed with wraparound, so one sum holds both signed and unsigned values
+        unsigned long long integerSum { 0 };
+        double realSum { 0.0 };
+        bool hasSigned { false };
+        bool hasReal { false };
+        Bytes extreme {};
+    };
+
     /* An arguments for create edge statement */
     struct CreateEdgeArgs {
         string name;
@@ -327,7 +351,7 @@ namespace sql_parser {
         vector<Projection> projections;
         Target from;
         Where where;
-        string group;
+        vector<string> group;
         void* order;
         int skip; /* Number of records you want to skip from the start of the result-set. */
         int limit; /* Maximum number of records in the result-set. */
@@ -362,6 +386,39 @@ namespace sql_parser {
         long long minDepth;
         long long maxDepth;
         string strategy;
+        // a condition of the outer statement, evaluated on each vertex as it is reached
+        Where where;
+    };
+
+    /*
+     * The tokens of a statement, which are all that the token cache keeps of it.
+     * Tokens are kept as positions in the statement text, since some rules of the grammar
+     * span the text of adjacent tokens. A placeholder is a token whose slot refers to one of
+     * the values bound to a prepared statement; '?' placeholders take the first slots in order
+     * and every ':name' takes one slot shared by all of its occurrences.
+     */
+    class TokenList {
+    public:
+        static constexpr size_t NO_SLOT = static_cast<size_t>(-1);
+
+        struct Item {
+            int type;
+            size_t offset;
+            int length;
+            size_t slot;
+        };
+
+        explicit TokenList(const string& sql_);
+
+        const string sql;
+        vector<Item> items {};
+        size_t numPositionals { 0 };
+        map<string, size_t> namedSlots {};
+
+        inline size_t numSlots() const { return this->numPositionals + this->namedSlots.size(); }
+
+        // returns the tokens of a statement from the token cache, lexing it on a miss
+        static shared_ptr<const TokenList> get(const string& sql);
     };
 
     string to_string(const Projection& proj);
@@ -21,6 +21,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <unordered_map>
 
 #include "constant.hpp"
 #include "sql.hpp"
@@ -46,6 +47,22 @@ static bool stringcasecmp(const string& a, const string& b)
     return strcasecmp(a.c_str(), b.c_str()) < 0;
 }
 
+static bool stringcaseeq(const string& a, const string& b)
+{
+    return !stringcasecmp(a, b) && !stringcasecmp(b, a);
+}
+
+// the node of an operator, with the node of the stage it pulls its rows from if any
+static nogdb::QueryPlanNode planNode(const string& operation, const RowSource* input = nullptr)
+{
+    auto node = nogdb::QueryPlanNode {};
+    node.operation = operation;
+    if (input != nullptr) {
+        node.children.push_back(input->plan());
+    }
+    return node;
+}
+
 #pragma mark - Context
 
 void Context::createClass(const Token& tName, const Token& tExtend, bool checkIfNotExists)
@@ -244,19 +261,44 @@ void Context::createVertex(const Token& tClassName, const nogdb::Record& prop)
     }
 }
 
+void Context::createVertices(const Token& tClassName, const vector<string>& props, const vector<vector<Bytes>>& rows)
+{
+    try {
+        vector<nogdb::Record> records {};
+        records.reserve(rows.size());
+        for (const auto& row : rows) {
+            if (row.size() != props.size()) {
+                throw NOGDB_SQL_ERROR(NOGDB_SQL_INVALID_VALUES);
+            }
+            nogdb::Record record {};
+            for (size_t i = 0; i < props.size(); ++i) {
+                record.set(props[i], row[i].getBase());
+            }
+            records.push_back(move(record));
+        }
+        auto result = this->txn.addVertices(tClassName.toString(), records);
+        this->rc = SQL_OK;
+        this->result = SQL::Result(new vector<nogdb::RecordDescriptor>(move(result)));
+    } catch (const Error& e) {
+        this->rc = SQL_ERROR;
+        this->result = SQL::Result(new Error(e));
+    }
+}
+
 void Context::createEdge(const CreateEdgeArgs& args)
 {
     try {
         auto srcVertex = this->select(args.src, Where());
         auto destVertex = this->select(args.dest, Where());
 
-        vector<nogdb::RecordDescriptor> result {};
+        vector<pair<nogdb::RecordDescriptor, nogdb::RecordDescriptor>> srcDestVertex {};
+        srcDestVertex.reserve(srcVertex.size() * destVertex.size());
         for (const auto& src : srcVertex) {
             for (const auto& dest : destVertex) {
-                nogdb::RecordDescriptor r = this->txn.addEdge(args.name, src.descriptor, dest.descriptor, args.prop);
-                result.push_back(move(r));
+                srcDestVertex.emplace_back(src.descriptor, dest.descriptor);
             }
         }
+        auto result = this->txn.addEdges(args.name, srcDestVertex, args.prop);
         this->rc = SQL_OK;
         this->result = SQL::Result(new vector<nogdb::RecordDescriptor>(move(result)));
     } catch (const Error& e) {
@@ -268,11 +310,17 @@ void Context::createEdge(const CreateEdgeArgs& args)
 void Context::select(const SelectArgs& args)
 {
     try {
-        ResultSet result = this->selectPrivate(args);
-        this->rc = SQL_OK;
-        nogdb::ResultSet* tmp = new nogdb::ResultSet(result.size());
-        transform(result.cbegin(), result.cend(), tmp->begin(), [](const Result& r) { return r.toBaseResult(); });
-        this->result = SQL::Result(tmp);
+        if (this->streaming) {
+            auto cursor = new SQL::Cursor(this->selectStream(args));
+            this->rc = SQL_OK;
+            this->result = SQL::Result(cursor);
+        } else {
+            ResultSet result = this->selectPrivate(args);
+            this->rc = SQL_OK;
+            nogdb::ResultSet* tmp = new nogdb::ResultSet(result.size());
+            transform(result.cbegin(), result.cend(), tmp->begin(), [](const Result& r) { return r.toBaseResult(); });
+            this->result = SQL::Result(tmp);
+        }
     } catch (const Error& e) {
         this->rc = SQL_ERROR;
         this->result = SQL::Result(new Error(e));
@@ -284,24 +332,10 @@ void Context::update(const UpdateArgs& args)
     try {
         vector<nogdb::RecordDescriptor> result {};
         ResultSet targets = this->select(args.target, args.where);
-        for (auto& target : targets) {
-            nogdb::Record r = target.record.toBaseRecord();
-            for (const auto& prop : args.prop.getAll()) {
-                r.set(prop.first, prop.second);
-            }
-            ClassType type = this->txn.getClass(target.descriptor.rid.first).type;
-            switch (type) {
-            case ClassType::VERTEX:
-                this->txn.update(target.descriptor, r);
-                break;
-            case ClassType::EDGE:
-                this->txn.update(target.descriptor, r);
-                break;
-            case ClassType::UNDEFINED:
-                throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_INVALID_CLASSTYPE);
-            }
+        for (const auto& target : targets) {
             result.push_back(target.descriptor);
         }
+        this->txn.updateProperties(result, args.prop);
         this->rc = SQL_OK;
         this->result = SQL::Result(new vector<nogdb::RecordDescriptor>(move(result)));
     } catch (const Error& e) {
@@ -316,9 +350,9 @@ void Context::deleteVertex(const DeleteVertexArgs& args)
         vector<nogdb::RecordDescriptor> result {};
         ResultSet targets = select(args.target, args.where);
         for (const auto& target : targets) {
-            this->txn.remove(target.descriptor);
             result.push_back(target.descriptor);
         }
+        this->txn.remove(result);
         this->rc = SQL_OK;
         this->result = SQL::Result(new vector<nogdb::RecordDescriptor>(move(result)));
     } catch (const Error& e) {
@@ -412,12 +446,11 @@ void Context::deleteEdge(const DeleteEdgeArgs& args)
         }
 
         // delete.
-        for (const auto& target : targets) {
-            this->txn.remove(target);
-        }
+        vector<nogdb::RecordDescriptor> result(targets.begin(), targets.end());
+        this->txn.remove(result);
 
         this->rc = SQL_OK;
-        this->result = SQL::Result(new vector<RecordDescriptor>(targets.begin(), targets.end()));
+        this->result = SQL::Result(new vector<nogdb::RecordDescriptor>(move(result)));
     } catch (const Error& e) {
         this->rc = SQL_ERROR;
         this->result = SQL::Result(new Error(e));
@@ -427,11 +460,17 @@ void Context::deleteEdge(const DeleteEdgeArgs& args)
 void Context::traverse(const TraverseArgs& args)
 {
     try {
-        ResultSet result = this->traversePrivate(args);
-        this->rc = SQL_OK;
-        nogdb::ResultSet* tmp = new nogdb::ResultSet(result.size());
-        transform(result.cbegin(), result.cend(), tmp->begin(), [](const Result& r) { return r.toBaseResult(); });
-        this->result = SQL::Result(tmp);
+        if (this->streaming) {
+            auto cursor = new SQL::Cursor(this->traverseStream(args));
+            this->rc = SQL_OK;
+            this->result = SQL::Result(cursor);
+        } else {
+            ResultSet result = this->traversePrivate(args);
+            this->rc = SQL_OK;
+            nogdb::ResultSet* tmp = new nogdb::ResultSet(result.size());
+            transform(result.cbegin(), result.cend(), tmp->begin(), [](const Result& r) { return r.toBaseResult(); });
+            this->result = SQL::Result(tmp);
+        }
     } catch (const Error& e) {
         this->rc = SQL_ERROR;
         this->result = SQL::Result(new Error(e));
@@ -441,8 +480,14 @@ void Context::traverse(const TraverseArgs& args)
 void Context::createIndex(const Token& tClassName, const Token& tPropName, const Token& tIndexType)
 {
     try {
-        bool unique = stringcasecmp(tIndexType.toString(), "UNIQUE") == 0 ? true : false;
-        this->txn.addIndex(tClassName.toString(), tPropName.toString(), unique);
+        if (stringcaseeq(tIndexType.toString(), "FULLTEXT")) {
+            this->txn.addIndex(tClassName.toString(), tPropName.toString(), IndexType::FULLTEXT);
+        } else if (stringcaseeq(tIndexType.toString(), "HASH")) {
+            this->txn.addIndex(tClassName.toString(), tPropName.toString(), IndexType::HASH);
+        } else {
+            this->txn.addIndex(
+                tClassName.toString(), tPropName.toString(), stringcaseeq(tIndexType.toString(), "UNIQUE"));
+        }
 
         this->rc = SQL_OK;
         this->result = SQL::Result();
@@ -465,66 +510,400 @@ void Context::dropIndex(const Token& tClassName, const Token& tPropName)
     }
 }
 
-#pragma mark-- private
+void Context::analyze(const Token& tClassName)
+{
+    try {
+        this->txn.analyze(tClassName.toString());
 
-ResultSet Context::selectPrivate(const SelectArgs& stmt)
+        this->rc = SQL_OK;
+        this->result = SQL::Result();
+    } catch (const Error& e) {
+        this->rc = SQL_ERROR;
+        this->result = SQL::Result(new Error(e));
+    }
+}
+
+void Context::explain(const SelectArgs& args)
 {
-    ResultSet result = this->select(stmt.from, stmt.where, stmt.skip, stmt.limit);
-    result = this->selectProjection(result, stmt.projections);
-    return this->selectGroupBy(result, stmt.group);
+    this->explainPrivate([this, &args]() { return this->selectStream(args); });
 }
 
-ResultSet Context::select(const Target& target, const Where& where)
+void Context::explain(const TraverseArgs& args)
 {
-    return this->select(target, where, -1, -1);
+    this->explainPrivate([this, &args]() { return this->traverseStream(args); });
 }
 
-ResultSet Context::select(const Target& target, const Where& where, int skip, int limit)
+void Context::profile(const SelectArgs& args)
 {
-    switch (target.type) {
-    case TargetType::NO_TARGET:
-        return ResultSet {};
+    this->profiling = true;
+    this->explainPrivate([this, &args]() { return this->selectStream(args); });
+}
 
-    case TargetType::CLASS: {
-        string& className = target.get<string>();
-        ClassType type = Context::findClassType(this->txn, className);
-        if (type == ClassType::VERTEX) {
-            ResultSetCursor res = this->selectVertex(className, where);
-            return ResultSet(res, skip, limit);
-        } else if (type == ClassType::EDGE) {
-            ResultSetCursor res = this->selectEdge(className, where);
-            return ResultSet(res, skip, limit);
-        } else {
-            throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_INVALID_CLASSTYPE);
+void Context::profile(const TraverseArgs& args)
+{
+    this->profiling = true;
+    this->explainPrivate([this, &args]() { return this->traverseStream(args); });
+}
+
+#pragma mark-- streaming stages
+
+// a condition evaluated row by row, with the property types of the last seen class kept for the next rows
+class Context::ConditionFilter {
+public:
+    ConditionFilter(Transaction& txn_, const MultiCondition& conds_)
+        : txn(txn_)
+        , conds(conds_)
+    {
+    }
+
+    bool operator()(const Result& in)
+    {
+        ClassId classID = in.descriptor.rid.first;
+        if (classID == (ClassId)CLASS_DESCDRIPTOR_TEMPORARY) {
+            mapProp.clear();
+            mapProp[RECORD_ID_PROPERTY] = PropertyType::TEXT;
+            mapProp[CLASS_NAME_PROPERTY] = PropertyType::TEXT;
+            mapProp[DEPTH_PROPERTY] = PropertyType::UNSIGNED_INTEGER;
+            mapProp[VERSION_PROPERTY] = PropertyType::UNSIGNED_BIGINT;
+            for (const auto& prop : in.record.getAll()) {
+                mapProp[prop.first] = prop.second.type();
+            }
+        } else if (classID != previousClassID) {
+            mapProp.clear();
+            mapProp[RECORD_ID_PROPERTY] = PropertyType::TEXT;
+            mapProp[CLASS_NAME_PROPERTY] = PropertyType::TEXT;
+            mapProp[DEPTH_PROPERTY] = PropertyType::UNSIGNED_INTEGER;
+            mapProp[VERSION_PROPERTY] = PropertyType::UNSIGNED_BIGINT;
+            const ClassDescriptor classDescriptor = txn.getClass(classID);
+            const vector<PropertyDescriptor> properties = txn.getProperties(classDescriptor);
+            for (const auto& p : properties) {
+                mapProp[p.name] = p.type;
+            }
+        } else /* if (classID == previousClassID) */ {
+            // no-op;
         }
+        previousClassID = classID;
+        return conds.execute(in.record.toBaseRecord(), mapProp);
+    }
+
+private:
+    Transaction& txn;
+    MultiCondition conds;
+    PropertyMapType mapProp {};
+    ClassId previousClassID = -1;
+};
+
+// records of a class found by a find operation, which runs once the first row is pulled
+class Context::CursorSource : public RowSource {
+public:
+    explicit CursorSource(const FindOperationBuilder& find_)
+        : find(find_)
+    {
     }
 
-    case TargetType::RIDS: {
-        ResultSet result = this->select(target.get<RecordDescriptorSet>());
-        result = this->selectWhere(result, where);
-        return result.limit(skip, limit);
+    bool next() override
+    {
+        if (!cursor) {
+            cursor.reset(new ResultSetCursor(find.getCursor()));
+        }
+        if (!cursor->next()) {
+            return false;
+        }
+        row = Result(nogdb::Result(**cursor));
+        return true;
+    }
+
+    const Result& get() const override { return row; }
+
+    QueryPlanNode plan() const override
+    {
+        auto node = planNode("FIND");
+        node.plans = find.explain();
+        return node;
     }
 
-    case TargetType::NESTED: {
-        auto result = this->selectPrivate(target.get<SelectArgs>());
-        result = this->selectWhere(result, where);
-        return result.limit(skip, limit);
+private:
+    FindOperationBuilder find;
+    unique_ptr<ResultSetCursor> cursor {};
+    Result row {};
+};
+
+// vertices reached by a traversal, which goes on only as far as the rows are pulled
+class Context::TraverseSource : public RowSource {
+public:
+    explicit TraverseSource(TraverseCursor&& cursor_)
+        : cursor(move(cursor_))
+    {
     }
 
-    case TargetType::NESTED_TRAVERSE: {
-        auto result = this->traversePrivate(target.get<TraverseArgs>());
-        result = this->selectWhere(result, where);
-        if (skip > 0) {
-            result.erase(result.begin(), result.begin() + skip);
+    bool next() override
+    {
+        if (!cursor.next()) {
+            return false;
         }
-        if (limit >= 0 && (unsigned)limit < result.size()) {
-            result.resize(limit);
+        row = Result(nogdb::Result(*cursor));
+        return true;
+    }
+
+    const Result& get() const override { return row; }
+
+    QueryPlanNode plan() const override { return planNode("TRAVERSE"); }
+
+private:
+    TraverseCursor cursor;
+    Result row {};
+};
+
+// records given by their ids, fetched when they are pulled
+class Context::RecordSource : public RowSource {
+public:
+    RecordSource(Transaction& txn_, const RecordDescriptorSet& rids_)
+        : txn(txn_)
+        , rids(rids_)
+        , it(rids.cbegin())
+    {
+    }
+
+    bool next() override
+    {
+        if (it == rids.cend()) {
+            return false;
         }
-        return result;
+        row = Result(RecordDescriptor(*it), txn.fetchRecord(*it));
+        ++it;
+        return true;
     }
 
-    default:
-        return ResultSet {};
+    const Result& get() const override { return row; }
+
+    QueryPlanNode plan() const override { return planNode("FETCH"); }
+
+private:
+    Transaction& txn;
+    RecordDescriptorSet rids;
+    RecordDescriptorSet::const_iterator it;
+    Result row {};
+};
+
+// rows which have to be computed together, such as grouped or expanded rows, computed once the first row is pulled
+class Context::MaterializedSource : public RowSource {
+public:
+    MaterializedSource(const string& operation_, unique_ptr<RowSource>&& input_,
+        const function<ResultSet(RowSource&)>& compute_)
+        : operation(operation_)
+        , input(move(input_))
+        , compute(compute_)
+    {
+    }
+
+    bool next() override
+    {
+        if (!computed) {
+            if (input) {
+                rows = compute(*input);
+            }
+            computed = true;
+        }
+        if (index >= rows.size()) {
+            return false;
+        }
+        row = move(rows[index++]);
+        return true;
+    }
+
+    const Result& get() const override { return row; }
+
+    QueryPlanNode plan() const override { return planNode(operation, input.get()); }
+
+private:
+    string operation;
+    unique_ptr<RowSource> input;
+    function<ResultSet(RowSource&)> compute;
+    bool computed { false };
+    ResultSet rows {};
+    size_t index { 0 };
+    Result row {};
+};
+
+class Context::WhereStage : public RowSource {
+public:
+    WhereStage(Transaction& txn, unique_ptr<RowSource>&& input_, const MultiCondition& conds)
+        : input(move(input_))
+        , filter(txn, conds)
+    {
+    }
+
+    bool next() override
+    {
+        while (input->next()) {
+            if (filter(input->get())) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const Result& get() const override { return input->get(); }
+
+    QueryPlanNode plan() const override { return planNode("FILTER", input.get()); }
+
+private:
+    unique_ptr<RowSource> input;
+    ConditionFilter filter;
+};
+
+class Context::LimitStage : public RowSource {
+public:
+    LimitStage(unique_ptr<RowSource>&& input_, int skip, int limit)
+        : input(move(input_))
+        , toSkip(skip)
+        , remaining(limit)
+    {
+    }
+
+    bool next() override
+    {
+        for (; toSkip > 0; --toSkip) {
+            if (!input->next()) {
+                toSkip = 0;
+                remaining = 0;
+                return false;
+            }
+        }
+        if (remaining == 0) {
+            return false;
+        }
+        if (!input->next()) {
+            remaining = 0;
+            return false;
+        }
+        if (remaining > 0) {
+            --remaining;
+        }
+        return true;
+    }
+
+    const Result& get() const override { return input->get(); }
+
+    QueryPlanNode plan() const override { return planNode("LIMIT", input.get()); }
+
+private:
+    unique_ptr<RowSource> input;
+    int toSkip;
+    // a negative number of remaining rows has no limit
+    int remaining;
+};
+
+class Context::ProjectionStage : public RowSource {
+public:
+    ProjectionStage(Transaction& txn_, unique_ptr<RowSource>&& input_, const vector<Projection>& projs_)
+        : txn(txn_)
+        , input(move(input_))
+        , projs(projs_)
+    {
+    }
+
+    bool next() override
+    {
+        while (input->next()) {
+            const Result& in = input->get();
+            if (in.descriptor.rid.first != previousClassID) {
+                mapProps = Context::getPropertyMapTypeFromClassDescriptor(txn, in.descriptor.rid.first);
+                previousClassID = in.descriptor.rid.first;
+            }
+            Record record {};
+            for (const Projection& proj : projs) {
+                record.set(to_string(proj), Context::getProjectionItem(txn, in, proj, mapProps));
+            }
+            if (!record.empty()) {
+                row = Result(RecordDescriptor(CLASS_DESCDRIPTOR_TEMPORARY, numRows++), move(record));
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const Result& get() const override { return row; }
+
+    QueryPlanNode plan() const override { return planNode("PROJECT", input.get()); }
+
+private:
+    Transaction& txn;
+    unique_ptr<RowSource> input;
+    vector<Projection> projs;
+    PropertyMapType mapProps {};
+    ClassId previousClassID = -1;
+    PositionId numRows { 0 };
+    Result row {};
+};
+
+// measures the rows, the LMDB reads and the time of the stage it wraps, including the stages under it
+class Context::ProfileStage : public RowSource {
+public:
+    explicit ProfileStage(unique_ptr<RowSource>&& input_)
+        : input(move(input_))
+    {
+    }
+
+    bool next() override
+    {
+        auto found = false;
+        {
+            utils::profiler::StopwatchScope running { stopwatch };
+            found = input->next();
+        }
+        if (found) {
+            ++rows;
+        }
+        return found;
+    }
+
+    const Result& get() const override { return input->get(); }
+
+    QueryPlanNode plan() const override
+    {
+        auto node = input->plan();
+        node.rows = rows;
+        node.reads = stopwatch.reads;
+        node.elapsedTime = stopwatch.elapsed;
+        return node;
+    }
+
+private:
+    unique_ptr<RowSource> input;
+    utils::profiler::Stopwatch stopwatch {};
+    unsigned long long rows { 0 };
+};
+
+#pragma mark-- private
+
+ResultSet Context::selectPrivate(const SelectArgs& stmt)
+{
+    return Context::collect(*this->selectStream(stmt));
+}
+
+ResultSet Context::select(const Target& target, const Where& where)
+{
+    return this->select(target, where, -1, -1);
+}
+
+ResultSet Context::select(const Target& target, const Where& where, int skip, int limit)
+{
+    if (target.type != TargetType::CLASS) {
+        // rows of any other target are filtered and limited as they are pulled, without a copy of the whole input
+        return Context::collect(*this->selectStream(target, where, skip, limit));
+    }
+
+    string& className = target.get<string>();
+    ClassType type = Context::findClassType(this->txn, className);
+    if (type == ClassType::VERTEX) {
+        ResultSetCursor res = this->selectVertex(className, where);
+        return ResultSet(res, skip, limit);
+    } else if (type == ClassType::EDGE) {
+        ResultSetCursor res = this->selectEdge(className, where);
+        return ResultSet(res, skip, limit);
+    } else {
+        throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_INVALID_CLASSTYPE);
     }
 }
 
@@ -539,46 +918,68 @@ ResultSet Context::select(const RecordDescriptorSet& rids)
     return result;
 }
 
-nogdb::ResultSetCursor Context::selectVertex(const string& className, const Where& where)
+void Context::pushDown(Target& target, Where& where, int& skip, int& limit) const
 {
-    switch (where.type) {
-    case WhereType::CONDITION:
-        return this->txn.find(className).where(where.get<Condition>()).getCursor();
-    case WhereType::MULTI_COND:
-        return this->txn.find(className).where(where.get<MultiCondition>()).getCursor();
-    case WhereType::NO_COND:
-    default:
-        return this->txn.find(className).getCursor();
+    // a nested select of whole records is merged into the outer one, unless its own limits
+    // have to be applied before the outer condition
+    while (target.type == TargetType::NESTED) {
+        const SelectArgs& inner = target.get<SelectArgs>();
+        if (!inner.projections.empty() || !inner.group.empty()
+            || (where.type != WhereType::NO_COND && (inner.skip > 0 || inner.limit >= 0))) {
+            break;
+        }
+        auto outerSkip = max(skip, 0);
+        if (inner.limit >= 0) {
+            auto remaining = max(inner.limit - outerSkip, 0);
+            limit = (limit >= 0) ? min(limit, remaining) : remaining;
+        }
+        skip = max(inner.skip, 0) + outerSkip;
+        where = Context::mergeWhere(inner.where, where);
+        Target from = inner.from;
+        target = move(from);
+    }
+
+    // vertices of a traversal which returns its first level only are never expanded,
+    // so a condition on them can prune the traversal without changing its result
+    if (target.type == TargetType::NESTED_TRAVERSE && where.type != WhereType::NO_COND && !this->hasDepthProperty) {
+        const TraverseArgs& inner = target.get<TraverseArgs>();
+        if (inner.minDepth >= 1 && inner.maxDepth <= 1) {
+            auto args = make_shared<TraverseArgs>(inner);
+            args->where = Context::mergeWhere(args->where, where);
+            target = Target(TargetType::NESTED_TRAVERSE, args);
+            where = Where();
+        }
     }
 }
 
+nogdb::ResultSetCursor Context::selectVertex(const string& className, const Where& where)
+{
+    return this->findBuilder(className, where).getCursor();
+}
+
 nogdb::ResultSetCursor Context::selectEdge(const string& className, const Where& where)
 {
+    return this->findBuilder(className, where).getCursor();
+}
+
+nogdb::FindOperationBuilder Context::findBuilder(const string& className, const Where& where)
+{
+    auto find = this->txn.find(className);
     switch (where.type) {
     case WhereType::CONDITION:
-        return this->txn.find(className).where(where.get<Condition>()).getCursor();
+        find.where(where.get<Condition>());
+        break;
     case WhereType::MULTI_COND:
-        return this->txn.find(className).where(where.get<MultiCondition>()).getCursor();
+        find.where(where.get<MultiCondition>());
+        break;
     case WhereType::NO_COND:
     default:
-        return this->txn.find(className).getCursor();
-    }
-}
-
-ResultSet Context::selectWhere(ResultSet& input, const Where& where)
-{
-    if (where.type == WhereType::NO_COND || input.size() == 0) {
-        return move(input);
-    } else /* if (where.type == WhereType::CONDITION || where.type == WhereType::MULTI_COND) */ {
-        static MultiCondition alwaysTrue = Condition(RECORD_ID_PROPERTY) || !Condition(RECORD_ID_PROPERTY);
-        MultiCondition exp = (where.type == WhereType::MULTI_COND
-                ? where.get<MultiCondition>()
-                : where.get<Condition>() && alwaysTrue);
-        return Context::executeCondition(this->txn, input, exp);
+        break;
     }
+    return find;
 }
 
-ResultSet Context::selectProjection(ResultSet& input, const vector<Projection> projs)
+ResultSet Context::selectProjection(Transaction& txn, ResultSet& input, const vector<Projection> projs)
 {
     if (projs.empty()) {
         return move(input);
@@ -588,71 +989,157 @@ ResultSet Context::selectProjection(ResultSet& input, const vector<Projection> p
     if (projs.size() == 1
         && projs[0].type == ProjectionType::FUNCTION
         && projs[0].get<Function>().isExpand()) {
-        projs[0].get<Function>().executeExpand(this->txn, input);
+        projs[0].get<Function>().executeExpand(txn, input);
         return move(input);
     }
 
-    bool aggregated = false;
-    Record tmpRec {};
     for (const Projection& proj : projs) {
-        if (proj.type == ProjectionType::FUNCTION) {
-            const Function& func = proj.get<Function>();
-            if (func.isAggregateResult()) {
-                tmpRec.set(func.name, func.executeAggregateResult(input));
-                aggregated = true;
-            } else if (func.isExpand()) {
-                throw NOGDB_SQL_ERROR(NOGDB_SQL_INVALID_PROJECTION);
-            }
+        if (proj.type == ProjectionType::FUNCTION && proj.get<Function>().isExpand()) {
+            throw NOGDB_SQL_ERROR(NOGDB_SQL_INVALID_PROJECTION);
         }
     }
 
-    if (aggregated) {
-        // if input is not empty, use last record for other projection.
-        if (!input.empty()) {
-            const Result& last = input.back();
-            PropertyMapType mapProps = Context::getPropertyMapTypeFromClassDescriptor(this->txn, last.descriptor.rid.first);
-            for (const Projection& proj : projs) {
-                if (proj.type != ProjectionType::FUNCTION || proj.get<Function>().isAggregateResult() == false) {
-                    tmpRec.set(to_string(proj), Context::getProjectionItem(this->txn, last, proj, mapProps));
-                }
-            }
+    ResultSet results {};
+    for (const Result& in : input) {
+        Record record {};
+        PropertyMapType mapProps = Context::getPropertyMapTypeFromClassDescriptor(txn, in.descriptor.rid.first);
+        for (const Projection& proj : projs) {
+            record.set(to_string(proj), Context::getProjectionItem(txn, in, proj, mapProps));
         }
-        return ResultSet({ Result(RecordDescriptor(CLASS_DESCDRIPTOR_TEMPORARY, 0), move(tmpRec)) });
-    } else {
-        ResultSet results {};
-        for (const Result& in : input) {
-            Record record {};
-            PropertyMapType mapProps = Context::getPropertyMapTypeFromClassDescriptor(this->txn, in.descriptor.rid.first);
-            for (const Projection& proj : projs) {
-                record.set(to_string(proj), Context::getProjectionItem(this->txn, in, proj, mapProps));
-            }
-            if (!record.empty()) {
-                results.emplace_back(nogdb::RecordDescriptor(CLASS_DESCDRIPTOR_TEMPORARY, results.size()),
-                    move(record));
-            }
+        if (!record.empty()) {
+            results.emplace_back(nogdb::RecordDescriptor(CLASS_DESCDRIPTOR_TEMPORARY, results.size()),
+                move(record));
         }
-        return results;
     }
+    return results;
 }
 
-ResultSet Context::selectGroupBy(ResultSet& input, const string& group)
+ResultSet Context::selectGroupBy(Transaction& txn, RowSource& input, const vector<string>& group, const vector<Projection>& projs)
 {
+    struct Group {
+        vector<Aggregator> aggregators;
+        Result last;
+        bool hasRow;
+        size_t lastPosition;
+    };
+
+    // a group key naming a projection is the value of that projection, otherwise it is a property of the rows
+    vector<const Projection*> keys {};
+    for (const string& key : group) {
+        auto proj = find_if(projs.cbegin(), projs.cend(), [&key](const Projection& p) {
+            return Context::getAggregate(p) == nullptr && to_string(p) == key;
+        });
+        keys.push_back(proj != projs.cend() ? &(*proj) : nullptr);
+    }
+    for (const Projection& proj : projs) {
+        if (proj.type == ProjectionType::FUNCTION && proj.get<Function>().isExpand()) {
+            throw NOGDB_SQL_ERROR(NOGDB_SQL_INVALID_PROJECTION);
+        }
+    }
+    // the last row of a group is kept only for the projections which are not aggregated
+    auto needsRow = projs.empty() || any_of(projs.cbegin(), projs.cend(), [](const Projection& proj) {
+        return Context::getAggregate(proj) == nullptr;
+    });
+    auto newGroup = [&projs]() {
+        Group newGroup { {}, Result {}, false, 0 };
+        for (const Projection& proj : projs) {
+            if (const Function* func = Context::getAggregate(proj)) {
+                newGroup.aggregators.emplace_back(*func);
+            }
+        }
+        return newGroup;
+    };
+
+    vector<Group> groups {};
+    unordered_map<string, size_t> groupIndexes {};
     if (group.empty()) {
-        return move(input);
+        // without GROUP BY all rows are aggregated into one row, even when there is no row
+        groups.push_back(newGroup());
     }
+    PropertyMapType mapProps {};
+    ClassId previousClassID = -1;
+    size_t position = 0;
+    string key {};
+    while (input.next()) {
+        const Result& in = input.get();
+        if (in.descriptor.rid.first != previousClassID) {
+            mapProps = Context::getPropertyMapTypeFromClassDescriptor(txn, in.descriptor.rid.first);
+            previousClassID = in.descriptor.rid.first;
+        }
+        size_t groupIndex = 0;
+        if (!group.empty()) {
+            key.clear();
+            for (size_t i = 0; i < group.size(); ++i) {
+                Bytes value = (keys[i] != nullptr)
+                    ? Context::getProjectionItem(txn, in, *keys[i], mapProps)
+                    : in.record.get(group[i]);
+                uint64_t size = value.size();
+                key.append(reinterpret_cast<const char*>(&size), sizeof(size));
+                key.append(reinterpret_cast<const char*>(value.getRaw()), value.size());
+            }
+            auto found = groupIndexes.emplace(key, groups.size());
+            if (found.second) {
+                groups.push_back(newGroup());
+            }
+            groupIndex = found.first->second;
+        }
 
-    set<Bytes> grouped;
-    for (ResultSet::reverse_iterator in = input.rbegin(); in != input.rend(); in++) {
-        if (grouped.find(in->record.get(group)) == grouped.end()) {
-            grouped.insert(in->record.get(group));
-        } else {
-            input.erase(next(in).base());
+        Group& current = groups[groupIndex];
+        auto aggregator = current.aggregators.begin();
+        for (const Projection& proj : projs) {
+            if (const Function* func = Context::getAggregate(proj)) {
+                (aggregator++)->add(func->args.empty()
+                        ? Bytes()
+                        : Context::getProjectionItem(txn, in, func->args.front(), mapProps));
+            }
         }
+        if (needsRow) {
+            current.last = in;
+            current.hasRow = true;
+        }
+        current.lastPosition = position++;
     }
-    return move(input);
+
+    // groups are ordered by their last rows
+    sort(groups.begin(), groups.end(), [](const Group& lhs, const Group& rhs) {
+        return lhs.lastPosition < rhs.lastPosition;
+    });
+    ResultSet results {};
+    for (Group& current : groups) {
+        if (projs.empty()) {
+            results.push_back(move(current.last));
+            continue;
+        }
+        Record record {};
+        PropertyMapType lastProps = current.hasRow
+            ? Context::getPropertyMapTypeFromClassDescriptor(txn, current.last.descriptor.rid.first)
+            : PropertyMapType {};
+        auto aggregator = current.aggregators.cbegin();
+        for (const Projection& proj : projs) {
+            if (Context::getAggregate(proj) != nullptr) {
+                record.set(to_string(proj), (aggregator++)->result());
+            } else if (current.hasRow) {
+                record.set(to_string(proj), Context::getProjectionItem(txn, current.last, proj, lastProps));
+            }
+        }
+        if (!record.empty()) {
+            results.emplace_back(nogdb::RecordDescriptor(CLASS_DESCDRIPTOR_TEMPORARY, results.size()), move(record));
+        }
+    }
+    return results;
 }
 
 ResultSet Context::traversePrivate(const TraverseArgs& args)
+{
+    auto traverse = this->traverseBuilder(args);
+    try {
+        return traverse.get();
+    } catch (...) {
+        throw Context::getTraverseError(args);
+    }
+}
+
+nogdb::TraverseOperationBuilder Context::traverseBuilder(const TraverseArgs& args)
 {
     if (args.minDepth < 0 || args.minDepth > UINT_MAX) {
         throw NOGDB_SQL_ERROR(NOGDB_SQL_INVALID_TRAVERSE_MIN_DEPTH);
@@ -664,58 +1151,205 @@ ResultSet Context::traversePrivate(const TraverseArgs& args)
     try {
         auto func = args.direction + args.strategy;
         utils::string::toUpperCase(func);
-        if (func == "INDEPTH_FIRST" || func == "INBREADTH_FIRST") {
-            auto traverse = this->txn.traverseIn(*args.root.begin());
-            if (args.root.size() > 1) {
-                for(auto rdesc = std::next(args.root.begin()); rdesc != args.root.end(); ++rdesc) {
-                    traverse.addSource(*rdesc);
-                }
+        auto isDepthFirst = strcasecmp("DEPTH_FIRST", args.strategy.c_str()) == 0;
+        auto traverse = (func == "INDEPTH_FIRST" || func == "INBREADTH_FIRST")
+            ? this->txn.traverseIn(*args.root.begin())
+            : (func == "OUTDEPTH_FIRST" || func == "OUTBREADTH_FIRST")
+                ? this->txn.traverseOut(*args.root.begin())
+                : (func == "ALLDEPTH_FIRST" || func == "ALLBREADTH_FIRST")
+                    ? this->txn.traverse(*args.root.begin())
+                    : throw 0;
+        if (args.root.size() > 1) {
+            for (auto rdesc = std::next(args.root.begin()); rdesc != args.root.end(); ++rdesc) {
+                traverse.addSource(*rdesc);
             }
-            return traverse
-                .minDepth(args.minDepth)
-                .maxDepth(args.maxDepth)
-                .whereE(GraphFilter {}.only(args.filter))
-                .get();
-        } else if (func == "OUTDEPTH_FIRST" || func == "OUTBREADTH_FIRST") {
-            auto traverse = this->txn.traverseOut(*args.root.begin());
-            if (args.root.size() > 1) {
-                for(auto rdesc = std::next(args.root.begin()); rdesc != args.root.end(); ++rdesc) {
-                    traverse.addSource(*rdesc);
-                }
-            }
-            return traverse
-                .minDepth(args.minDepth)
-                .maxDepth(args.maxDepth)
-                .whereE(GraphFilter {}.only(args.filter))
-                .get();
-        } else if (func == "ALLDEPTH_FIRST" || func == "ALLBREADTH_FIRST") {
-            auto traverse = this->txn.traverse(*args.root.begin());
-            if (args.root.size() > 1) {
-                for(auto rdesc = std::next(args.root.begin()); rdesc != args.root.end(); ++rdesc) {
-                    traverse.addSource(*rdesc);
-                }
-            }
-            return traverse
-                .minDepth(args.minDepth)
-                .maxDepth(args.maxDepth)
-                .whereE(GraphFilter {}.only(args.filter))
-                .get();
-        } else {
-            throw 0;
         }
+        if (isDepthFirst) {
+            traverse.depthFirst();
+        }
+        traverse
+            .minDepth(args.minDepth)
+            .maxDepth(args.maxDepth)
+            .whereE(GraphFilter {}.only(args.filter));
+        if (args.where.type != WhereType::NO_COND) {
+            traverse.whereV(GraphFilter { Context::getMultiCondition(args.where) });
+        }
+        return traverse;
     } catch (...) {
-        if (strcasecmp("IN", args.direction.c_str()) != 0
-            && strcasecmp("OUT", args.direction.c_str()) != 0
-            && strcasecmp("ALL", args.direction.c_str()) != 0) {
-            throw NOGDB_SQL_ERROR(NOGDB_SQL_INVALID_TRAVERSE_DIRECTION);
-        } else /*if (strcasecmp("DEPTH_FIRST", strategy.c_str()) != 0
+        throw Context::getTraverseError(args);
+    }
+}
+
+nogdb::SQLError Context::getTraverseError(const TraverseArgs& args)
+{
+    if (strcasecmp("IN", args.direction.c_str()) != 0
+        && strcasecmp("OUT", args.direction.c_str()) != 0
+        && strcasecmp("ALL", args.direction.c_str()) != 0) {
+        return NOGDB_SQL_ERROR(NOGDB_SQL_INVALID_TRAVERSE_DIRECTION);
+    } else /*if (strcasecmp("DEPTH_FIRST", strategy.c_str()) != 0
                 && strcasecmp("BREADTH_FIRST", strategy.c_str()) != 0) */
-        {
-            throw NOGDB_SQL_ERROR(NOGDB_SQL_INVALID_TRAVERSE_STRATEGY);
+    {
+        return NOGDB_SQL_ERROR(NOGDB_SQL_INVALID_TRAVERSE_STRATEGY);
+    }
+}
+
+unique_ptr<RowSource> Context::selectStream(const SelectArgs& stmt)
+{
+    auto rows = this->selectStream(stmt.from, stmt.where, stmt.skip, stmt.limit);
+    const auto& projs = stmt.projections;
+    const auto& group = stmt.group;
+    if (!group.empty() || any_of(projs.cbegin(), projs.cend(), [](const Projection& proj) { return Context::getAggregate(proj) != nullptr; })) {
+        // rows are aggregated as they are pulled, so only one row per group is ever kept
+        // a streamed statement is read after its context is gone, so only the transaction is kept
+        Transaction& txn = this->txn;
+        return this->stage(new MaterializedSource("GROUP", move(rows),
+            [&txn, group, projs](RowSource& input) { return Context::selectGroupBy(txn, input, group, projs); }));
+    }
+    if (any_of(projs.cbegin(), projs.cend(), [](const Projection& proj) {
+            return proj.type == ProjectionType::FUNCTION && proj.get<Function>().isExpand();
+        })) {
+        // an expanded row may produce many rows
+        Transaction& txn = this->txn;
+        return this->stage(new MaterializedSource("EXPAND", move(rows), [&txn, projs](RowSource& input) {
+            ResultSet result = Context::collect(input);
+            return Context::selectProjection(txn, result, projs);
+        }));
+    }
+    if (!projs.empty()) {
+        rows = this->stage(new ProjectionStage(this->txn, move(rows), projs));
+    }
+    return rows;
+}
+
+unique_ptr<RowSource> Context::selectStream(const Target& target_, const Where& where_, int skip, int limit)
+{
+    Target target = target_;
+    Where where = where_;
+    this->pushDown(target, where, skip, limit);
+
+    unique_ptr<RowSource> rows {};
+    switch (target.type) {
+    case TargetType::CLASS: {
+        // the condition of a class target is evaluated by the find operation itself
+        string& className = target.get<string>();
+        ClassType type = Context::findClassType(this->txn, className);
+        if (type != ClassType::VERTEX && type != ClassType::EDGE) {
+            throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_INVALID_CLASSTYPE);
+        }
+        rows = this->stage(new CursorSource(this->findBuilder(className, where)));
+        return this->limit(move(rows), skip, limit);
+    }
+
+    case TargetType::RIDS:
+        rows = this->stage(new RecordSource(this->txn, target.get<RecordDescriptorSet>()));
+        break;
+
+    case TargetType::NESTED:
+        rows = this->selectStream(target.get<SelectArgs>());
+        break;
+
+    case TargetType::NESTED_TRAVERSE:
+        rows = this->traverseStream(target.get<TraverseArgs>());
+        break;
+
+    case TargetType::NO_TARGET:
+    default:
+        return this->stage(new MaterializedSource("NONE", nullptr, nullptr));
+    }
+    if (where.type != WhereType::NO_COND) {
+        rows = this->stage(new WhereStage(this->txn, move(rows), Context::getMultiCondition(where)));
+    }
+    return this->limit(move(rows), skip, limit);
+}
+
+unique_ptr<RowSource> Context::traverseStream(const TraverseArgs& args)
+{
+    auto traverse = this->traverseBuilder(args);
+    try {
+        return this->stage(new TraverseSource(traverse.getStream()));
+    } catch (...) {
+        throw Context::getTraverseError(args);
+    }
+}
+
+unique_ptr<RowSource> Context::stage(RowSource* source) const
+{
+    auto rows = unique_ptr<RowSource>(source);
+    if (this->profiling) {
+        rows = unique_ptr<RowSource>(new ProfileStage(move(rows)));
+    }
+    return rows;
+}
+
+unique_ptr<RowSource> Context::limit(unique_ptr<RowSource>&& rows, int skip, int limit) const
+{
+    if (skip <= 0 && limit < 0) {
+        return move(rows);
+    }
+    return this->stage(new LimitStage(move(rows), skip, limit));
+}
+
+void Context::explainPrivate(const function<unique_ptr<RowSource>()>& build)
+{
+    try {
+        auto rows = build();
+        if (this->profiling) {
+            while (rows->next()) {
+            }
         }
+        this->rc = SQL_OK;
+        this->result = SQL::Result(new QueryPlanNode(rows->plan()));
+    } catch (const Error& e) {
+        this->rc = SQL_ERROR;
+        this->result = SQL::Result(new Error(e));
     }
 }
 
+ResultSet Context::collect(RowSource& rows)
+{
+    ResultSet result {};
+    while (rows.next()) {
+        result.push_back(rows.get());
+    }
+    return result;
+}
+
+const Function* Context::getAggregate(const Projection& proj)
+{
+    if (proj.type == ProjectionType::FUNCTION && proj.get<Function>().isAggregateResult()) {
+        return &proj.get<Function>();
+    } else if (proj.type == ProjectionType::ALIAS) {
+        return Context::getAggregate(proj.get<pair<Projection, string>>().first);
+    } else {
+        return nullptr;
+    }
+}
+
+nogdb::MultiCondition Context::getMultiCondition(const Where& where)
+{
+    static MultiCondition alwaysTrue = Condition(RECORD_ID_PROPERTY) || !Condition(RECORD_ID_PROPERTY);
+    return (where.type == WhereType::MULTI_COND
+            ? where.get<MultiCondition>()
+            : where.get<Condition>() && alwaysTrue);
+}
+
+Where Context::mergeWhere(const Where& lhs, const Where& rhs)
+{
+    if (lhs.type == WhereType::NO_COND) {
+        return rhs;
+    } else if (rhs.type == WhereType::NO_COND) {
+        return lhs;
+    }
+    auto merged = (lhs.type == WhereType::CONDITION)
+        ? ((rhs.type == WhereType::CONDITION)
+                  ? lhs.get<Condition>() && rhs.get<Condition>()
+                  : lhs.get<Condition>() && rhs.get<MultiCondition>())
+        : ((rhs.type == WhereType::CONDITION)
+                  ? lhs.get<MultiCondition>() && rhs.get<Condition>()
+                  : lhs.get<MultiCondition>() && rhs.get<MultiCondition>());
+    return Where(WhereType::MULTI_COND, make_shared<MultiCondition>(move(merged)));
+}
+
 Bytes Context::getProjectionItem(Transaction& txn, const Result& input, const Projection& proj, const PropertyMapType& map)
 {
     switch (proj.type) {
@@ -859,39 +1493,11 @@ nogdb::PropertyMapType Context::getPropertyMapTypeFromClassDescriptor(Transactio
 ResultSet Context::executeCondition(Transaction& txn, const ResultSet& input, const MultiCondition& conds)
 {
     ResultSet result {};
-    PropertyMapType mapProp {};
-    ClassId previousClassID = -1;
+    ConditionFilter filter { txn, conds };
     for (auto in = input.begin(); in != input.end(); in++) {
-        ClassId classID = in->descriptor.rid.first;
-        if (classID == (ClassId)CLASS_DESCDRIPTOR_TEMPORARY) {
-            mapProp.clear();
-            mapProp[RECORD_ID_PROPERTY] = PropertyType::TEXT;
-            mapProp[CLASS_NAME_PROPERTY] = PropertyType::TEXT;
-            mapProp[DEPTH_PROPERTY] = PropertyType::UNSIGNED_INTEGER;
-            mapProp[VERSION_PROPERTY] = PropertyType::UNSIGNED_BIGINT;
-            for (const auto& prop : in->record.getAll()) {
-                mapProp[prop.first] = prop.second.type();
-            }
-        } else if (classID != previousClassID) {
-            mapProp.clear();
-            mapProp[RECORD_ID_PROPERTY] = PropertyType::TEXT;
-            mapProp[CLASS_NAME_PROPERTY] = PropertyType::TEXT;
-            mapProp[DEPTH_PROPERTY] = PropertyType::UNSIGNED_INTEGER;
-            mapProp[VERSION_PROPERTY] = PropertyType::UNSIGNED_BIGINT;
-            const ClassDescriptor classDescriptor = txn.getClass(classID);
-            const vector<PropertyDescriptor> properties = txn.getProperties(classDescriptor);
-            for (const auto& p : properties) {
-                mapProp[p.name] = p.type;
-            }
-        } else /* if (classID == previousClassID) */ {
-            // no-op;
-        }
-
-        if (conds.execute(in->record.toBaseRecord(), mapProp)) {
+        if (filter(*in)) {
             result.push_back(move(*in));
         }
-
-        previousClassID = classID;
     }
     return result;
 }
@@ -26,6 +26,23 @@
 
 namespace nogdb {
 namespace sql_parser {
+    /*
+     * A source of rows pulled one at a time by a streamed result. Every stage of a
+     * streamed select pulls the rows of the stage that it is built on.
+     */
+    class RowSource {
+    public:
+        virtual ~RowSource() noexcept = default;
+
+        // moves to the next row, and returns false once every row has been pulled
+        virtual bool next() = 0;
+
+        virtual const Result& get() const = 0;
+
+        // the operator of this stage and of the stages it pulls its rows from
+        virtual QueryPlanNode plan() const = 0;
+    };
+
     /*
      * An SQL parser context. A reference of this structure is passed through
      * the parser and down into all the parser action routine in order to
@@ -46,6 +63,12 @@ namespace sql_parser {
             SQL_ERROR,
         } rc { SQL_OK };
         SQL::Result result;
+        // SELECT and TRAVERSE statements return a cursor instead of a whole result set
+        bool streaming { false };
+        // every stage of a PROFILE statement is measured
+        bool profiling { false };
+        // a traversal filter does not know the depth of a vertex, so a condition on it cannot be pushed into one
+        bool hasDepthProperty { false };
 
         // parser error.
         void syntax_error(int tokenType, Token& token)
@@ -80,6 +103,10 @@ namespace sql_parser {
         // VERTEX operations
         void createVertex(const Token& tClassName, const nogdb::Record& prop);
 
+        void createVertices(const Token& tClassName,
+            const std::vector<std::string>& props,
+            const std::vector<std::vector<Bytes>>& rows);
+
         // EDGE operations
         void createEdge(const CreateEdgeArgs& args);
 
@@ -102,7 +129,36 @@ namespace sql_parser {
 
         void dropIndex(const Token& tClassName, const Token& tPropName);
 
+        void analyze(const Token& tClassName);
+
+        // EXPLAIN and PROFILE operations
+        void explain(const SelectArgs& args);
+
+        void explain(const TraverseArgs& args);
+
+        void profile(const SelectArgs& args);
+
+        void profile(const TraverseArgs& args);
+
     private:
+        class ConditionFilter;
+
+        class CursorSource;
+
+        class TraverseSource;
+
+        class RecordSource;
+
+        class MaterializedSource;
+
+        class WhereStage;
+
+        class LimitStage;
+
+        class ProjectionStage;
+
+        class ProfileStage;
+
         void newTxnIfRootStmt(bool isRoot, TxnMode mode);
 
         void commitIfRootStmt(bool isRoot);
@@ -117,18 +173,46 @@ namespace sql_parser {
 
         ResultSet select(const RecordDescriptorSet& rids);
 
+        void pushDown(Target& target, Where& where, int& skip, int& limit) const;
+
         ResultSetCursor selectVertex(const string& className, const Where& where);
 
         ResultSetCursor selectEdge(const string& className, const Where& where);
 
-        ResultSet selectWhere(ResultSet& input, const Where& where);
+        FindOperationBuilder findBuilder(const string& className, const Where& where);
 
-        ResultSet selectProjection(ResultSet& input, const vector<Projection> projs);
+        static ResultSet selectProjection(Transaction& txn, ResultSet& input, const vector<Projection> projs);
 
-        ResultSet selectGroupBy(ResultSet& input, const string& group);
+        static ResultSet
+        selectGroupBy(Transaction& txn, RowSource& input, const vector<string>& group, const vector<Projection>& projs);
 
         ResultSet traversePrivate(const TraverseArgs& stmt);
 
+        TraverseOperationBuilder traverseBuilder(const TraverseArgs& args);
+
+        unique_ptr<RowSource> selectStream(const SelectArgs& stmt);
+
+        unique_ptr<RowSource> selectStream(const Target& target, const Where& where, int skip, int limit);
+
+        unique_ptr<RowSource> traverseStream(const TraverseArgs& args);
+
+        unique_ptr<RowSource> stage(RowSource* source) const;
+
+        unique_ptr<RowSource> limit(unique_ptr<RowSource>&& rows, int skip, int limit) const;
+
+        void explainPrivate(const function<unique_ptr<RowSource>()>& build);
+
+        static ResultSet collect(RowSource& rows);
+
+        // the aggregate function of a projection, or nullptr if it is not aggregated
+        static const Function* getAggregate(const Projection& proj);
+
+        static MultiCondition getMultiCondition(const Where& where);
+
+        static Where mergeWhere(const Where& lhs, const Where& rhs);
+
+        static SQLError getTraverseError(const TraverseArgs& args);
+
         static Bytes getProjectionItem(Transaction& txn, const Result& input, const Projection& proj, const PropertyMapType& map);
 
         static Bytes
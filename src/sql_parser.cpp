@@ -0,0 +1,3787 @@
+/*
+
+January, 2016.  Sample class-based version.
+#define LEMON_SUPER as the name of a class which overrides lemon_base<TokenType>.  
+The parser will be implemented in terms of that.
+add a %code section to instantiate it.
+ */
+
+/*
+** 2000-05-29
+**
+** The author disclaims copyright to this source code.  In place of
+** a legal notice, here is a blessing:
+**
+**    May you do good and not evil.
+**    May you find forgiveness for yourself and forgive others.
+**    May you share freely, never taking more than you give.
+**
+*************************************************************************
+** Driver template for the LEMON parser generator.
+**
+** The "lemon" program processes an LALR(1) input grammar file, then uses
+** this template to construct a parser.  The "lemon" program inserts text
+** at each "%%" line.  Also, any "P-a-r-s-e" identifer prefix (without the
+** interstitial "-" characters) contained in this template is changed into
+** the value of the %name directive from the grammar.  Otherwise, the content
+** of this template is copied straight through into the generate parser
+** source file.
+**
+** The following is the concatenation of all %include directives from the
+** input grammar file:
+*/
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+#include <type_traits>
+#include <new>
+#include <memory>
+#include <algorithm>
+
+namespace {
+
+  // use std::allocator etc?
+
+
+  // this is here so you can do something like Parse(void *, int, my_token &&) or (... const my_token &)
+  template<class T> struct yy_fix_type {
+    typedef typename std::remove_const<typename std::remove_reference<T>::type>::type type;
+  };
+
+  template<>
+  struct yy_fix_type<void> {
+    typedef struct {} type;
+  };
+
+  template<class T, class... Args>
+  typename yy_fix_type<T>::type &yy_constructor(void *vp, Args&&... args ) {
+    typedef typename yy_fix_type<T>::type TT;
+    TT *tmp = ::new(vp) TT(std::forward<Args>(args)...);
+    return *tmp;
+  }
+
+
+  template<class T>
+  typename yy_fix_type<T>::type &yy_cast(void *vp) {
+    typedef typename yy_fix_type<T>::type TT;
+    return *(TT *)vp;
+  }
+
+
+  template<class T>
+  void yy_destructor(void *vp) {
+    typedef typename yy_fix_type<T>::type TT;
+    ((TT *)vp)->~TT();
+  }
+
+
+  template<class T>
+  void yy_destructor(T &t) {
+    t.~T();
+  }
+
+
+
+  template<class T>
+  void yy_move(void *dest, void *src) {
+    typedef typename yy_fix_type<T>::type TT;
+
+    TT &tmp = yy_cast<TT>(src);
+    yy_constructor<TT>(dest, std::move(tmp));
+    yy_destructor(tmp);
+  }
+
+
+  // this is to destruct references in the event of an exception.
+  // only the LHS needs to be deleted -- other items remain on the 
+  // shift/reduce stack in a valid state 
+  // (as long as the destructor) doesn't throw!
+  template<class T>
+  struct yy_auto_deleter {
+
+    yy_auto_deleter(T &t) : ref(t), enaged(true)
+    {}
+    yy_auto_deleter(const yy_auto_deleter &) = delete;
+    yy_auto_deleter(yy_auto_deleter &&) = delete;
+    yy_auto_deleter &operator=(const yy_auto_deleter &) = delete;
+    yy_auto_deleter &operator=(yy_auto_deleter &&) = delete;
+
+    ~yy_auto_deleter() {
+      if (enaged) yy_destructor(ref);
+    }
+    void cancel() { enaged = false; }
+
+  private:
+    T& ref;
+    bool enaged=false;
+  };
+
+  template<class T>
+  class yy_storage {
+  private:
+    typedef typename yy_fix_type<T>::type TT;
+
+  public:
+    typedef typename std::conditional<
+      std::is_trivial<TT>::value,
+      TT,
+      typename std::aligned_storage<sizeof(TT),alignof(TT)>::type
+    >::type type;
+  };
+
+}
+
+/************ Begin %include sections from the grammar ************************/
+#line 38 "/root/repo/src/sql_parser.y"
+
+#include <stdio.h>
+#include <assert.h>
+#include <set>
+#include "constant.hpp"
+#include "sql.hpp"
+#include "sql_context.hpp"
+
+using namespace std;
+using namespace nogdb::sql_parser;
+
+using nogdb::RecordDescriptor;
+using nogdb::MultiCondition;
+
+#define LEMON_SUPER Context
+
+#line 153 "/root/repo/src/sql_parser.cpp"
+/**************** End of %include directives **********************************/
+/* These constants specify the various numeric values for terminal symbols
+** in a format understandable to "makeheaders".  This section is blank unless
+** "lemon" is run with the "-m" command-line option.
+***************** Begin makeheaders token definitions *************************/
+/**************** End makeheaders token definitions ***************************/
+
+/* The next sections is a series of control #defines.
+** various aspects of the generated parser.
+**    YYCODETYPE         is the data type used to store the integer codes
+**                       that represent terminal and non-terminal symbols.
+**                       "unsigned char" is used if there are fewer than
+**                       256 symbols.  Larger types otherwise.
+**    YYNOCODE           is a number of type YYCODETYPE that is not used for
+**                       any terminal or nonterminal symbol.
+**    YYFALLBACK         If defined, this indicates that one or more tokens
+**                       (also known as: "terminal symbols") have fall-back
+**                       values which should be used if the original symbol
+**                       would not parse.  This permits keywords to sometimes
+**                       be used as identifiers, for example.
+**    YYACTIONTYPE       is the data type used for "action codes" - numbers
+**                       that indicate what to do in response to the next
+**                       token.
+**    ParseTOKENTYPE     is the data type used for minor type for terminal
+**                       symbols.  Background: A "minor type" is a semantic
+**                       value associated with a terminal or non-terminal
+**                       symbols.  For example, for an "ID" terminal symbol,
+**                       the minor type might be the name of the identifier.
+**                       Each non-terminal can have a different minor type.
+**                       Terminal symbols all have the same minor type, though.
+**                       This macros defines the minor type for terminal 
+**                       symbols.
+**    YYMINORTYPE        is the data type used for all minor types.
+**                       This is typically a union of many types, one of
+**                       which is ParseTOKENTYPE.  The entry in the union
+**                       for terminal symbols is called "yy0".
+**    YYSTACKDEPTH       is the maximum depth of the parser's stack.  If
+**                       zero the stack is dynamically sized using realloc()
+**    YYERRORSYMBOL      is the code number of the error symbol.  If not
+**                       defined, then do no error processing.
+**    YYNSTATE           the combined number of states.
+**    YYNRULE            the number of rules in the grammar
+**    YY_MAX_SHIFT       Maximum value for shift actions
+**    YY_MIN_SHIFTREDUCE Minimum value for shift-reduce actions
+**    YY_MAX_SHIFTREDUCE Maximum value for shift-reduce actions
+**    YY_MIN_REDUCE      Maximum value for reduce actions
+**    YY_ERROR_ACTION    The yy_action[] code for syntax error
+**    YY_ACCEPT_ACTION   The yy_action[] code for accept
+**    YY_NO_ACTION       The yy_action[] code for no-op
+*/
+#ifndef INTERFACE
+# define INTERFACE 1
+#endif
+/************* Begin control #defines *****************************************/
+#define YYCODETYPE unsigned char
+#define YYNOCODE 118
+#define YYACTIONTYPE unsigned short int
+#define YYWILDCARD 1
+#define ParseTOKENTYPE  Token 
+typedef union {
+  int yyinit;
+  yy_storage<ParseTOKENTYPE>::type yy0;
+  yy_storage<Condition>::type yy12;
+  yy_storage<UpdateArgs>::type yy25;
+  yy_storage<string>::type yy32;
+  yy_storage<vector<vector<Bytes>>>::type yy36;
+  yy_storage<SelectArgs>::type yy54;
+  yy_storage<void *>::type yy61;
+  yy_storage<bool>::type yy65;
+  yy_storage<Target>::type yy76;
+  yy_storage<DeleteVertexArgs>::type yy79;
+  yy_storage<vector<Projection>>::type yy83;
+  yy_storage<void>::type yy97;
+  yy_storage<nogdb::Record>::type yy104;
+  yy_storage<long long>::type yy105;
+  yy_storage<vector<Bytes>>::type yy129;
+  yy_storage<Bytes>::type yy130;
+  yy_storage<DeleteEdgeArgs>::type yy132;
+  yy_storage<vector<string>>::type yy137;
+  yy_storage<Where>::type yy144;
+  yy_storage<TraverseArgs>::type yy164;
+  yy_storage<Projection>::type yy168;
+  yy_storage<RecordDescriptorSet>::type yy197;
+  yy_storage<CreateEdgeArgs>::type yy201;
+  yy_storage<int>::type yy202;
+  yy_storage<shared_ptr<MultiCondition>>::type yy203;
+  yy_storage<RecordDescriptor>::type yy225;
+  yy_storage<set<string>>::type yy232;
+} YYMINORTYPE;
+#ifndef YYSTACKDEPTH
+#define YYSTACKDEPTH 100
+#endif
+#define ParseARG_SDECL
+#define ParseARG_PDECL
+#define ParseARG_FETCH
+#define ParseARG_STORE
+#define YYFALLBACK 1
+#define YYNSTATE             206
+#define YYNRULE              140
+#define YY_MAX_SHIFT         205
+#define YY_MIN_SHIFTREDUCE   315
+#define YY_MAX_SHIFTREDUCE   454
+#define YY_MIN_REDUCE        455
+#define YY_MAX_REDUCE        594
+#define YY_ERROR_ACTION      595
+#define YY_ACCEPT_ACTION     596
+#define YY_NO_ACTION         597
+/************* End control #defines *******************************************/
+namespace {
+
+/* Define the yytestcase() macro to be a no-op if is not already defined
+** otherwise.
+**
+** Applications can choose to define yytestcase() in the %include section
+** to a macro that can assist in verifying code coverage.  For production
+** code the yytestcase() macro should be turned off.  But it is useful
+** for testing.
+*/
+#ifndef yytestcase
+# define yytestcase(X)
+#endif
+
+
+/* Next are the tables used to determine what action to take based on the
+** current state and lookahead token.  These tables are used to implement
+** functions that take a state number and lookahead value and return an
+** action integer.  
+**
+** Suppose the action integer is N.  Then the action is determined as
+** follows
+**
+**   0 <= N <= YY_MAX_SHIFT             Shift N.  That is, push the lookahead
+**                                      token onto the stack and goto state N.
+**
+**   N between YY_MIN_SHIFTREDUCE       Shift to an arbitrary state then
+**     and YY_MAX_SHIFTREDUCE           reduce by rule N-YY_MIN_SHIFTREDUCE.
+**
+**   N between YY_MIN_REDUCE            Reduce by rule N-YY_MIN_REDUCE
+**     and YY_MAX_REDUCE
+**
+**   N == YY_ERROR_ACTION               A syntax error has occurred.
+**
+**   N == YY_ACCEPT_ACTION              The parser accepts its input.
+**
+**   N == YY_NO_ACTION                  No such action.  Denotes unused
+**                                      slots in the yy_action[] table.
+**
+** The action table is constructed as a single large table named yy_action[].
+** Given state S and lookahead X, the action is computed as either:
+**
+**    (A)   N = yy_action[ yy_shift_ofst[S] + X ]
+**    (B)   N = yy_default[S]
+**
+** The (A) formula is preferred.  The B formula is used instead if:
+**    (1)  The yy_shift_ofst[S]+X value is out of range, or
+**    (2)  yy_lookahead[yy_shift_ofst[S]+X] is not equal to X, or
+**    (3)  yy_shift_ofst[S] equal YY_SHIFT_USE_DFLT.
+** (Implementation note: YY_SHIFT_USE_DFLT is chosen so that
+** YY_SHIFT_USE_DFLT+X will be out of range for all possible lookaheads X.
+** Hence only tests (1) and (2) need to be evaluated.)
+**
+** The formulas above are for computing the action when the lookahead is
+** a terminal symbol.  If the lookahead is a non-terminal (as occurs after
+** a reduce action) then the yy_reduce_ofst[] array is used in place of
+** the yy_shift_ofst[] array and YY_REDUCE_USE_DFLT is used in place of
+** YY_SHIFT_USE_DFLT.
+**
+** The following are the tables generated in this section:
+**
+**  yy_action[]        A single table containing all actions.
+**  yy_lookahead[]     A table containing the lookahead for each entry in
+**                     yy_action.  Used to detect hash collisions.
+**  yy_shift_ofst[]    For each state, the offset into yy_action for
+**                     shifting terminals.
+**  yy_reduce_ofst[]   For each state, the offset into yy_action for
+**                     shifting non-terminals after a reduce.
+**  yy_default[]       Default action for each state.
+**
+*********** Begin parsing tables **********************************************/
+#define YY_ACTTAB_COUNT (510)
+static const YYACTIONTYPE yy_action[] = {
+ /*     0 */   178,   91,  596,  205,  512,  113,  494,  106,   93,  161,
+ /*    10 */   423,  168,  147,   16,  146,  515,  164,   16,  446,  446,
+ /*    20 */   446,  446,  446,  446,  167,  548,  111,  142,  491,  166,
+ /*    30 */   494,    2,   97,  166,  145,  144,  143,  490,   96,   55,
+ /*    40 */    54,  552,  446,  446,  446,   10,   11,  122,   43,   72,
+ /*    50 */   491,  118,  494,   40,   41,   39,   38,   42,   27,   26,
+ /*    60 */   131,  181,  465,  180,   23,   22,   31,  404,  404,  176,
+ /*    70 */   176,  446,  446,  446,  446,  446,  446,   32,  474,  120,
+ /*    80 */    33,  585,   48,   90,  446,  446,  446,  446,  446,  446,
+ /*    90 */   194,  446,  446,  446,  446,  446,  446,  175,  117,  173,
+ /*   100 */     4,   34,  404,  404,   90,  404,  404,  482,  446,  446,
+ /*   110 */   446,  501,   47,   59,   53,  202,  202,   13,  564,  333,
+ /*   120 */    48,  171,  203,  203,  562,  194,  582,  580,  194,  136,
+ /*   130 */    35,  132,  127,   36,  113,   37,  135,  446,  446,  446,
+ /*   140 */   446,  446,  446,  552,   46,  552,   52,    9,  116,  128,
+ /*   150 */    47,  129,  444,  349,  349,  475,  120,  446,  446,  446,
+ /*   160 */   446,  446,  446,   16,  108,  490,  585,  585,    4,  490,
+ /*   170 */   578,   71,   71,   90,  117,  173,   90,   74,  491,  166,
+ /*   180 */   494,  488,  491,  585,  494,  585,   57,  182,  517,   59,
+ /*   190 */   560,   90,  113,  183,  590,   90,  558,  171,   90,   90,
+ /*   200 */   576,  491,  113,  494,  192,  184,  404,  404,  413,   94,
+ /*   210 */   585,  185,  556,  121,  574,   95,   67,   86,  554,  123,
+ /*   220 */   113,  189,  571,  475,  120,  124,  102,   79,  154,  194,
+ /*   230 */   491,  157,  494,  101,  491,  583,  494,  179,  452,  453,
+ /*   240 */   585,  581,  579,   12,   14,  191,  577,  575,  464,  573,
+ /*   250 */   572,  570,  569,  568,  585,  567,  566,  565,  543,  542,
+ /*   260 */   551,   99,  585,  138,  410,  410,   90,  502,  585,   90,
+ /*   270 */   323,  585,  140,  197,   80,  585,  137,  585,  195,  193,
+ /*   280 */   564,  585,  585,  174,   85,  139,  585,  585,  186,  585,
+ /*   290 */   585,  585,  585,  585,  109,  585,  585,  585,  585,  585,
+ /*   300 */   585,  548,  111,   50,    3,   60,  548,   65,  337,  141,
+ /*   310 */   141,    1,   49,  148,  148,  149,  149,   75,   75,  151,
+ /*   320 */   151,   76,   76,  155,  155,  156,  156,  158,  158,  105,
+ /*   330 */    77,   77,  160,  160,  355,   80,  104,  383,  383,  406,
+ /*   340 */   406,  385,  385,  169,  169,  170,  170,  172,  172,  177,
+ /*   350 */    50,    8,  336,  336,   62,   60,   10,   11,   12,   14,
+ /*   360 */   114,  409,  409,  513,  119,  364,  364,  366,  366,  190,
+ /*   370 */   190,  327,   46,   15,  326,   46,  196,   64,   68,   68,
+ /*   380 */   198,  198,   88,   88,  199,  199,   89,   89,   69,   18,
+ /*   390 */    17,   70,  510,   52,  508,  152,   73,  150,  390,  159,
+ /*   400 */   519,  153,  471,  162,  110,   78,  126,  547,  125,    6,
+ /*   410 */   188,  201,  187,  395,  469,  394,   83,   81,  130,   82,
+ /*   420 */    84,  133,  204,  393,  392,  391,  378,  371,  369,  367,
+ /*   430 */   330,  328,  389,  399,  321,   28,  318,   98,  320,  100,
+ /*   440 */   317,  103,   29,  388,  387,  107,  165,  124,  340,  112,
+ /*   450 */    24,   58,  163,   56,   30,  353,  352,   25,   44,   11,
+ /*   460 */    14,  423,  344,  405,  587,  457,  345,  115,  322,  319,
+ /*   470 */    61,   87,  346,   20,  343,   21,    5,   19,   51,   63,
+ /*   480 */     7,  316,   66,  134,  315,   92,  457,  457,  457,  457,
+ /*   490 */   457,  457,  457,  457,  457,  457,  457,  457,  457,  457,
+ /*   500 */   457,  457,  457,  457,   45,  457,  457,  397,  457,  200,
+};
+static const YYCODETYPE yy_lookahead[] = {
+ /*     0 */     2,    6,   73,   74,   97,   51,   99,   12,   13,  103,
+ /*    10 */    18,   85,   83,   22,   85,   84,  110,   22,    3,    4,
+ /*    20 */     5,    3,    4,    5,   98,   99,  100,   98,   97,   38,
+ /*    30 */    99,   36,   37,   38,  105,  106,  107,   84,   43,   44,
+ /*    40 */    45,   76,    3,    4,    5,   53,   54,   82,   50,   96,
+ /*    50 */    97,   94,   99,   55,   56,   57,   58,   59,   60,   61,
+ /*    60 */    79,   63,   81,   65,   66,   67,   68,    2,    3,    4,
+ /*    70 */     5,    3,    4,    5,    3,    4,    5,   62,   93,   94,
+ /*    80 */    62,  116,   17,   81,   69,   70,   71,   69,   70,   71,
+ /*    90 */    25,    3,    4,    5,    3,    4,    5,   95,    2,    3,
+ /*   100 */    17,   62,    2,    3,   81,    2,    3,   94,   69,   70,
+ /*   110 */    71,   81,   47,   17,   17,    2,    3,   17,   95,   23,
+ /*   120 */    17,   25,    9,   10,  101,   25,   76,   76,   25,    7,
+ /*   130 */    62,    9,   10,   62,   51,   47,   14,   69,   70,   71,
+ /*   140 */    69,   70,   71,   76,   19,   76,   49,   47,   86,   82,
+ /*   150 */    47,   82,   27,    2,    3,   93,   94,   69,   70,   71,
+ /*   160 */    69,   70,   71,   22,   42,   84,  116,  116,   17,   84,
+ /*   170 */    76,    2,    3,   81,    2,    3,   81,   96,   97,   38,
+ /*   180 */    99,   96,   97,  116,   99,  116,   17,   95,   84,   17,
+ /*   190 */    95,   81,   51,  101,  104,   81,  101,   25,   81,   81,
+ /*   200 */    76,   97,   51,   99,   81,   95,    2,    3,   18,   95,
+ /*   210 */   116,  101,   95,   95,   76,  101,   86,   84,  101,  101,
+ /*   220 */    51,   84,   76,   93,   94,   19,    7,  111,   76,   25,
+ /*   230 */    97,   76,   99,   14,   97,   76,   99,   76,   32,   33,
+ /*   240 */   116,   76,   76,   53,   54,   81,   76,   76,   81,   76,
+ /*   250 */    76,   76,   76,   76,  116,   76,   76,   76,   76,   76,
+ /*   260 */    76,   42,  116,   85,    2,    3,   81,   81,  116,   81,
+ /*   270 */    11,  116,   85,   78,   19,  116,   98,  116,   19,  115,
+ /*   280 */    95,  116,  116,   95,   87,   98,  116,  116,  102,  116,
+ /*   290 */   116,  116,  116,  116,   39,  116,  116,  116,  116,  116,
+ /*   300 */   116,   99,  100,   19,   20,   15,   99,  100,   18,    2,
+ /*   310 */     3,    9,   10,    2,    3,    2,    3,    2,    3,    2,
+ /*   320 */     3,    2,    3,    2,    3,    2,    3,    2,    3,    7,
+ /*   330 */     2,    3,    2,    3,   18,   19,   14,    4,    5,    4,
+ /*   340 */     5,    4,    5,    4,    5,    4,    5,    4,    5,   18,
+ /*   350 */    19,   17,    2,    3,  103,   15,   53,   54,   53,   54,
+ /*   360 */    26,    2,    3,   88,   24,    4,    5,    4,    5,    2,
+ /*   370 */     3,   18,   19,   28,   18,   19,   18,   19,    2,    3,
+ /*   380 */     2,    3,    2,    3,    2,    3,    2,    3,  109,   21,
+ /*   390 */    20,  108,   88,   49,   88,   46,   78,   77,    2,  114,
+ /*   400 */   113,   77,   92,   41,   40,  112,   35,   99,   34,   17,
+ /*   410 */    31,   46,   29,   11,   78,   11,   89,   91,   80,   90,
+ /*   420 */    88,   75,   75,   11,   11,   11,   11,   11,   11,   11,
+ /*   430 */    11,   11,   11,   48,   11,    2,   11,   15,   11,   15,
+ /*   440 */    11,   15,    2,   11,    2,   15,    2,   19,    2,   52,
+ /*   450 */    64,   20,   18,   17,   54,   18,   18,   64,   50,   54,
+ /*   460 */    54,   18,   27,    2,    0,  117,   27,   26,   11,   11,
+ /*   470 */    19,   16,   27,   20,   27,   26,   26,   21,   30,   19,
+ /*   480 */    17,   11,   30,   15,   11,    8,  117,  117,  117,  117,
+ /*   490 */   117,  117,  117,  117,  117,  117,  117,  117,  117,  117,
+ /*   500 */   117,  117,  117,  117,   50,  117,  117,   48,  117,   47,
+};
+#define YY_SHIFT_USE_DFLT (510)
+#define YY_SHIFT_COUNT    (205)
+#define YY_SHIFT_MIN      (-46)
+#define YY_SHIFT_MAX      (477)
+static const short yy_shift_ofst[] = {
+ /*     0 */    -5,  151,  151,  151,  141,   91,   91,   91,   96,  100,
+ /*    10 */   100,  100,  100,  100,  100,  100,   96,   83,   83,   83,
+ /*    20 */    83,   65,   15,   18,   39,   68,   71,   88,   91,   91,
+ /*    30 */    91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+ /*    40 */    91,   91,   91,   91,   91,   91,   91,  103,  103,  169,
+ /*    50 */   172,  204,  204,  204,   -9,   -9,  262,  -46,  -46,  172,
+ /*    60 */   172,  204,  206,  204,  204,  255,  262,  284,   97,  345,
+ /*    70 */   368,  370,  345,  345,  344,  349,  349,  396,  362,  364,
+ /*    80 */   -46,  371,  374,  379,  383,  345,  344,  392,  365,  365,
+ /*    90 */    -2,  122,  113,  219,   -8,  190,  307,  302,  311,  313,
+ /*   100 */   315,  317,  319,  321,  323,  325,  322,  328,  330,  333,
+ /*   110 */   337,  316,  335,  339,  341,  343,  331,  334,  290,  350,
+ /*   120 */   340,  303,  125,  305,  359,  361,  363,  367,  353,  356,
+ /*   130 */   259,  358,  376,  378,  380,  382,  384,  402,  404,  412,
+ /*   140 */   413,  414,  415,  416,  417,  418,  419,  420,  421,  422,
+ /*   150 */   423,  424,  385,  425,  427,  433,  426,  429,  440,  432,
+ /*   160 */   430,  428,  442,  431,  434,  436,  444,  437,  438,  397,
+ /*   170 */   435,  446,  439,  441,  443,  445,  447,  449,  450,  400,
+ /*   180 */   386,  393,  405,  406,  405,  406,  451,  448,  452,  456,
+ /*   190 */   453,  408,  454,  460,  461,  463,  455,  457,  458,  468,
+ /*   200 */   459,  462,  470,  473,  477,  464,
+};
+#define YY_REDUCE_USE_DFLT (-95)
+#define YY_REDUCE_COUNT (89)
+#define YY_REDUCE_MIN   (-94)
+#define YY_REDUCE_MAX   (347)
+static const short yy_reduce_ofst[] = {
+ /*     0 */   -71,  -47,   81,   85,  -74,  -35,   67,   69,   62,   23,
+ /*    10 */    92,   95,  110,  114,  117,  118,  130,  -69,  104,  133,
+ /*    20 */   137,    2,   50,   51,   94,  124,  138,  146,  152,  155,
+ /*    30 */   159,  161,  165,  166,  170,  171,  173,  174,  175,  176,
+ /*    40 */   177,  179,  180,  181,  182,  183,  184,  185,  188,  -93,
+ /*    50 */   -15,  186,  164,  -19,  178,  187,  -94,  202,  207,  -43,
+ /*    60 */    13,   30,   90,  123,  167,  116,  251,  197,  195,  275,
+ /*    70 */   279,  283,  304,  306,  318,  320,  324,  285,  287,  293,
+ /*    80 */   308,  310,  326,  329,  327,  332,  336,  338,  346,  347,
+};
+static const YYACTIONTYPE yy_default[] = {
+ /*     0 */   595,  595,  595,  595,  595,  595,  595,  595,  472,  595,
+ /*    10 */   595,  595,  595,  595,  595,  595,  472,  595,  595,  595,
+ /*    20 */   595,  595,  595,  595,  595,  595,  595,  595,  595,  595,
+ /*    30 */   595,  595,  595,  595,  595,  595,  595,  595,  595,  595,
+ /*    40 */   595,  595,  595,  595,  595,  595,  595,  595,  595,  595,
+ /*    50 */   595,  595,  595,  595,  595,  595,  520,  595,  595,  595,
+ /*    60 */   595,  595,  591,  595,  595,  522,  595,  487,  540,  496,
+ /*    70 */   516,  514,  496,  496,  540,  538,  538,  594,  526,  524,
+ /*    80 */   595,  505,  503,  589,  499,  496,  540,  595,  536,  536,
+ /*    90 */   595,  595,  595,  595,  595,  595,  595,  595,  595,  595,
+ /*   100 */   595,  595,  595,  595,  595,  595,  595,  595,  595,  595,
+ /*   110 */   595,  595,  595,  595,  595,  595,  595,  478,  595,  595,
+ /*   120 */   588,  498,  595,  497,  595,  595,  595,  595,  595,  595,
+ /*   130 */   595,  595,  595,  595,  595,  595,  595,  595,  595,  595,
+ /*   140 */   595,  595,  595,  595,  595,  595,  595,  595,  595,  595,
+ /*   150 */   595,  595,  595,  595,  595,  595,  595,  595,  595,  595,
+ /*   160 */   595,  521,  595,  595,  595,  595,  595,  595,  595,  595,
+ /*   170 */   595,  595,  595,  479,  595,  595,  595,  481,  595,  595,
+ /*   180 */   595,  595,  561,  559,  557,  555,  500,  595,  595,  595,
+ /*   190 */   595,  595,  595,  541,  595,  595,  595,  595,  595,  595,
+ /*   200 */   595,  595,  595,  595,  595,  595,
+};
+/********** End of lemon-generated parsing tables *****************************/
+
+/* The next table maps tokens (terminal symbols) into fallback tokens.  
+** If a construct like the following:
+** 
+**      %fallback ID X Y Z.
+**
+** appears in the grammar, then ID becomes a fallback token for X, Y,
+** and Z.  Whenever one of the tokens X, Y, or Z is input to the parser
+** but it does not parse, the type of the token is changed to ID and
+** the parse is retried before an error is thrown.
+**
+** This feature can be used, for example, to cause some keywords in a language
+** to revert to identifiers if they keyword does not apply in the context where
+** it appears.
+*/
+#ifdef YYFALLBACK
+const YYCODETYPE yyFallback[] = {
+    0,  /*          $ => nothing */
+    0,  /*        ANY => nothing */
+    0,  /*   IDENTITY => nothing */
+    0,  /*     STRING => nothing */
+    0,  /*     SIGNED => nothing */
+    0,  /*   UNSIGNED => nothing */
+    0,  /*     CREATE => nothing */
+    0,  /*      CLASS => nothing */
+    0,  /*    EXTENDS => nothing */
+    0,  /*     VERTEX => nothing */
+    0,  /*       EDGE => nothing */
+    0,  /*       SEMI => nothing */
+    0,  /*      ALTER => nothing */
+    0,  /*       DROP => nothing */
+    0,  /*   PROPERTY => nothing */
+    0,  /*        DOT => nothing */
+    2,  /*     VALUES => IDENTITY */
+    0,  /*         LP => nothing */
+    0,  /*         RP => nothing */
+    0,  /*      COMMA => nothing */
+    0,  /*       FROM => nothing */
+    0,  /*         TO => nothing */
+    0,  /*     SELECT => nothing */
+    0,  /*       STAR => nothing */
+    0,  /*         AS => nothing */
+    0,  /*         AT => nothing */
+    0,  /*         LB => nothing */
+    0,  /*         RB => nothing */
+    0,  /*      WHERE => nothing */
+    0,  /*      GROUP => nothing */
+    0,  /*         BY => nothing */
+    0,  /*      ORDER => nothing */
+    0,  /*        ASC => nothing */
+    0,  /*       DESC => nothing */
+    0,  /*       SKIP => nothing */
+    0,  /*      LIMIT => nothing */
+    0,  /*     UPDATE => nothing */
+    0,  /*     DELETE => nothing */
+    0,  /*   TRAVERSE => nothing */
+    0,  /*   MINDEPTH => nothing */
+    0,  /*   MAXDEPTH => nothing */
+    0,  /*   STRATEGY => nothing */
+    0,  /*      INDEX => nothing */
+    0,  /*    ANALYZE => nothing */
+    2,  /*    EXPLAIN => IDENTITY */
+    2,  /*    PROFILE => IDENTITY */
+};
+#endif /* YYFALLBACK */
+
+/* The following structure represents a single element of the
+** parser's stack.  Information stored includes:
+**
+**   +  The state number for the parser at this level of the stack.
+**
+**   +  The value of the token stored at this level of the stack.
+**      (In other words, the "major" token.)
+**
+**   +  The semantic value stored at this level of the stack.  This is
+**      the information used by the action routines in the grammar.
+**      It is sometimes called the "minor" token.
+**
+** After the "shift" half of a SHIFTREDUCE action, the stateno field
+** actually contains the reduce action for the second half of the
+** SHIFTREDUCE.
+*/
+struct yyStackEntry {
+  YYACTIONTYPE stateno;  /* The state-number, or reduce action in SHIFTREDUCE */
+  YYCODETYPE major;      /* The major token value.  This is the code
+                         ** number for the token at this stack level */
+  YYMINORTYPE minor;     /* The user-supplied minor token value.  This
+                         ** is the value of the token  */
+};
+
+/* The state of the parser is completely contained in an instance of
+** the following structure */
+
+#ifndef LEMON_SUPER
+#error "LEMON_SUPER must be defined."
+#endif
+
+/* outside the class so the templates above are still accessible */
+void yy_destructor(YYCODETYPE yymajor, YYMINORTYPE *yypminor);
+void yy_move(YYCODETYPE yymajor, YYMINORTYPE *yyDest, YYMINORTYPE *yySource);
+
+class yypParser : public LEMON_SUPER {
+  public:
+    //using LEMON_SUPER::LEMON_SUPER;
+
+    template<class ...Args>
+    yypParser(Args&&... args);
+
+    virtual ~yypParser() override final;
+    virtual void parse(int, ParseTOKENTYPE &&) override final;
+
+#ifndef NDEBUG
+    virtual void trace(FILE *, const char *) final override;
+#endif
+
+    virtual void reset() final override;
+    virtual bool will_accept() const final override;
+
+    /*
+    ** Return the peak depth of the stack for a parser.
+    */
+    #ifdef YYTRACKMAXSTACKDEPTH
+    int yypParser::stack_peak(){
+      return yyhwm;
+    }
+    #endif
+
+    const yyStackEntry *begin() const { return yystack; }
+    const yyStackEntry *end() const { return yytos + 1; }
+
+  protected:
+  private:
+  yyStackEntry *yytos;          /* Pointer to top element of the stack */
+#ifdef YYTRACKMAXSTACKDEPTH
+  int yyhwm = 0;                 /* Maximum value of yyidx */
+#endif
+#ifndef YYNOERRORRECOVERY
+  int yyerrcnt = -1;                 /* Shifts left before out of the error */
+#endif
+#if YYSTACKDEPTH<=0
+  int yystksz = 0;                  /* Current side of the stack */
+  yyStackEntry *yystack = nullptr;        /* The parser's stack */
+  yyStackEntry yystk0;          /* First stack entry */
+  int yyGrowStack();
+#else
+  yyStackEntry yystack[YYSTACKDEPTH];  /* The parser's stack */
+  yyStackEntry *yystackEnd;            /* Last entry in the stack */
+#endif
+
+
+
+  void yy_accept();
+  void yy_parse_failed();
+  void yy_syntax_error(int yymajor, ParseTOKENTYPE &yyminor);
+
+  void yy_transfer(yyStackEntry *yySource, yyStackEntry *yyDest);
+
+  void yy_pop_parser_stack();
+  unsigned yy_find_shift_action(int stateno, YYCODETYPE iLookAhead) const;
+  int yy_find_reduce_action(int stateno, YYCODETYPE iLookAhead) const;
+
+  void yy_shift(int yyNewState, int yyMajor, ParseTOKENTYPE &&yypMinor);
+  void yy_reduce(unsigned int yyruleno);
+  void yyStackOverflow();
+
+#ifndef NDEBUG
+  void yyTraceShift(int yyNewState) const;
+#else
+# define yyTraceShift(X)
+#endif
+
+
+#ifndef NDEBUG
+  FILE *yyTraceFILE = 0;
+  const char *yyTracePrompt = 0;
+#endif /* NDEBUG */
+
+  int yyidx() const {
+    return (int)(yytos - yystack);    
+  }
+
+};
+
+
+
+
+#ifndef NDEBUG
+/* 
+** Turn parser tracing on by giving a stream to which to write the trace
+** and a prompt to preface each trace message.  Tracing is turned off
+** by making either argument NULL 
+**
+** Inputs:
+** <ul>
+** <li> A FILE* to which trace output should be written.
+**      If NULL, then tracing is turned off.
+** <li> A prefix string written at the beginning of every
+**      line of trace output.  If NULL, then tracing is
+**      turned off.
+** </ul>
+**
+** Outputs:
+** None.
+*/
+void yypParser::trace(FILE *TraceFILE, const char *zTracePrompt){
+  yyTraceFILE = TraceFILE;
+  yyTracePrompt = zTracePrompt;
+  if( yyTraceFILE==0 ) yyTracePrompt = 0;
+  else if( yyTracePrompt==0 ) yyTraceFILE = 0;
+}
+#endif /* NDEBUG */
+
+#ifndef NDEBUG
+/* For tracing shifts, the names of all terminals and nonterminals
+** are required.  The following table supplies these names */
+const char *const yyTokenName[] = { 
+  "$",             "ANY",           "IDENTITY",      "STRING",      
+  "SIGNED",        "UNSIGNED",      "CREATE",        "CLASS",       
+  "EXTENDS",       "VERTEX",        "EDGE",          "SEMI",        
+  "ALTER",         "DROP",          "PROPERTY",      "DOT",         
+  "VALUES",        "LP",            "RP",            "COMMA",       
+  "FROM",          "TO",            "SELECT",        "STAR",        
+  "AS",            "AT",            "LB",            "RB",          
+  "WHERE",         "GROUP",         "BY",            "ORDER",       
+  "ASC",           "DESC",          "SKIP",          "LIMIT",       
+  "UPDATE",        "DELETE",        "TRAVERSE",      "MINDEPTH",    
+  "MAXDEPTH",      "STRATEGY",      "INDEX",         "ANALYZE",     
+  "EXPLAIN",       "PROFILE",       "IF",            "NOT",         
+  "EXISTS",        "SET",           "EQ",            "SHARP",       
+  "COLON",         "OR",            "AND",           "LT",          
+  "GT",            "GE",            "LE",            "NE",          
+  "IS",            "CONTAIN",       "CASE",          "BEGIN",       
+  "WITH",          "END",           "LIKE",          "REGEX",       
+  "BETWEEN",       "NULL",          "FLOAT",         "BLOB",        
+  "error",         "input",         "cmd",           "if_not_exists_opt",
+  "term",          "if_exists_opt",  "props_opt",     "prop_names",  
+  "value_rows",    "prop_name",     "term_list",     "create_edge_stmt",
+  "select_target_without_class",  "select_stmt",   "projections",   "from_opt",    
+  "where_opt",     "group_by",      "order_by",      "skip",        
+  "limit",         "proj_alias",    "proj_item",     "cond",        
+  "select_target",  "select_target_rids",  "traverse_stmt",  "rid",         
+  "rid_set",       "multi_cond",    "group_keys",    "name_set",    
+  "sort_order",    "update_stmt",   "delete_vertex_stmt",  "delete_edge_stmt",
+  "from_edge_opt",  "to_edge_opt",   "class_filter",  "min_depth_opt",
+  "max_depth_opt",  "strategy_opt",  "index_type",    "props_list",  
+  "term_token",  
+};
+#endif /* NDEBUG */
+
+#ifndef NDEBUG
+/* For tracing reduce actions, the names of all rules are required.
+*/
+const char *const yyRuleName[] = {
+ /*   0 */ "cmd ::= CREATE CLASS IDENTITY|STRING if_not_exists_opt EXTENDS VERTEX|EDGE SEMI",
+ /*   1 */ "cmd ::= CREATE CLASS IDENTITY|STRING if_not_exists_opt EXTENDS IDENTITY|STRING SEMI",
+ /*   2 */ "cmd ::= ALTER CLASS IDENTITY|STRING IDENTITY term SEMI",
+ /*   3 */ "cmd ::= DROP CLASS IDENTITY|STRING if_exists_opt SEMI",
+ /*   4 */ "cmd ::= CREATE PROPERTY IDENTITY|STRING DOT IDENTITY|STRING if_not_exists_opt IDENTITY|STRING SEMI",
+ /*   5 */ "cmd ::= ALTER PROPERTY IDENTITY|STRING DOT IDENTITY|STRING IDENTITY term SEMI",
+ /*   6 */ "cmd ::= DROP PROPERTY IDENTITY|STRING DOT IDENTITY|STRING if_exists_opt SEMI",
+ /*   7 */ "cmd ::= CREATE VERTEX IDENTITY|STRING props_opt SEMI",
+ /*   8 */ "cmd ::= CREATE VERTEX IDENTITY|STRING LP prop_names RP VALUES value_rows SEMI",
+ /*   9 */ "prop_names ::= prop_names COMMA prop_name",
+ /*  10 */ "prop_names ::= prop_name",
+ /*  11 */ "value_rows ::= value_rows COMMA LP term_list RP",
+ /*  12 */ "value_rows ::= LP term_list RP",
+ /*  13 */ "cmd ::= create_edge_stmt SEMI",
+ /*  14 */ "create_edge_stmt ::= CREATE EDGE IDENTITY|STRING FROM select_target_without_class TO select_target_without_class props_opt",
+ /*  15 */ "cmd ::= select_stmt SEMI",
+ /*  16 */ "select_stmt ::= SELECT projections from_opt where_opt group_by order_by skip limit",
+ /*  17 */ "projections ::=",
+ /*  18 */ "projections ::= STAR",
+ /*  19 */ "projections ::= projections COMMA proj_alias",
+ /*  20 */ "projections ::= proj_alias",
+ /*  21 */ "proj_alias ::= proj_item AS IDENTITY|STRING",
+ /*  22 */ "proj_item ::= LP proj_item RP",
+ /*  23 */ "proj_item ::= IDENTITY",
+ /*  24 */ "proj_item ::= STRING",
+ /*  25 */ "proj_item ::= AT IDENTITY",
+ /*  26 */ "proj_item ::= IDENTITY LP projections RP",
+ /*  27 */ "proj_item ::= proj_item DOT proj_item",
+ /*  28 */ "proj_item ::= IDENTITY LP projections RP LB SIGNED|UNSIGNED RB",
+ /*  29 */ "proj_item ::= IDENTITY LB SIGNED|UNSIGNED RB",
+ /*  30 */ "proj_item ::= STRING LB SIGNED|UNSIGNED RB",
+ /*  31 */ "proj_item ::= IDENTITY LP projections RP LB cond RB",
+ /*  32 */ "from_opt ::=",
+ /*  33 */ "from_opt ::= FROM select_target",
+ /*  34 */ "select_target ::= IDENTITY|STRING",
+ /*  35 */ "select_target ::= select_target_without_class",
+ /*  36 */ "select_target_without_class ::= select_target_rids",
+ /*  37 */ "select_target_without_class ::= LP select_stmt RP",
+ /*  38 */ "select_target_without_class ::= LP traverse_stmt RP",
+ /*  39 */ "select_target_rids ::= rid",
+ /*  40 */ "select_target_rids ::= LP rid_set RP",
+ /*  41 */ "where_opt ::=",
+ /*  42 */ "where_opt ::= WHERE multi_cond",
+ /*  43 */ "where_opt ::= WHERE cond",
+ /*  44 */ "group_by ::=",
+ /*  45 */ "group_by ::= GROUP BY group_keys",
+ /*  46 */ "group_keys ::= group_keys COMMA prop_name",
+ /*  47 */ "group_keys ::= prop_name",
+ /*  48 */ "skip ::=",
+ /*  49 */ "skip ::= SKIP SIGNED|UNSIGNED",
+ /*  50 */ "limit ::=",
+ /*  51 */ "limit ::= LIMIT SIGNED|UNSIGNED",
+ /*  52 */ "cmd ::= update_stmt SEMI",
+ /*  53 */ "update_stmt ::= UPDATE select_target props_opt where_opt",
+ /*  54 */ "cmd ::= delete_vertex_stmt SEMI",
+ /*  55 */ "delete_vertex_stmt ::= DELETE VERTEX select_target where_opt",
+ /*  56 */ "cmd ::= delete_edge_stmt SEMI",
+ /*  57 */ "delete_edge_stmt ::= DELETE EDGE select_target_rids",
+ /*  58 */ "delete_edge_stmt ::= DELETE EDGE IDENTITY|STRING from_edge_opt to_edge_opt where_opt",
+ /*  59 */ "from_edge_opt ::=",
+ /*  60 */ "from_edge_opt ::= FROM select_target_without_class",
+ /*  61 */ "to_edge_opt ::=",
+ /*  62 */ "to_edge_opt ::= TO select_target_without_class",
+ /*  63 */ "cmd ::= traverse_stmt SEMI",
+ /*  64 */ "traverse_stmt ::= TRAVERSE IDENTITY LP class_filter RP FROM rid_set min_depth_opt max_depth_opt strategy_opt",
+ /*  65 */ "class_filter ::=",
+ /*  66 */ "class_filter ::= name_set",
+ /*  67 */ "min_depth_opt ::=",
+ /*  68 */ "min_depth_opt ::= MINDEPTH SIGNED|UNSIGNED",
+ /*  69 */ "max_depth_opt ::=",
+ /*  70 */ "max_depth_opt ::= MAXDEPTH SIGNED|UNSIGNED",
+ /*  71 */ "strategy_opt ::=",
+ /*  72 */ "strategy_opt ::= STRATEGY IDENTITY",
+ /*  73 */ "cmd ::= CREATE INDEX IDENTITY|STRING DOT IDENTITY|STRING index_type SEMI",
+ /*  74 */ "cmd ::= DROP INDEX IDENTITY|STRING DOT IDENTITY|STRING SEMI",
+ /*  75 */ "index_type ::= IDENTITY",
+ /*  76 */ "cmd ::= ANALYZE IDENTITY|STRING SEMI",
+ /*  77 */ "cmd ::= EXPLAIN select_stmt SEMI",
+ /*  78 */ "cmd ::= EXPLAIN traverse_stmt SEMI",
+ /*  79 */ "cmd ::= PROFILE select_stmt SEMI",
+ /*  80 */ "cmd ::= PROFILE traverse_stmt SEMI",
+ /*  81 */ "if_not_exists_opt ::=",
+ /*  82 */ "if_not_exists_opt ::= IF NOT EXISTS",
+ /*  83 */ "if_exists_opt ::=",
+ /*  84 */ "if_exists_opt ::= IF EXISTS",
+ /*  85 */ "props_opt ::=",
+ /*  86 */ "props_opt ::= SET props_list",
+ /*  87 */ "props_list ::= props_list COMMA prop_name EQ term",
+ /*  88 */ "props_list ::= prop_name EQ term",
+ /*  89 */ "prop_name ::= IDENTITY|STRING",
+ /*  90 */ "prop_name ::= AT IDENTITY",
+ /*  91 */ "rid ::= SHARP SIGNED|UNSIGNED COLON SIGNED|UNSIGNED",
+ /*  92 */ "rid_set ::= rid_set COMMA rid",
+ /*  93 */ "rid_set ::= rid",
+ /*  94 */ "name_set ::= name_set COMMA IDENTITY|STRING",
+ /*  95 */ "name_set ::= IDENTITY|STRING",
+ /*  96 */ "term_list ::= term_list COMMA term",
+ /*  97 */ "term_list ::= term",
+ /*  98 */ "multi_cond ::= LP multi_cond RP",
+ /*  99 */ "multi_cond ::= multi_cond AND multi_cond",
+ /* 100 */ "multi_cond ::= multi_cond OR multi_cond",
+ /* 101 */ "multi_cond ::= multi_cond AND cond",
+ /* 102 */ "multi_cond ::= multi_cond OR cond",
+ /* 103 */ "multi_cond ::= cond AND multi_cond",
+ /* 104 */ "multi_cond ::= cond OR multi_cond",
+ /* 105 */ "multi_cond ::= cond AND cond",
+ /* 106 */ "multi_cond ::= cond OR cond",
+ /* 107 */ "multi_cond ::= NOT multi_cond",
+ /* 108 */ "cond ::= LP cond RP",
+ /* 109 */ "cond ::= NOT cond",
+ /* 110 */ "cond ::= prop_name EQ term",
+ /* 111 */ "cond ::= prop_name NE term",
+ /* 112 */ "cond ::= prop_name GT term",
+ /* 113 */ "cond ::= prop_name LT term",
+ /* 114 */ "cond ::= prop_name GE term",
+ /* 115 */ "cond ::= prop_name LE term",
+ /* 116 */ "cond ::= prop_name IS term",
+ /* 117 */ "cond ::= prop_name IS NOT term",
+ /* 118 */ "cond ::= prop_name CONTAIN CASE term",
+ /* 119 */ "cond ::= prop_name CONTAIN term",
+ /* 120 */ "cond ::= prop_name BEGIN WITH CASE term",
+ /* 121 */ "cond ::= prop_name BEGIN WITH term",
+ /* 122 */ "cond ::= prop_name END WITH CASE term",
+ /* 123 */ "cond ::= prop_name END WITH term",
+ /* 124 */ "cond ::= prop_name LIKE CASE term",
+ /* 125 */ "cond ::= prop_name LIKE term",
+ /* 126 */ "cond ::= prop_name REGEX CASE term",
+ /* 127 */ "cond ::= prop_name REGEX term",
+ /* 128 */ "cond ::= prop_name BETWEEN term AND term",
+ /* 129 */ "cond ::= prop_name IDENTITY LB term_list RB",
+ /* 130 */ "term ::= term_token",
+ /* 131 */ "term_token ::= NULL|FLOAT|STRING|SIGNED|UNSIGNED|BLOB",
+ /* 132 */ "input ::= cmd",
+ /* 133 */ "proj_alias ::= proj_item",
+ /* 134 */ "order_by ::=",
+ /* 135 */ "order_by ::= ORDER BY name_set sort_order",
+ /* 136 */ "sort_order ::=",
+ /* 137 */ "sort_order ::= ASC",
+ /* 138 */ "sort_order ::= DESC",
+ /* 139 */ "index_type ::=",
+};
+#endif /* NDEBUG */
+
+
+#if YYSTACKDEPTH<=0
+/*
+** Try to increase the size of the parser stack.  Return the number
+** of errors.  Return 0 on success.
+*/
+int yypParser::yyGrowStack(){
+  int newSize;
+  yyStackEntry *pNew;
+  yyStackEntry *pOld = yystack;
+  int oldSize = yystksz;
+
+  newSize = oldSize*2 + 100;
+  pNew = (yyStackEntry *)calloc(newSize, sizeof(pNew[0]));
+  if( pNew ){
+    yystack = pNew;
+    for (int i = 0; i < oldSize; ++i) {
+      pNew[i].stateno = pOld[i].stateno;
+      pNew[i].major = pOld[i].major;
+      yy_move(pOld[i].major, &pNew[i].minor, &pOld[i].minor);
+    }
+    if (pOld != &yystk0) free(pOld);
+#ifndef NDEBUG
+    if( yyTraceFILE ){
+      fprintf(yyTraceFILE,"%sStack grows from %d to %d entries.\n",
+              yyTracePrompt, yystksz, newSize);
+    }
+#endif
+    yystksz = newSize;
+  }
+  return pNew==0; 
+}
+#endif
+
+
+/* The following function deletes the "minor type" or semantic value
+** associated with a symbol.  The symbol can be either a terminal
+** or nonterminal. "yymajor" is the symbol code, and "yypminor" is
+** a pointer to the value to be deleted.  The code used to do the 
+** deletions is derived from the %destructor and/or %token_destructor
+** directives of the input grammar.
+*/
+void yy_destructor(
+  YYCODETYPE yymajor,     /* Type code for object to destroy */
+  YYMINORTYPE *yypminor   /* The object to be destroyed */
+){
+  switch( yymajor ){
+    /* Here is inserted the actions which take place when a
+    ** terminal or non-terminal is destroyed.  This can happen
+    ** when the symbol is popped from the stack during a
+    ** reduce or during error processing or when a parser is 
+    ** being destroyed before it is finished parsing.
+    **
+    ** Note: during a reduce, the only symbols destroyed are those
+    ** which appear on the RHS of the rule, but which are *not* used
+    ** inside the C code.
+    */
+/********* Begin destructor definitions ***************************************/
+    case 1: /* ANY */
+    case 2: /* IDENTITY */
+    case 3: /* STRING */
+    case 4: /* SIGNED */
+    case 5: /* UNSIGNED */
+    case 6: /* CREATE */
+    case 7: /* CLASS */
+    case 8: /* EXTENDS */
+    case 9: /* VERTEX */
+    case 10: /* EDGE */
+    case 11: /* SEMI */
+    case 12: /* ALTER */
+    case 13: /* DROP */
+    case 14: /* PROPERTY */
+    case 15: /* DOT */
+    case 16: /* VALUES */
+    case 17: /* LP */
+    case 18: /* RP */
+    case 19: /* COMMA */
+    case 20: /* FROM */
+    case 21: /* TO */
+    case 22: /* SELECT */
+    case 23: /* STAR */
+    case 24: /* AS */
+    case 25: /* AT */
+    case 26: /* LB */
+    case 27: /* RB */
+    case 28: /* WHERE */
+    case 29: /* GROUP */
+    case 30: /* BY */
+    case 31: /* ORDER */
+    case 32: /* ASC */
+    case 33: /* DESC */
+    case 34: /* SKIP */
+    case 35: /* LIMIT */
+    case 36: /* UPDATE */
+    case 37: /* DELETE */
+    case 38: /* TRAVERSE */
+    case 39: /* MINDEPTH */
+    case 40: /* MAXDEPTH */
+    case 41: /* STRATEGY */
+    case 42: /* INDEX */
+    case 43: /* ANALYZE */
+    case 44: /* EXPLAIN */
+    case 45: /* PROFILE */
+    case 46: /* IF */
+    case 47: /* NOT */
+    case 48: /* EXISTS */
+    case 49: /* SET */
+    case 50: /* EQ */
+    case 51: /* SHARP */
+    case 52: /* COLON */
+    case 53: /* OR */
+    case 54: /* AND */
+    case 55: /* LT */
+    case 56: /* GT */
+    case 57: /* GE */
+    case 58: /* LE */
+    case 59: /* NE */
+    case 60: /* IS */
+    case 61: /* CONTAIN */
+    case 62: /* CASE */
+    case 63: /* BEGIN */
+    case 64: /* WITH */
+    case 65: /* END */
+    case 66: /* LIKE */
+    case 67: /* REGEX */
+    case 68: /* BETWEEN */
+    case 69: /* NULL */
+    case 70: /* FLOAT */
+    case 71: /* BLOB */
+    case 73: /* input */
+    case 74: /* cmd */
+    case 104: /* sort_order */
+    case 114: /* index_type */
+    case 116: /* term_token */
+      yy_destructor< Token >(std::addressof(yypminor->yy0));
+      break;
+    case 0: /* $ */
+      yy_destructor<void>(std::addressof(yypminor->yy97));
+      break;
+    case 75: /* if_not_exists_opt */
+    case 77: /* if_exists_opt */
+      yy_destructor< bool >(std::addressof(yypminor->yy65));
+      break;
+    case 76: /* term */
+      yy_destructor< Bytes >(std::addressof(yypminor->yy130));
+      break;
+    case 78: /* props_opt */
+    case 115: /* props_list */
+      yy_destructor< nogdb::Record >(std::addressof(yypminor->yy104));
+      break;
+    case 79: /* prop_names */
+    case 89: /* group_by */
+    case 102: /* group_keys */
+      yy_destructor< vector<string> >(std::addressof(yypminor->yy137));
+      break;
+    case 80: /* value_rows */
+      yy_destructor< vector<vector<Bytes>> >(std::addressof(yypminor->yy36));
+      break;
+    case 81: /* prop_name */
+    case 113: /* strategy_opt */
+      yy_destructor< string >(std::addressof(yypminor->yy32));
+      break;
+    case 82: /* term_list */
+      yy_destructor< vector<Bytes> >(std::addressof(yypminor->yy129));
+      break;
+    case 83: /* create_edge_stmt */
+      yy_destructor< CreateEdgeArgs >(std::addressof(yypminor->yy201));
+      break;
+    case 84: /* select_target_without_class */
+    case 87: /* from_opt */
+    case 96: /* select_target */
+    case 108: /* from_edge_opt */
+    case 109: /* to_edge_opt */
+      yy_destructor< Target >(std::addressof(yypminor->yy76));
+      break;
+    case 85: /* select_stmt */
+      yy_destructor< SelectArgs >(std::addressof(yypminor->yy54));
+      break;
+    case 86: /* projections */
+      yy_destructor< vector<Projection> >(std::addressof(yypminor->yy83));
+      break;
+    case 88: /* where_opt */
+      yy_destructor< Where >(std::addressof(yypminor->yy144));
+      break;
+    case 90: /* order_by */
+      yy_destructor< void * >(std::addressof(yypminor->yy61));
+      break;
+    case 91: /* skip */
+    case 92: /* limit */
+      yy_destructor< int >(std::addressof(yypminor->yy202));
+      break;
+    case 93: /* proj_alias */
+    case 94: /* proj_item */
+      yy_destructor< Projection >(std::addressof(yypminor->yy168));
+      break;
+    case 95: /* cond */
+      yy_destructor< Condition >(std::addressof(yypminor->yy12));
+      break;
+    case 97: /* select_target_rids */
+    case 100: /* rid_set */
+      yy_destructor< RecordDescriptorSet >(std::addressof(yypminor->yy197));
+      break;
+    case 98: /* traverse_stmt */
+      yy_destructor< TraverseArgs >(std::addressof(yypminor->yy164));
+      break;
+    case 99: /* rid */
+      yy_destructor< RecordDescriptor >(std::addressof(yypminor->yy225));
+      break;
+    case 101: /* multi_cond */
+      yy_destructor< shared_ptr<MultiCondition> >(std::addressof(yypminor->yy203));
+      break;
+    case 103: /* name_set */
+    case 110: /* class_filter */
+      yy_destructor< set<string> >(std::addressof(yypminor->yy232));
+      break;
+    case 105: /* update_stmt */
+      yy_destructor< UpdateArgs >(std::addressof(yypminor->yy25));
+      break;
+    case 106: /* delete_vertex_stmt */
+      yy_destructor< DeleteVertexArgs >(std::addressof(yypminor->yy79));
+      break;
+    case 107: /* delete_edge_stmt */
+      yy_destructor< DeleteEdgeArgs >(std::addressof(yypminor->yy132));
+      break;
+    case 111: /* min_depth_opt */
+    case 112: /* max_depth_opt */
+      yy_destructor< long long >(std::addressof(yypminor->yy105));
+      break;
+/********* End destructor definitions *****************************************/
+    default:  break;   /* If no destructor action specified: do nothing */
+  }
+}
+
+
+/*
+ * moves an object (such as when growing the stack). 
+ * Source is constructed.
+ * Destination is also destructed.
+ * 
+ */
+void yy_move(
+  YYCODETYPE yymajor,     /* Type code for object to move */
+  YYMINORTYPE *yyDest,     /*  */
+  YYMINORTYPE *yySource     /*  */
+){
+  switch( yymajor ){
+
+/********* Begin move definitions ***************************************/
+    case 1: /* ANY */
+    case 2: /* IDENTITY */
+    case 3: /* STRING */
+    case 4: /* SIGNED */
+    case 5: /* UNSIGNED */
+    case 6: /* CREATE */
+    case 7: /* CLASS */
+    case 8: /* EXTENDS */
+    case 9: /* VERTEX */
+    case 10: /* EDGE */
+    case 11: /* SEMI */
+    case 12: /* ALTER */
+    case 13: /* DROP */
+    case 14: /* PROPERTY */
+    case 15: /* DOT */
+    case 16: /* VALUES */
+    case 17: /* LP */
+    case 18: /* RP */
+    case 19: /* COMMA */
+    case 20: /* FROM */
+    case 21: /* TO */
+    case 22: /* SELECT */
+    case 23: /* STAR */
+    case 24: /* AS */
+    case 25: /* AT */
+    case 26: /* LB */
+    case 27: /* RB */
+    case 28: /* WHERE */
+    case 29: /* GROUP */
+    case 30: /* BY */
+    case 31: /* ORDER */
+    case 32: /* ASC */
+    case 33: /* DESC */
+    case 34: /* SKIP */
+    case 35: /* LIMIT */
+    case 36: /* UPDATE */
+    case 37: /* DELETE */
+    case 38: /* TRAVERSE */
+    case 39: /* MINDEPTH */
+    case 40: /* MAXDEPTH */
+    case 41: /* STRATEGY */
+    case 42: /* INDEX */
+    case 43: /* ANALYZE */
+    case 44: /* EXPLAIN */
+    case 45: /* PROFILE */
+    case 46: /* IF */
+    case 47: /* NOT */
+    case 48: /* EXISTS */
+    case 49: /* SET */
+    case 50: /* EQ */
+    case 51: /* SHARP */
+    case 52: /* COLON */
+    case 53: /* OR */
+    case 54: /* AND */
+    case 55: /* LT */
+    case 56: /* GT */
+    case 57: /* GE */
+    case 58: /* LE */
+    case 59: /* NE */
+    case 60: /* IS */
+    case 61: /* CONTAIN */
+    case 62: /* CASE */
+    case 63: /* BEGIN */
+    case 64: /* WITH */
+    case 65: /* END */
+    case 66: /* LIKE */
+    case 67: /* REGEX */
+    case 68: /* BETWEEN */
+    case 69: /* NULL */
+    case 70: /* FLOAT */
+    case 71: /* BLOB */
+    case 73: /* input */
+    case 74: /* cmd */
+    case 104: /* sort_order */
+    case 114: /* index_type */
+    case 116: /* term_token */
+      yy_move< Token >(std::addressof(yyDest->yy0), std::addressof(yySource->yy0));
+      break;
+    case 0: /* $ */
+      yy_move<void>(std::addressof(yyDest->yy97), std::addressof(yySource->yy97));
+      break;
+    case 75: /* if_not_exists_opt */
+    case 77: /* if_exists_opt */
+      yy_move< bool >(std::addressof(yyDest->yy65), std::addressof(yySource->yy65));
+      break;
+    case 76: /* term */
+      yy_move< Bytes >(std::addressof(yyDest->yy130), std::addressof(yySource->yy130));
+      break;
+    case 78: /* props_opt */
+    case 115: /* props_list */
+      yy_move< nogdb::Record >(std::addressof(yyDest->yy104), std::addressof(yySource->yy104));
+      break;
+    case 79: /* prop_names */
+    case 89: /* group_by */
+    case 102: /* group_keys */
+      yy_move< vector<string> >(std::addressof(yyDest->yy137), std::addressof(yySource->yy137));
+      break;
+    case 80: /* value_rows */
+      yy_move< vector<vector<Bytes>> >(std::addressof(yyDest->yy36), std::addressof(yySource->yy36));
+      break;
+    case 81: /* prop_name */
+    case 113: /* strategy_opt */
+      yy_move< string >(std::addressof(yyDest->yy32), std::addressof(yySource->yy32));
+      break;
+    case 82: /* term_list */
+      yy_move< vector<Bytes> >(std::addressof(yyDest->yy129), std::addressof(yySource->yy129));
+      break;
+    case 83: /* create_edge_stmt */
+      yy_move< CreateEdgeArgs >(std::addressof(yyDest->yy201), std::addressof(yySource->yy201));
+      break;
+    case 84: /* select_target_without_class */
+    case 87: /* from_opt */
+    case 96: /* select_target */
+    case 108: /* from_edge_opt */
+    case 109: /* to_edge_opt */
+      yy_move< Target >(std::addressof(yyDest->yy76), std::addressof(yySource->yy76));
+      break;
+    case 85: /* select_stmt */
+      yy_move< SelectArgs >(std::addressof(yyDest->yy54), std::addressof(yySource->yy54));
+      break;
+    case 86: /* projections */
+      yy_move< vector<Projection> >(std::addressof(yyDest->yy83), std::addressof(yySource->yy83));
+      break;
+    case 88: /* where_opt */
+      yy_move< Where >(std::addressof(yyDest->yy144), std::addressof(yySource->yy144));
+      break;
+    case 90: /* order_by */
+      yy_move< void * >(std::addressof(yyDest->yy61), std::addressof(yySource->yy61));
+      break;
+    case 91: /* skip */
+    case 92: /* limit */
+      yy_move< int >(std::addressof(yyDest->yy202), std::addressof(yySource->yy202));
+      break;
+    case 93: /* proj_alias */
+    case 94: /* proj_item */
+      yy_move< Projection >(std::addressof(yyDest->yy168), std::addressof(yySource->yy168));
+      break;
+    case 95: /* cond */
+      yy_move< Condition >(std::addressof(yyDest->yy12), std::addressof(yySource->yy12));
+      break;
+    case 97: /* select_target_rids */
+    case 100: /* rid_set */
+      yy_move< RecordDescriptorSet >(std::addressof(yyDest->yy197), std::addressof(yySource->yy197));
+      break;
+    case 98: /* traverse_stmt */
+      yy_move< TraverseArgs >(std::addressof(yyDest->yy164), std::addressof(yySource->yy164));
+      break;
+    case 99: /* rid */
+      yy_move< RecordDescriptor >(std::addressof(yyDest->yy225), std::addressof(yySource->yy225));
+      break;
+    case 101: /* multi_cond */
+      yy_move< shared_ptr<MultiCondition> >(std::addressof(yyDest->yy203), std::addressof(yySource->yy203));
+      break;
+    case 103: /* name_set */
+    case 110: /* class_filter */
+      yy_move< set<string> >(std::addressof(yyDest->yy232), std::addressof(yySource->yy232));
+      break;
+    case 105: /* update_stmt */
+      yy_move< UpdateArgs >(std::addressof(yyDest->yy25), std::addressof(yySource->yy25));
+      break;
+    case 106: /* delete_vertex_stmt */
+      yy_move< DeleteVertexArgs >(std::addressof(yyDest->yy79), std::addressof(yySource->yy79));
+      break;
+    case 107: /* delete_edge_stmt */
+      yy_move< DeleteEdgeArgs >(std::addressof(yyDest->yy132), std::addressof(yySource->yy132));
+      break;
+    case 111: /* min_depth_opt */
+    case 112: /* max_depth_opt */
+      yy_move< long long >(std::addressof(yyDest->yy105), std::addressof(yySource->yy105));
+      break;
+/********* End move definitions *****************************************/
+    default:  break;   /* If no move action specified: do nothing */
+      //yyDest.minor = yySource.minor;
+  }
+}
+
+
+/*
+** Pop the parser's stack once.
+**
+** If there is a destructor routine associated with the token which
+** is popped from the stack, then call it.
+*/
+void yypParser::yy_pop_parser_stack(){
+  yyStackEntry *yymsp;
+  assert( yytos!=0 );
+  assert( yytos > yystack );
+  yymsp = yytos--;
+#ifndef NDEBUG
+  if( yyTraceFILE ){
+    fprintf(yyTraceFILE,"%sPopping %s\n",
+      yyTracePrompt,
+      yyTokenName[yymsp->major]);
+  }
+#endif
+  yy_destructor(yymsp->major, &yymsp->minor);
+}
+
+
+template<class ...Args>
+yypParser::yypParser(Args&&... args) : LEMON_SUPER(std::forward<Args>(args)...)
+{
+#if YYSTACKDEPTH<=0
+  if( yyGrowStack() ){
+    yystack = &yystk0;
+    yystksz = 1;
+  }
+#else
+  std::memset(yystack, 0, sizeof(yystack));
+#endif
+
+  yytos = yystack;
+  yystack[0].stateno = 0;
+  yystack[0].major = 0;
+#if YYSTACKDEPTH>0
+  yystackEnd = &yystack[YYSTACKDEPTH-1];
+#endif
+}
+
+void yypParser::reset() {
+
+  while( yytos>yystack ) yy_pop_parser_stack();
+
+#ifndef YYNOERRORRECOVERY
+  yyerrcnt = -1;
+#endif
+
+  yytos = yystack;
+  yystack[0].stateno = 0;
+  yystack[0].major = 0;
+
+  LEMON_SUPER::reset();
+}
+
+
+/* 
+** Deallocate and destroy a parser.  Destructors are called for
+** all stack elements before shutting the parser down.
+**
+** If the YYPARSEFREENEVERNULL macro exists (for example because it
+** is defined in a %include section of the input grammar) then it is
+** assumed that the input pointer is never NULL.
+*/
+
+yypParser::~yypParser() {
+  while( yytos>yystack ) yy_pop_parser_stack();
+#if YYSTACKDEPTH<=0
+  if( yystack!=&yystk0 ) free(yystack);
+#endif
+}
+
+/*
+** Find the appropriate action for a parser given the terminal
+** look-ahead token iLookAhead.
+*/
+unsigned yypParser::yy_find_shift_action(
+  int stateno,              /* Current state number */
+  YYCODETYPE iLookAhead     /* The look-ahead token */
+) const {
+  int i;
+ 
+  if( stateno>=YY_MIN_REDUCE ) return stateno;
+  assert( stateno <= YY_SHIFT_COUNT );
+  do{
+    i = yy_shift_ofst[stateno];
+    assert( iLookAhead!=YYNOCODE );
+    i += iLookAhead;
+    if( i<0 || i>=YY_ACTTAB_COUNT || yy_lookahead[i]!=iLookAhead ){
+#ifdef YYFALLBACK
+      YYCODETYPE iFallback;            /* Fallback token */
+      if( iLookAhead<sizeof(yyFallback)/sizeof(yyFallback[0])
+             && (iFallback = yyFallback[iLookAhead])!=0 ){
+#ifndef NDEBUG
+        if( yyTraceFILE ){
+          fprintf(yyTraceFILE, "%sFALLBACK %s => %s\n",
+             yyTracePrompt, yyTokenName[iLookAhead], yyTokenName[iFallback]);
+        }
+#endif
+        assert( yyFallback[iFallback]==0 ); /* Fallback loop must terminate */
+        iLookAhead = iFallback;
+        continue;
+      }
+#endif
+#ifdef YYWILDCARD
+      {
+        int j = i - iLookAhead + YYWILDCARD;
+        if( 
+#if YY_SHIFT_MIN+YYWILDCARD<0
+          j>=0 &&
+#endif
+#if YY_SHIFT_MAX+YYWILDCARD>=YY_ACTTAB_COUNT
+          j<YY_ACTTAB_COUNT &&
+#endif
+          yy_lookahead[j]==YYWILDCARD && iLookAhead>0
+        ){
+#ifndef NDEBUG
+          if( yyTraceFILE ){
+            fprintf(yyTraceFILE, "%sWILDCARD %s => %s\n",
+               yyTracePrompt, yyTokenName[iLookAhead],
+               yyTokenName[YYWILDCARD]);
+          }
+#endif /* NDEBUG */
+          return yy_action[j];
+        }
+      }
+#endif /* YYWILDCARD */
+      return yy_default[stateno];
+    }else{
+      return yy_action[i];
+    }
+  }while(1);
+}
+
+/*
+** Find the appropriate action for a parser given the non-terminal
+** look-ahead token iLookAhead.
+*/
+int yypParser::yy_find_reduce_action(
+  int stateno,              /* Current state number */
+  YYCODETYPE iLookAhead     /* The look-ahead token */
+) const {
+  int i;
+#ifdef YYERRORSYMBOL
+  if( stateno>YY_REDUCE_COUNT ){
+    return yy_default[stateno];
+  }
+#else
+  assert( stateno<=YY_REDUCE_COUNT );
+#endif
+  i = yy_reduce_ofst[stateno];
+  assert( i!=YY_REDUCE_USE_DFLT );
+  assert( iLookAhead!=YYNOCODE );
+  i += iLookAhead;
+#ifdef YYERRORSYMBOL
+  if( i<0 || i>=YY_ACTTAB_COUNT || yy_lookahead[i]!=iLookAhead ){
+    return yy_default[stateno];
+  }
+#else
+  assert( i>=0 && i<YY_ACTTAB_COUNT );
+  assert( yy_lookahead[i]==iLookAhead );
+#endif
+  return yy_action[i];
+}
+
+/*
+** The following routine is called if the stack overflows.
+*/
+void yypParser::yyStackOverflow(){
+#ifndef NDEBUG
+   if( yyTraceFILE ){
+     fprintf(yyTraceFILE,"%sStack Overflow!\n",yyTracePrompt);
+   }
+#endif
+   while( yytos>yystack ) yy_pop_parser_stack();
+   /* Here code is inserted which will execute if the parser
+   ** stack every overflows */
+/******** Begin %stack_overflow code ******************************************/
+/******** End %stack_overflow code ********************************************/
+  LEMON_SUPER::stack_overflow();
+}
+
+/*
+** Print tracing information for a SHIFT action
+*/
+#ifndef NDEBUG
+void yypParser::yyTraceShift(int yyNewState) const {
+  if( yyTraceFILE ){
+    if( yyNewState<YYNSTATE ){
+      fprintf(yyTraceFILE,"%sShift '%s', go to state %d\n",
+         yyTracePrompt,yyTokenName[yytos->major],
+         yyNewState);
+    }else{
+      fprintf(yyTraceFILE,"%sShift '%s'\n",
+         yyTracePrompt,yyTokenName[yytos->major]);
+    }
+  }
+}
+#endif
+
+/*
+** Perform a shift action.
+*/
+void yypParser::yy_shift(
+  int yyNewState,               /* The new state to shift in */
+  int yyMajor,                  /* The major token to shift in */
+  ParseTOKENTYPE &&yyMinor      /* The minor token to shift in */
+){
+  yytos++;
+#ifdef YYTRACKMAXSTACKDEPTH
+  if( yyidx()>yyhwm ){
+    yyhwm++;
+    assert(yyhwm == yyidx());
+  }
+#endif
+#if YYSTACKDEPTH>0 
+  if( yytos>yystackEnd ){
+    yytos--;
+    yyStackOverflow();
+    return;
+  }
+#else
+  if( yytos>=&yystack[yystksz] ){
+    if( yyGrowStack() ){
+      yytos--;
+      yyStackOverflow();
+      return;
+    }
+  }
+#endif
+  if( yyNewState > YY_MAX_SHIFT ){
+    yyNewState += YY_MIN_REDUCE - YY_MIN_SHIFTREDUCE;
+  }
+  yytos->stateno = (YYACTIONTYPE)yyNewState;
+  yytos->major = (YYCODETYPE)yyMajor;
+  //yytos->minor.yy0 = yyMinor;
+  //yy_move also calls the destructor...
+  //yy_move<ParseTOKENTYPE>(std::addressof(yytos->minor.yy0), std::addressof(yyMinor));
+  yy_constructor<ParseTOKENTYPE>(std::addressof(yytos->minor.yy0), std::move(yyMinor));
+  yyTraceShift(yyNewState);
+}
+
+/* The following table contains information about every rule that
+** is used during the reduce.
+*/
+static const struct {
+  YYCODETYPE lhs;       /* Symbol on the left-hand side of the rule */
+  signed char nrhs;     /* Negative of the number of RHS symbols in the rule */
+} yyRuleInfo[] = {
+  { 74, -7 },
+  { 74, -7 },
+  { 74, -6 },
+  { 74, -5 },
+  { 74, -8 },
+  { 74, -8 },
+  { 74, -7 },
+  { 74, -5 },
+  { 74, -9 },
+  { 79, -3 },
+  { 79, -1 },
+  { 80, -5 },
+  { 80, -3 },
+  { 74, -2 },
+  { 83, -8 },
+  { 74, -2 },
+  { 85, -8 },
+  { 86, 0 },
+  { 86, -1 },
+  { 86, -3 },
+  { 86, -1 },
+  { 93, -3 },
+  { 94, -3 },
+  { 94, -1 },
+  { 94, -1 },
+  { 94, -2 },
+  { 94, -4 },
+  { 94, -3 },
+  { 94, -7 },
+  { 94, -4 },
+  { 94, -4 },
+  { 94, -7 },
+  { 87, 0 },
+  { 87, -2 },
+  { 96, -1 },
+  { 96, -1 },
+  { 84, -1 },
+  { 84, -3 },
+  { 84, -3 },
+  { 97, -1 },
+  { 97, -3 },
+  { 88, 0 },
+  { 88, -2 },
+  { 88, -2 },
+  { 89, 0 },
+  { 89, -3 },
+  { 102, -3 },
+  { 102, -1 },
+  { 91, 0 },
+  { 91, -2 },
+  { 92, 0 },
+  { 92, -2 },
+  { 74, -2 },
+  { 105, -4 },
+  { 74, -2 },
+  { 106, -4 },
+  { 74, -2 },
+  { 107, -3 },
+  { 107, -6 },
+  { 108, 0 },
+  { 108, -2 },
+  { 109, 0 },
+  { 109, -2 },
+  { 74, -2 },
+  { 98, -10 },
+  { 110, 0 },
+  { 110, -1 },
+  { 111, 0 },
+  { 111, -2 },
+  { 112, 0 },
+  { 112, -2 },
+  { 113, 0 },
+  { 113, -2 },
+  { 74, -7 },
+  { 74, -6 },
+  { 114, -1 },
+  { 74, -3 },
+  { 74, -3 },
+  { 74, -3 },
+  { 74, -3 },
+  { 74, -3 },
+  { 75, 0 },
+  { 75, -3 },
+  { 77, 0 },
+  { 77, -2 },
+  { 78, 0 },
+  { 78, -2 },
+  { 115, -5 },
+  { 115, -3 },
+  { 81, -1 },
+  { 81, -2 },
+  { 99, -4 },
+  { 100, -3 },
+  { 100, -1 },
+  { 103, -3 },
+  { 103, -1 },
+  { 82, -3 },
+  { 82, -1 },
+  { 101, -3 },
+  { 101, -3 },
+  { 101, -3 },
+  { 101, -3 },
+  { 101, -3 },
+  { 101, -3 },
+  { 101, -3 },
+  { 101, -3 },
+  { 101, -3 },
+  { 101, -2 },
+  { 95, -3 },
+  { 95, -2 },
+  { 95, -3 },
+  { 95, -3 },
+  { 95, -3 },
+  { 95, -3 },
+  { 95, -3 },
+  { 95, -3 },
+  { 95, -3 },
+  { 95, -4 },
+  { 95, -4 },
+  { 95, -3 },
+  { 95, -5 },
+  { 95, -4 },
+  { 95, -5 },
+  { 95, -4 },
+  { 95, -4 },
+  { 95, -3 },
+  { 95, -4 },
+  { 95, -3 },
+  { 95, -5 },
+  { 95, -5 },
+  { 76, -1 },
+  { 116, -1 },
+  { 73, -1 },
+  { 93, -1 },
+  { 90, 0 },
+  { 90, -4 },
+  { 104, 0 },
+  { 104, -1 },
+  { 104, -1 },
+  { 114, 0 },
+};
+
+/*
+** Perform a reduce action and the shift that must immediately
+** follow the reduce.
+*/
+void yypParser::yy_reduce(
+  unsigned int yyruleno           /* Number of the rule by which to reduce */
+){
+  int yygoto;                     /* The next state */
+  int yyact;                      /* The next action */
+  yyStackEntry *yymsp;            /* The top of the parser's stack */
+  int yysize;                     /* Amount to pop the stack */
+  yymsp = yytos;
+#ifndef NDEBUG
+  if( yyTraceFILE && yyruleno<(int)(sizeof(yyRuleName)/sizeof(yyRuleName[0])) ){
+    yysize = yyRuleInfo[yyruleno].nrhs;
+    fprintf(yyTraceFILE, "%sReduce [%s], go to state %d.\n", yyTracePrompt,
+      yyRuleName[yyruleno], yymsp[yysize].stateno);
+  }
+#endif /* NDEBUG */
+
+  /* Check that the stack is large enough to grow by a single entry
+  ** if the RHS of the rule is empty.  This ensures that there is room
+  ** enough on the stack to push the LHS value */
+  if( yyRuleInfo[yyruleno].nrhs==0 ){
+#ifdef YYTRACKMAXSTACKDEPTH
+    if( yyidx()>yyhwm ){
+      yyhwm++;
+      assert(yyhwm == yyidx());
+    }
+#endif
+#if YYSTACKDEPTH>0 
+    if( yytos>=yystackEnd ){
+      yyStackOverflow();
+      return;
+    }
+#else
+    if( yytos>=&yystack[yystksz-1] ){
+      if( yyGrowStack() ){
+        yyStackOverflow();
+        return;
+      }
+      yymsp = yytos;
+    }
+#endif
+  }
+
+  switch( yyruleno ){
+  /* Beginning here are the reduction cases.  A typical example
+  ** follows:
+  **   case 0:
+  **  #line <lineno> <grammarfile>
+  **     { ... }           // User supplied code
+  **  #line <lineno> <thisfile>
+  **     break;
+  */
+/********** Begin reduce actions **********************************************/
+      case 0: /* cmd ::= CREATE CLASS IDENTITY|STRING if_not_exists_opt EXTENDS VERTEX|EDGE SEMI */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-6].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-5].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &name=yy_cast< Token >(std::addressof(yymsp[-4].minor.yy0));
+  auto &checkIfNotExists=yy_cast< bool >(std::addressof(yymsp[-3].minor.yy65));
+  auto &type=yy_cast< Token >(std::addressof(yymsp[-1].minor.yy0));
+#line 74 "/root/repo/src/sql_parser.y"
+{
+    this->createClass(name, type, checkIfNotExists);
+}
+#line 1789 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(name);
+  yy_destructor(checkIfNotExists);
+  yy_destructor(type);
+  yy_constructor< Token >(std::addressof(yymsp[-6].minor.yy0));
+}
+        break;
+      case 1: /* cmd ::= CREATE CLASS IDENTITY|STRING if_not_exists_opt EXTENDS IDENTITY|STRING SEMI */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-6].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-5].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &name=yy_cast< Token >(std::addressof(yymsp[-4].minor.yy0));
+  auto &checkIfNotExists=yy_cast< bool >(std::addressof(yymsp[-3].minor.yy65));
+  auto &extend=yy_cast< Token >(std::addressof(yymsp[-1].minor.yy0));
+#line 77 "/root/repo/src/sql_parser.y"
+{
+    this->createClass(name, extend, checkIfNotExists);
+}
+#line 1809 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(name);
+  yy_destructor(checkIfNotExists);
+  yy_destructor(extend);
+  yy_constructor< Token >(std::addressof(yymsp[-6].minor.yy0));
+}
+        break;
+      case 2: /* cmd ::= ALTER CLASS IDENTITY|STRING IDENTITY term SEMI */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-5].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-4].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &name=yy_cast< Token >(std::addressof(yymsp[-3].minor.yy0));
+  auto &attr=yy_cast< Token >(std::addressof(yymsp[-2].minor.yy0));
+  auto &value=yy_cast< Bytes >(std::addressof(yymsp[-1].minor.yy130));
+#line 82 "/root/repo/src/sql_parser.y"
+{
+    this->alterClass(name, attr, value);
+}
+#line 1828 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(name);
+  yy_destructor(attr);
+  yy_destructor(value);
+  yy_constructor< Token >(std::addressof(yymsp[-5].minor.yy0));
+}
+        break;
+      case 3: /* cmd ::= DROP CLASS IDENTITY|STRING if_exists_opt SEMI */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-4].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-3].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &name=yy_cast< Token >(std::addressof(yymsp[-2].minor.yy0));
+  auto &checkIfExists=yy_cast< bool >(std::addressof(yymsp[-1].minor.yy65));
+#line 87 "/root/repo/src/sql_parser.y"
+{
+    this->dropClass(name, checkIfExists);
+}
+#line 1846 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(name);
+  yy_destructor(checkIfExists);
+  yy_constructor< Token >(std::addressof(yymsp[-4].minor.yy0));
+}
+        break;
+      case 4: /* cmd ::= CREATE PROPERTY IDENTITY|STRING DOT IDENTITY|STRING if_not_exists_opt IDENTITY|STRING SEMI */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-7].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-6].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-4].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &className=yy_cast< Token >(std::addressof(yymsp[-5].minor.yy0));
+  auto &propName=yy_cast< Token >(std::addressof(yymsp[-3].minor.yy0));
+  auto &checkIfNotExists=yy_cast< bool >(std::addressof(yymsp[-2].minor.yy65));
+  auto &type=yy_cast< Token >(std::addressof(yymsp[-1].minor.yy0));
+#line 94 "/root/repo/src/sql_parser.y"
+{
+    this->createProperty(className, propName, type, checkIfNotExists);
+}
+#line 1866 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(className);
+  yy_destructor(propName);
+  yy_destructor(checkIfNotExists);
+  yy_destructor(type);
+  yy_constructor< Token >(std::addressof(yymsp[-7].minor.yy0));
+}
+        break;
+      case 5: /* cmd ::= ALTER PROPERTY IDENTITY|STRING DOT IDENTITY|STRING IDENTITY term SEMI */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-7].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-6].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-4].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &className=yy_cast< Token >(std::addressof(yymsp[-5].minor.yy0));
+  auto &propName=yy_cast< Token >(std::addressof(yymsp[-3].minor.yy0));
+  auto &attr=yy_cast< Token >(std::addressof(yymsp[-2].minor.yy0));
+  auto &value=yy_cast< Bytes >(std::addressof(yymsp[-1].minor.yy130));
+#line 99 "/root/repo/src/sql_parser.y"
+{
+    this->alterProperty(className, propName, attr, value);
+}
+#line 1888 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(className);
+  yy_destructor(propName);
+  yy_destructor(attr);
+  yy_destructor(value);
+  yy_constructor< Token >(std::addressof(yymsp[-7].minor.yy0));
+}
+        break;
+      case 6: /* cmd ::= DROP PROPERTY IDENTITY|STRING DOT IDENTITY|STRING if_exists_opt SEMI */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-6].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-5].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-3].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &className=yy_cast< Token >(std::addressof(yymsp[-4].minor.yy0));
+  auto &propName=yy_cast< Token >(std::addressof(yymsp[-2].minor.yy0));
+  auto &checkIfExists=yy_cast< bool >(std::addressof(yymsp[-1].minor.yy65));
+#line 104 "/root/repo/src/sql_parser.y"
+{
+    this->dropProperty(className, propName, checkIfExists);
+}
+#line 1909 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(className);
+  yy_destructor(propName);
+  yy_destructor(checkIfExists);
+  yy_constructor< Token >(std::addressof(yymsp[-6].minor.yy0));
+}
+        break;
+      case 7: /* cmd ::= CREATE VERTEX IDENTITY|STRING props_opt SEMI */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-4].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-3].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &name=yy_cast< Token >(std::addressof(yymsp[-2].minor.yy0));
+  auto &prop=yy_cast< nogdb::Record >(std::addressof(yymsp[-1].minor.yy104));
+#line 113 "/root/repo/src/sql_parser.y"
+{
+    this->createVertex(name, prop);
+}
+#line 1927 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(name);
+  yy_destructor(prop);
+  yy_constructor< Token >(std::addressof(yymsp[-4].minor.yy0));
+}
+        break;
+      case 8: /* cmd ::= CREATE VERTEX IDENTITY|STRING LP prop_names RP VALUES value_rows SEMI */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-8].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-7].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-5].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-3].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &name=yy_cast< Token >(std::addressof(yymsp[-6].minor.yy0));
+  auto &props=yy_cast< vector<string> >(std::addressof(yymsp[-4].minor.yy137));
+  auto &rows=yy_cast< vector<vector<Bytes>> >(std::addressof(yymsp[-1].minor.yy36));
+#line 120 "/root/repo/src/sql_parser.y"
+{
+    this->createVertices(name, props, rows);
+}
+#line 1948 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(name);
+  yy_destructor(props);
+  yy_destructor(rows);
+  yy_constructor< Token >(std::addressof(yymsp[-8].minor.yy0));
+}
+        break;
+      case 9: /* prop_names ::= prop_names COMMA prop_name */
+      case 46: /* group_keys ::= group_keys COMMA prop_name */ yytestcase(yyruleno==46);
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+  auto &A=yy_cast< vector<string> >(std::addressof(yymsp[-2].minor.yy137));
+  auto &X=yy_cast< string >(std::addressof(yymsp[0].minor.yy32));
+#line 125 "/root/repo/src/sql_parser.y"
+{ A.push_back(move(X)); }
+#line 1963 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+}
+        break;
+      case 10: /* prop_names ::= prop_name */
+      case 47: /* group_keys ::= prop_name */ yytestcase(yyruleno==47);
+{
+   vector<string>  A;
+  auto &X=yy_cast< string >(std::addressof(yymsp[0].minor.yy32));
+#line 126 "/root/repo/src/sql_parser.y"
+{ A = vector<string>{X}; }
+#line 1974 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+  yy_constructor< vector<string> >(std::addressof(yymsp[0].minor.yy137), std::move(A));
+}
+        break;
+      case 11: /* value_rows ::= value_rows COMMA LP term_list RP */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-3].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &A=yy_cast< vector<vector<Bytes>> >(std::addressof(yymsp[-4].minor.yy36));
+  auto &X=yy_cast< vector<Bytes> >(std::addressof(yymsp[-1].minor.yy129));
+#line 129 "/root/repo/src/sql_parser.y"
+{ A.push_back(move(X)); }
+#line 1988 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+}
+        break;
+      case 12: /* value_rows ::= LP term_list RP */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &A=yy_constructor< vector<vector<Bytes>> >(std::addressof(yymsp[-2].minor.yy36));
+  auto &X=yy_cast< vector<Bytes> >(std::addressof(yymsp[-1].minor.yy129));
+#line 130 "/root/repo/src/sql_parser.y"
+{ A = vector<vector<Bytes>>{move(X)}; }
+#line 2000 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+}
+        break;
+      case 13: /* cmd ::= create_edge_stmt SEMI */
+{
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &s=yy_cast< CreateEdgeArgs >(std::addressof(yymsp[-1].minor.yy201));
+#line 134 "/root/repo/src/sql_parser.y"
+{
+    this->createEdge(s);
+}
+#line 2012 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(s);
+  yy_constructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+}
+        break;
+      case 14: /* create_edge_stmt ::= CREATE EDGE IDENTITY|STRING FROM select_target_without_class TO select_target_without_class props_opt */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-7].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-6].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-4].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  auto &A=yy_constructor< CreateEdgeArgs >(std::addressof(yymsp[-7].minor.yy201));
+  auto &name=yy_cast< Token >(std::addressof(yymsp[-5].minor.yy0));
+  auto &src=yy_cast< Target >(std::addressof(yymsp[-3].minor.yy76));
+  auto &dest=yy_cast< Target >(std::addressof(yymsp[-1].minor.yy76));
+  auto &prop=yy_cast< nogdb::Record >(std::addressof(yymsp[0].minor.yy104));
+#line 139 "/root/repo/src/sql_parser.y"
+{
+    A = CreateEdgeArgs{name.toString(), move(src), move(dest), move(prop)};
+}
+#line 2032 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(name);
+  yy_destructor(src);
+  yy_destructor(dest);
+  yy_destructor(prop);
+}
+        break;
+      case 15: /* cmd ::= select_stmt SEMI */
+{
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &stmt=yy_cast< SelectArgs >(std::addressof(yymsp[-1].minor.yy54));
+#line 145 "/root/repo/src/sql_parser.y"
+{
+    this->select(stmt);
+}
+#line 2047 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(stmt);
+  yy_constructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+}
+        break;
+      case 16: /* select_stmt ::= SELECT projections from_opt where_opt group_by order_by skip limit */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-7].minor.yy0));
+  auto &A=yy_constructor< SelectArgs >(std::addressof(yymsp[-7].minor.yy54));
+  auto &proj=yy_cast< vector<Projection> >(std::addressof(yymsp[-6].minor.yy83));
+  auto &from=yy_cast< Target >(std::addressof(yymsp[-5].minor.yy76));
+  auto &where=yy_cast< Where >(std::addressof(yymsp[-4].minor.yy144));
+  auto &group=yy_cast< vector<string> >(std::addressof(yymsp[-3].minor.yy137));
+  auto &order=yy_cast< void * >(std::addressof(yymsp[-2].minor.yy61));
+  auto &skip=yy_cast< int >(std::addressof(yymsp[-1].minor.yy202));
+  auto &limit=yy_cast< int >(std::addressof(yymsp[0].minor.yy202));
+#line 150 "/root/repo/src/sql_parser.y"
+{
+    A = SelectArgs{move(proj), move(from), move(where), group, order, skip, limit};
+}
+#line 2067 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(proj);
+  yy_destructor(from);
+  yy_destructor(where);
+  yy_destructor(group);
+  yy_destructor(order);
+  yy_destructor(skip);
+  yy_destructor(limit);
+}
+        break;
+      case 17: /* projections ::= */
+{
+  auto &A=yy_constructor< vector<Projection> >(std::addressof(yymsp[1].minor.yy83));
+#line 156 "/root/repo/src/sql_parser.y"
+{ A = vector<Projection>(); }
+#line 2082 "/root/repo/src/sql_parser.cpp"
+}
+        break;
+      case 18: /* projections ::= STAR */
+{
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &A=yy_constructor< vector<Projection> >(std::addressof(yymsp[0].minor.yy83));
+#line 157 "/root/repo/src/sql_parser.y"
+{ A = vector<Projection>(); }
+#line 2091 "/root/repo/src/sql_parser.cpp"
+}
+        break;
+      case 19: /* projections ::= projections COMMA proj_alias */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+  auto &A=yy_cast< vector<Projection> >(std::addressof(yymsp[-2].minor.yy83));
+  auto &X=yy_cast< Projection >(std::addressof(yymsp[0].minor.yy168));
+#line 158 "/root/repo/src/sql_parser.y"
+{ A.push_back(move(X)); }
+#line 2101 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+}
+        break;
+      case 20: /* projections ::= proj_alias */
+{
+   vector<Projection>  A;
+  auto &X=yy_cast< Projection >(std::addressof(yymsp[0].minor.yy168));
+#line 159 "/root/repo/src/sql_parser.y"
+{ A = vector<Projection>{X}; }
+#line 2111 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+  yy_constructor< vector<Projection> >(std::addressof(yymsp[0].minor.yy83), std::move(A));
+}
+        break;
+      case 21: /* proj_alias ::= proj_item AS IDENTITY|STRING */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   Projection  A;
+  auto &X=yy_cast< Projection >(std::addressof(yymsp[-2].minor.yy168));
+  auto &Y=yy_cast< Token >(std::addressof(yymsp[0].minor.yy0));
+#line 163 "/root/repo/src/sql_parser.y"
+{
+    A = Projection(ProjectionType::ALIAS, make_shared<pair<Projection, string>>(move(X), Y.toString()));
+}
+#line 2126 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+  yy_destructor(Y);
+  yy_constructor< Projection >(std::addressof(yymsp[-2].minor.yy168), std::move(A));
+}
+        break;
+      case 22: /* proj_item ::= LP proj_item RP */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &A=yy_constructor< Projection >(std::addressof(yymsp[-2].minor.yy168));
+  auto &X=yy_cast< Projection >(std::addressof(yymsp[-1].minor.yy168));
+#line 168 "/root/repo/src/sql_parser.y"
+{ A = move(X); }
+#line 2140 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+}
+        break;
+      case 23: /* proj_item ::= IDENTITY */
+      case 24: /* proj_item ::= STRING */ yytestcase(yyruleno==24);
+{
+   Projection  A;
+  auto &X=yy_cast< Token >(std::addressof(yymsp[0].minor.yy0));
+#line 169 "/root/repo/src/sql_parser.y"
+{
+    A = Projection(ProjectionType::PROPERTY, make_shared<string>(X.toString()));
+}
+#line 2153 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+  yy_constructor< Projection >(std::addressof(yymsp[0].minor.yy168), std::move(A));
+}
+        break;
+      case 25: /* proj_item ::= AT IDENTITY */
+{
+   Projection  A;
+  auto &X=yy_cast< Token >(std::addressof(yymsp[-1].minor.yy0));
+  auto &Y=yy_cast< Token >(std::addressof(yymsp[0].minor.yy0));
+#line 175 "/root/repo/src/sql_parser.y"
+{
+    Token atProp{X.z, static_cast<int>(Y.z + Y.n - X.z), X.t};
+    A = Projection(ProjectionType::PROPERTY, make_shared<string>(atProp.toString()));
+}
+#line 2168 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+  yy_destructor(Y);
+  yy_constructor< Projection >(std::addressof(yymsp[-1].minor.yy168), std::move(A));
+}
+        break;
+      case 26: /* proj_item ::= IDENTITY LP projections RP */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+   Projection  A;
+  auto &fName=yy_cast< Token >(std::addressof(yymsp[-3].minor.yy0));
+  auto &args=yy_cast< vector<Projection> >(std::addressof(yymsp[-1].minor.yy83));
+#line 179 "/root/repo/src/sql_parser.y"
+{
+    A = Projection(ProjectionType::FUNCTION, make_shared<Function>(fName.toString(), move(args)));
+}
+#line 2185 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(fName);
+  yy_destructor(args);
+  yy_constructor< Projection >(std::addressof(yymsp[-3].minor.yy168), std::move(A));
+}
+        break;
+      case 27: /* proj_item ::= proj_item DOT proj_item */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   Projection  A;
+  auto &X=yy_cast< Projection >(std::addressof(yymsp[-2].minor.yy168));
+  auto &Y=yy_cast< Projection >(std::addressof(yymsp[0].minor.yy168));
+#line 183 "/root/repo/src/sql_parser.y"
+{
+    A = Projection(ProjectionType::METHOD, make_shared<pair<Projection, Projection>>(move(X), move(Y)));
+}
+#line 2201 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+  yy_destructor(Y);
+  yy_constructor< Projection >(std::addressof(yymsp[-2].minor.yy168), std::move(A));
+}
+        break;
+      case 28: /* proj_item ::= IDENTITY LP projections RP LB SIGNED|UNSIGNED RB */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-5].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-3].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+   Projection  A;
+  auto &fName=yy_cast< Token >(std::addressof(yymsp[-6].minor.yy0));
+  auto &fArgs=yy_cast< vector<Projection> >(std::addressof(yymsp[-4].minor.yy83));
+  auto &index=yy_cast< Token >(std::addressof(yymsp[-1].minor.yy0));
+#line 186 "/root/repo/src/sql_parser.y"
+{
+    A = Projection(
+            ProjectionType::ARRAY_SELECTOR,
+            make_shared<pair<Projection, unsigned long>>(
+                Projection(ProjectionType::FUNCTION, make_shared<Function>(fName.toString(), move(fArgs))),
+                stoull(string(index.z, index.n))));
+}
+#line 2225 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(fName);
+  yy_destructor(fArgs);
+  yy_destructor(index);
+  yy_constructor< Projection >(std::addressof(yymsp[-6].minor.yy168), std::move(A));
+}
+        break;
+      case 29: /* proj_item ::= IDENTITY LB SIGNED|UNSIGNED RB */
+      case 30: /* proj_item ::= STRING LB SIGNED|UNSIGNED RB */ yytestcase(yyruleno==30);
+{
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+   Projection  A;
+  auto &X=yy_cast< Token >(std::addressof(yymsp[-3].minor.yy0));
+  auto &index=yy_cast< Token >(std::addressof(yymsp[-1].minor.yy0));
+#line 193 "/root/repo/src/sql_parser.y"
+{
+    A = Projection(
+            ProjectionType::ARRAY_SELECTOR,
+            make_shared<pair<Projection, unsigned long>>(
+                Projection(ProjectionType::PROPERTY, make_shared<string>(X.toString())),
+                stoull(string(index.z, index.n))));
+}
+#line 2248 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+  yy_destructor(index);
+  yy_constructor< Projection >(std::addressof(yymsp[-3].minor.yy168), std::move(A));
+}
+        break;
+      case 31: /* proj_item ::= IDENTITY LP projections RP LB cond RB */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-5].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-3].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+   Projection  A;
+  auto &fName=yy_cast< Token >(std::addressof(yymsp[-6].minor.yy0));
+  auto &fArgs=yy_cast< vector<Projection> >(std::addressof(yymsp[-4].minor.yy83));
+  auto &c=yy_cast< Condition >(std::addressof(yymsp[-1].minor.yy12));
+#line 207 "/root/repo/src/sql_parser.y"
+{
+    A = Projection(
+        ProjectionType::CONDITION,
+        make_shared<pair<Projection, Condition>>(
+            Projection(ProjectionType::FUNCTION, make_shared<Function>(fName.toString(), move(fArgs))),
+            c));
+}
+#line 2272 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(fName);
+  yy_destructor(fArgs);
+  yy_destructor(c);
+  yy_constructor< Projection >(std::addressof(yymsp[-6].minor.yy168), std::move(A));
+}
+        break;
+      case 32: /* from_opt ::= */
+      case 59: /* from_edge_opt ::= */ yytestcase(yyruleno==59);
+      case 61: /* to_edge_opt ::= */ yytestcase(yyruleno==61);
+{
+  auto &A=yy_constructor< Target >(std::addressof(yymsp[1].minor.yy76));
+#line 217 "/root/repo/src/sql_parser.y"
+{ A = Target(); }
+#line 2286 "/root/repo/src/sql_parser.cpp"
+}
+        break;
+      case 33: /* from_opt ::= FROM select_target */
+      case 60: /* from_edge_opt ::= FROM select_target_without_class */ yytestcase(yyruleno==60);
+      case 62: /* to_edge_opt ::= TO select_target_without_class */ yytestcase(yyruleno==62);
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+  auto &A=yy_constructor< Target >(std::addressof(yymsp[-1].minor.yy76));
+  auto &X=yy_cast< Target >(std::addressof(yymsp[0].minor.yy76));
+#line 218 "/root/repo/src/sql_parser.y"
+{ A = X; }
+#line 2298 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+}
+        break;
+      case 34: /* select_target ::= IDENTITY|STRING */
+{
+   Target  A;
+  auto &class_=yy_cast< Token >(std::addressof(yymsp[0].minor.yy0));
+#line 221 "/root/repo/src/sql_parser.y"
+{
+    A = Target(TargetType::CLASS, make_shared<string>(class_.toString()));
+}
+#line 2310 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(class_);
+  yy_constructor< Target >(std::addressof(yymsp[0].minor.yy76), std::move(A));
+}
+        break;
+      case 35: /* select_target ::= select_target_without_class */
+{
+   Target  A;
+  auto &X=yy_cast< Target >(std::addressof(yymsp[0].minor.yy76));
+#line 224 "/root/repo/src/sql_parser.y"
+{ A = X; }
+#line 2321 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+  yy_constructor< Target >(std::addressof(yymsp[0].minor.yy76), std::move(A));
+}
+        break;
+      case 36: /* select_target_without_class ::= select_target_rids */
+{
+   Target  A;
+  auto &rids=yy_cast< RecordDescriptorSet >(std::addressof(yymsp[0].minor.yy197));
+#line 227 "/root/repo/src/sql_parser.y"
+{
+    A = Target(TargetType::RIDS, make_shared<RecordDescriptorSet>(move(rids)));
+}
+#line 2334 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(rids);
+  yy_constructor< Target >(std::addressof(yymsp[0].minor.yy76), std::move(A));
+}
+        break;
+      case 37: /* select_target_without_class ::= LP select_stmt RP */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &A=yy_constructor< Target >(std::addressof(yymsp[-2].minor.yy76));
+  auto &stmt=yy_cast< SelectArgs >(std::addressof(yymsp[-1].minor.yy54));
+#line 230 "/root/repo/src/sql_parser.y"
+{
+    A = Target(TargetType::NESTED, make_shared<SelectArgs>(move(stmt)));
+}
+#line 2349 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(stmt);
+}
+        break;
+      case 38: /* select_target_without_class ::= LP traverse_stmt RP */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &A=yy_constructor< Target >(std::addressof(yymsp[-2].minor.yy76));
+  auto &stmt=yy_cast< TraverseArgs >(std::addressof(yymsp[-1].minor.yy164));
+#line 233 "/root/repo/src/sql_parser.y"
+{
+    A = Target(TargetType::NESTED_TRAVERSE, make_shared<TraverseArgs>(move(stmt)));
+}
+#line 2363 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(stmt);
+}
+        break;
+      case 39: /* select_target_rids ::= rid */
+      case 93: /* rid_set ::= rid */ yytestcase(yyruleno==93);
+{
+   RecordDescriptorSet  A;
+  auto &X=yy_cast< RecordDescriptor >(std::addressof(yymsp[0].minor.yy225));
+#line 238 "/root/repo/src/sql_parser.y"
+{ A = RecordDescriptorSet{X}; }
+#line 2374 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+  yy_constructor< RecordDescriptorSet >(std::addressof(yymsp[0].minor.yy197), std::move(A));
+}
+        break;
+      case 40: /* select_target_rids ::= LP rid_set RP */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &A=yy_constructor< RecordDescriptorSet >(std::addressof(yymsp[-2].minor.yy197));
+  auto &X=yy_cast< RecordDescriptorSet >(std::addressof(yymsp[-1].minor.yy197));
+#line 239 "/root/repo/src/sql_parser.y"
+{ A = X; }
+#line 2387 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+}
+        break;
+      case 41: /* where_opt ::= */
+{
+  auto &A=yy_constructor< Where >(std::addressof(yymsp[1].minor.yy144));
+#line 243 "/root/repo/src/sql_parser.y"
+{ A = Where(); }
+#line 2396 "/root/repo/src/sql_parser.cpp"
+}
+        break;
+      case 42: /* where_opt ::= WHERE multi_cond */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+  auto &A=yy_constructor< Where >(std::addressof(yymsp[-1].minor.yy144));
+  auto &X=yy_cast< shared_ptr<MultiCondition> >(std::addressof(yymsp[0].minor.yy203));
+#line 244 "/root/repo/src/sql_parser.y"
+{
+    A = Where(WhereType::MULTI_COND, X);
+}
+#line 2408 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+}
+        break;
+      case 43: /* where_opt ::= WHERE cond */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+  auto &A=yy_constructor< Where >(std::addressof(yymsp[-1].minor.yy144));
+  auto &X=yy_cast< Condition >(std::addressof(yymsp[0].minor.yy12));
+#line 247 "/root/repo/src/sql_parser.y"
+{
+    A = Where(WhereType::CONDITION, make_shared<Condition>(move(X)));
+}
+#line 2421 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+}
+        break;
+      case 44: /* group_by ::= */
+{
+  auto &A=yy_constructor< vector<string> >(std::addressof(yymsp[1].minor.yy137));
+#line 253 "/root/repo/src/sql_parser.y"
+{ A = vector<string>(); }
+#line 2430 "/root/repo/src/sql_parser.cpp"
+}
+        break;
+      case 45: /* group_by ::= GROUP BY group_keys */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+  auto &A=yy_constructor< vector<string> >(std::addressof(yymsp[-2].minor.yy137));
+  auto &X=yy_cast< vector<string> >(std::addressof(yymsp[0].minor.yy137));
+#line 254 "/root/repo/src/sql_parser.y"
+{ A = move(X); }
+#line 2441 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+}
+        break;
+      case 48: /* skip ::= */
+      case 50: /* limit ::= */ yytestcase(yyruleno==50);
+{
+  auto &A=yy_constructor< int >(std::addressof(yymsp[1].minor.yy202));
+#line 270 "/root/repo/src/sql_parser.y"
+{ A = -1; }
+#line 2451 "/root/repo/src/sql_parser.cpp"
+}
+        break;
+      case 49: /* skip ::= SKIP SIGNED|UNSIGNED */
+      case 51: /* limit ::= LIMIT SIGNED|UNSIGNED */ yytestcase(yyruleno==51);
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+  auto &A=yy_constructor< int >(std::addressof(yymsp[-1].minor.yy202));
+  auto &X=yy_cast< Token >(std::addressof(yymsp[0].minor.yy0));
+#line 271 "/root/repo/src/sql_parser.y"
+{ A = stoi(string(X.z, X.n)); }
+#line 2462 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+}
+        break;
+      case 52: /* cmd ::= update_stmt SEMI */
+{
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &stmt=yy_cast< UpdateArgs >(std::addressof(yymsp[-1].minor.yy25));
+#line 280 "/root/repo/src/sql_parser.y"
+{
+    this->update(stmt);
+}
+#line 2474 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(stmt);
+  yy_constructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+}
+        break;
+      case 53: /* update_stmt ::= UPDATE select_target props_opt where_opt */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-3].minor.yy0));
+  auto &A=yy_constructor< UpdateArgs >(std::addressof(yymsp[-3].minor.yy25));
+  auto &target=yy_cast< Target >(std::addressof(yymsp[-2].minor.yy76));
+  auto &prop=yy_cast< nogdb::Record >(std::addressof(yymsp[-1].minor.yy104));
+  auto &where=yy_cast< Where >(std::addressof(yymsp[0].minor.yy144));
+#line 285 "/root/repo/src/sql_parser.y"
+{
+    A = UpdateArgs{move(target), move(prop), move(where)};
+}
+#line 2490 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(target);
+  yy_destructor(prop);
+  yy_destructor(where);
+}
+        break;
+      case 54: /* cmd ::= delete_vertex_stmt SEMI */
+{
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &stmt=yy_cast< DeleteVertexArgs >(std::addressof(yymsp[-1].minor.yy79));
+#line 291 "/root/repo/src/sql_parser.y"
+{
+    this->deleteVertex(stmt);
+}
+#line 2504 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(stmt);
+  yy_constructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+}
+        break;
+      case 55: /* delete_vertex_stmt ::= DELETE VERTEX select_target where_opt */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-3].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  auto &A=yy_constructor< DeleteVertexArgs >(std::addressof(yymsp[-3].minor.yy79));
+  auto &target=yy_cast< Target >(std::addressof(yymsp[-1].minor.yy76));
+  auto &where=yy_cast< Where >(std::addressof(yymsp[0].minor.yy144));
+#line 296 "/root/repo/src/sql_parser.y"
+{
+    A = DeleteVertexArgs{move(target), move(where)};
+}
+#line 2520 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(target);
+  yy_destructor(where);
+}
+        break;
+      case 56: /* cmd ::= delete_edge_stmt SEMI */
+{
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &stmt=yy_cast< DeleteEdgeArgs >(std::addressof(yymsp[-1].minor.yy132));
+#line 302 "/root/repo/src/sql_parser.y"
+{
+    this->deleteEdge(stmt);
+}
+#line 2533 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(stmt);
+  yy_constructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+}
+        break;
+      case 57: /* delete_edge_stmt ::= DELETE EDGE select_target_rids */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+  auto &A=yy_constructor< DeleteEdgeArgs >(std::addressof(yymsp[-2].minor.yy132));
+  auto &rids=yy_cast< RecordDescriptorSet >(std::addressof(yymsp[0].minor.yy197));
+#line 307 "/root/repo/src/sql_parser.y"
+{
+    auto target = Target(TargetType::RIDS, make_shared<RecordDescriptorSet>(move(rids)));
+    A = DeleteEdgeArgs{move(target), Target(), Target(), Where()};
+}
+#line 2549 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(rids);
+}
+        break;
+      case 58: /* delete_edge_stmt ::= DELETE EDGE IDENTITY|STRING from_edge_opt to_edge_opt where_opt */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-5].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-4].minor.yy0));
+  auto &A=yy_constructor< DeleteEdgeArgs >(std::addressof(yymsp[-5].minor.yy132));
+  auto &name=yy_cast< Token >(std::addressof(yymsp[-3].minor.yy0));
+  auto &from=yy_cast< Target >(std::addressof(yymsp[-2].minor.yy76));
+  auto &to=yy_cast< Target >(std::addressof(yymsp[-1].minor.yy76));
+  auto &where=yy_cast< Where >(std::addressof(yymsp[0].minor.yy144));
+#line 311 "/root/repo/src/sql_parser.y"
+{
+    auto target = Target(TargetType::CLASS, make_shared<string>(name.toString()));
+    A = DeleteEdgeArgs{move(target), move(from), move(to), move(where)};
+}
+#line 2567 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(name);
+  yy_destructor(from);
+  yy_destructor(to);
+  yy_destructor(where);
+}
+        break;
+      case 63: /* cmd ::= traverse_stmt SEMI */
+{
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &stmt=yy_cast< TraverseArgs >(std::addressof(yymsp[-1].minor.yy164));
+#line 326 "/root/repo/src/sql_parser.y"
+{
+    this->traverse(stmt);
+}
+#line 2582 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(stmt);
+  yy_constructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+}
+        break;
+      case 64: /* traverse_stmt ::= TRAVERSE IDENTITY LP class_filter RP FROM rid_set min_depth_opt max_depth_opt strategy_opt */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-9].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-7].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-5].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-4].minor.yy0));
+  auto &A=yy_constructor< TraverseArgs >(std::addressof(yymsp[-9].minor.yy164));
+  auto &direction=yy_cast< Token >(std::addressof(yymsp[-8].minor.yy0));
+  auto &filter=yy_cast< set<string> >(std::addressof(yymsp[-6].minor.yy232));
+  auto &root=yy_cast< RecordDescriptorSet >(std::addressof(yymsp[-3].minor.yy197));
+  auto &min_depth=yy_cast< long long >(std::addressof(yymsp[-2].minor.yy105));
+  auto &max_depth=yy_cast< long long >(std::addressof(yymsp[-1].minor.yy105));
+  auto &strategy=yy_cast< string >(std::addressof(yymsp[0].minor.yy32));
+#line 336 "/root/repo/src/sql_parser.y"
+{
+    A = TraverseArgs{direction.toString(), filter, root, min_depth, max_depth, strategy};
+}
+#line 2604 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(direction);
+  yy_destructor(filter);
+  yy_destructor(root);
+  yy_destructor(min_depth);
+  yy_destructor(max_depth);
+  yy_destructor(strategy);
+}
+        break;
+      case 65: /* class_filter ::= */
+{
+  auto &A=yy_constructor< set<string> >(std::addressof(yymsp[1].minor.yy232));
+#line 341 "/root/repo/src/sql_parser.y"
+{ A = set<string>(); }
+#line 2618 "/root/repo/src/sql_parser.cpp"
+}
+        break;
+      case 66: /* class_filter ::= name_set */
+{
+   set<string>  A;
+  auto &X=yy_cast< set<string> >(std::addressof(yymsp[0].minor.yy232));
+#line 342 "/root/repo/src/sql_parser.y"
+{ A = move(X); }
+#line 2627 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+  yy_constructor< set<string> >(std::addressof(yymsp[0].minor.yy232), std::move(A));
+}
+        break;
+      case 67: /* min_depth_opt ::= */
+{
+  auto &A=yy_constructor< long long >(std::addressof(yymsp[1].minor.yy105));
+#line 345 "/root/repo/src/sql_parser.y"
+{ A = 0; }
+#line 2637 "/root/repo/src/sql_parser.cpp"
+}
+        break;
+      case 68: /* min_depth_opt ::= MINDEPTH SIGNED|UNSIGNED */
+      case 70: /* max_depth_opt ::= MAXDEPTH SIGNED|UNSIGNED */ yytestcase(yyruleno==70);
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+  auto &A=yy_constructor< long long >(std::addressof(yymsp[-1].minor.yy105));
+  auto &X=yy_cast< Token >(std::addressof(yymsp[0].minor.yy0));
+#line 346 "/root/repo/src/sql_parser.y"
+{ A = stoll(string(X.z, X.n)); }
+#line 2648 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+}
+        break;
+      case 69: /* max_depth_opt ::= */
+{
+  auto &A=yy_constructor< long long >(std::addressof(yymsp[1].minor.yy105));
+#line 349 "/root/repo/src/sql_parser.y"
+{ A = UINT_MAX; }
+#line 2657 "/root/repo/src/sql_parser.cpp"
+}
+        break;
+      case 71: /* strategy_opt ::= */
+{
+  auto &A=yy_constructor< string >(std::addressof(yymsp[1].minor.yy32));
+#line 354 "/root/repo/src/sql_parser.y"
+{ A = "BREADTH_FIRST"; }
+#line 2665 "/root/repo/src/sql_parser.cpp"
+}
+        break;
+      case 72: /* strategy_opt ::= STRATEGY IDENTITY */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+  auto &A=yy_constructor< string >(std::addressof(yymsp[-1].minor.yy32));
+  auto &X=yy_cast< Token >(std::addressof(yymsp[0].minor.yy0));
+#line 355 "/root/repo/src/sql_parser.y"
+{ A = X.toString(); }
+#line 2675 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+}
+        break;
+      case 73: /* cmd ::= CREATE INDEX IDENTITY|STRING DOT IDENTITY|STRING index_type SEMI */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-6].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-5].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-3].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &className=yy_cast< Token >(std::addressof(yymsp[-4].minor.yy0));
+  auto &propName=yy_cast< Token >(std::addressof(yymsp[-2].minor.yy0));
+  auto &type=yy_cast< Token >(std::addressof(yymsp[-1].minor.yy0));
+#line 359 "/root/repo/src/sql_parser.y"
+{
+    this->createIndex(className, propName, type);
+}
+#line 2692 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(className);
+  yy_destructor(propName);
+  yy_destructor(type);
+  yy_constructor< Token >(std::addressof(yymsp[-6].minor.yy0));
+}
+        break;
+      case 74: /* cmd ::= DROP INDEX IDENTITY|STRING DOT IDENTITY|STRING SEMI */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-5].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-4].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &className=yy_cast< Token >(std::addressof(yymsp[-3].minor.yy0));
+  auto &propName=yy_cast< Token >(std::addressof(yymsp[-1].minor.yy0));
+#line 364 "/root/repo/src/sql_parser.y"
+{
+    this->dropIndex(className, propName);
+}
+#line 2711 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(className);
+  yy_destructor(propName);
+  yy_constructor< Token >(std::addressof(yymsp[-5].minor.yy0));
+}
+        break;
+      case 75: /* index_type ::= IDENTITY */
+      case 131: /* term_token ::= NULL|FLOAT|STRING|SIGNED|UNSIGNED|BLOB */ yytestcase(yyruleno==131);
+{
+   Token  A;
+  auto &X=yy_cast< Token >(std::addressof(yymsp[0].minor.yy0));
+#line 370 "/root/repo/src/sql_parser.y"
+{ A = X; }
+#line 2724 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+  yy_constructor< Token >(std::addressof(yymsp[0].minor.yy0), std::move(A));
+}
+        break;
+      case 76: /* cmd ::= ANALYZE IDENTITY|STRING SEMI */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &className=yy_cast< Token >(std::addressof(yymsp[-1].minor.yy0));
+#line 373 "/root/repo/src/sql_parser.y"
+{
+    this->analyze(className);
+}
+#line 2738 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(className);
+  yy_constructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+}
+        break;
+      case 77: /* cmd ::= EXPLAIN select_stmt SEMI */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &stmt=yy_cast< SelectArgs >(std::addressof(yymsp[-1].minor.yy54));
+#line 382 "/root/repo/src/sql_parser.y"
+{
+    this->explain(stmt);
+}
+#line 2752 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(stmt);
+  yy_constructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+}
+        break;
+      case 78: /* cmd ::= EXPLAIN traverse_stmt SEMI */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &stmt=yy_cast< TraverseArgs >(std::addressof(yymsp[-1].minor.yy164));
+#line 385 "/root/repo/src/sql_parser.y"
+{
+    this->explain(stmt);
+}
+#line 2766 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(stmt);
+  yy_constructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+}
+        break;
+      case 79: /* cmd ::= PROFILE select_stmt SEMI */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &stmt=yy_cast< SelectArgs >(std::addressof(yymsp[-1].minor.yy54));
+#line 388 "/root/repo/src/sql_parser.y"
+{
+    this->profile(stmt);
+}
+#line 2780 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(stmt);
+  yy_constructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+}
+        break;
+      case 80: /* cmd ::= PROFILE traverse_stmt SEMI */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &stmt=yy_cast< TraverseArgs >(std::addressof(yymsp[-1].minor.yy164));
+#line 391 "/root/repo/src/sql_parser.y"
+{
+    this->profile(stmt);
+}
+#line 2794 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(stmt);
+  yy_constructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+}
+        break;
+      case 81: /* if_not_exists_opt ::= */
+      case 83: /* if_exists_opt ::= */ yytestcase(yyruleno==83);
+{
+  auto &A=yy_constructor< bool >(std::addressof(yymsp[1].minor.yy65));
+#line 400 "/root/repo/src/sql_parser.y"
+{ A = false; }
+#line 2805 "/root/repo/src/sql_parser.cpp"
+}
+        break;
+      case 82: /* if_not_exists_opt ::= IF NOT EXISTS */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &A=yy_constructor< bool >(std::addressof(yymsp[-2].minor.yy65));
+#line 401 "/root/repo/src/sql_parser.y"
+{ A = true; }
+#line 2816 "/root/repo/src/sql_parser.cpp"
+}
+        break;
+      case 84: /* if_exists_opt ::= IF EXISTS */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &A=yy_constructor< bool >(std::addressof(yymsp[-1].minor.yy65));
+#line 403 "/root/repo/src/sql_parser.y"
+{ A = true; }
+#line 2826 "/root/repo/src/sql_parser.cpp"
+}
+        break;
+      case 85: /* props_opt ::= */
+{
+  auto &A=yy_constructor< nogdb::Record >(std::addressof(yymsp[1].minor.yy104));
+#line 408 "/root/repo/src/sql_parser.y"
+{ A = nogdb::Record(); }
+#line 2834 "/root/repo/src/sql_parser.cpp"
+}
+        break;
+      case 86: /* props_opt ::= SET props_list */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+  auto &A=yy_constructor< nogdb::Record >(std::addressof(yymsp[-1].minor.yy104));
+  auto &X=yy_cast< nogdb::Record >(std::addressof(yymsp[0].minor.yy104));
+#line 409 "/root/repo/src/sql_parser.y"
+{ A = move(X); }
+#line 2844 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+}
+        break;
+      case 87: /* props_list ::= props_list COMMA prop_name EQ term */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-3].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+  auto &A=yy_cast< nogdb::Record >(std::addressof(yymsp[-4].minor.yy104));
+  auto &prop=yy_cast< string >(std::addressof(yymsp[-2].minor.yy32));
+  auto &value=yy_cast< Bytes >(std::addressof(yymsp[0].minor.yy130));
+#line 410 "/root/repo/src/sql_parser.y"
+{
+    A.set(prop, value.getBase());
+}
+#line 2859 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(prop);
+  yy_destructor(value);
+}
+        break;
+      case 88: /* props_list ::= prop_name EQ term */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   nogdb::Record  A;
+  auto &prop=yy_cast< string >(std::addressof(yymsp[-2].minor.yy32));
+  auto &value=yy_cast< Bytes >(std::addressof(yymsp[0].minor.yy130));
+#line 413 "/root/repo/src/sql_parser.y"
+{
+    A = nogdb::Record().set(prop, value.getBase());
+}
+#line 2874 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(prop);
+  yy_destructor(value);
+  yy_constructor< nogdb::Record >(std::addressof(yymsp[-2].minor.yy104), std::move(A));
+}
+        break;
+      case 89: /* prop_name ::= IDENTITY|STRING */
+{
+   string  A;
+  auto &X=yy_cast< Token >(std::addressof(yymsp[0].minor.yy0));
+#line 418 "/root/repo/src/sql_parser.y"
+{ A = X.toString(); }
+#line 2886 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+  yy_constructor< string >(std::addressof(yymsp[0].minor.yy32), std::move(A));
+}
+        break;
+      case 90: /* prop_name ::= AT IDENTITY */
+{
+   string  A;
+  auto &X=yy_cast< Token >(std::addressof(yymsp[-1].minor.yy0));
+  auto &Y=yy_cast< Token >(std::addressof(yymsp[0].minor.yy0));
+#line 419 "/root/repo/src/sql_parser.y"
+{
+    A = string(X.z, (Y.z + Y.n) - X.z);
+    this->hasDepthProperty |= (A == nogdb::DEPTH_PROPERTY);
+}
+#line 2901 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+  yy_destructor(Y);
+  yy_constructor< string >(std::addressof(yymsp[-1].minor.yy32), std::move(A));
+}
+        break;
+      case 91: /* rid ::= SHARP SIGNED|UNSIGNED COLON SIGNED|UNSIGNED */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-3].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+  auto &A=yy_constructor< RecordDescriptor >(std::addressof(yymsp[-3].minor.yy225));
+  auto &class_id=yy_cast< Token >(std::addressof(yymsp[-2].minor.yy0));
+  auto &pos_id=yy_cast< Token >(std::addressof(yymsp[0].minor.yy0));
+#line 426 "/root/repo/src/sql_parser.y"
+{
+    A = RecordDescriptor(stoi(string(class_id.z, class_id.n)), stoi(string(pos_id.z, pos_id.n)));
+}
+#line 2918 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(class_id);
+  yy_destructor(pos_id);
+}
+        break;
+      case 92: /* rid_set ::= rid_set COMMA rid */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+  auto &A=yy_cast< RecordDescriptorSet >(std::addressof(yymsp[-2].minor.yy197));
+  auto &X=yy_cast< RecordDescriptor >(std::addressof(yymsp[0].minor.yy225));
+#line 434 "/root/repo/src/sql_parser.y"
+{ A.insert(move(X)); }
+#line 2930 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+}
+        break;
+      case 94: /* name_set ::= name_set COMMA IDENTITY|STRING */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+  auto &A=yy_cast< set<string> >(std::addressof(yymsp[-2].minor.yy232));
+  auto &X=yy_cast< Token >(std::addressof(yymsp[0].minor.yy0));
+#line 439 "/root/repo/src/sql_parser.y"
+{ A.insert(X.toString()); }
+#line 2941 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+}
+        break;
+      case 95: /* name_set ::= IDENTITY|STRING */
+{
+   set<string>  A;
+  auto &X=yy_cast< Token >(std::addressof(yymsp[0].minor.yy0));
+#line 440 "/root/repo/src/sql_parser.y"
+{ A = set<string>{X.toString()}; }
+#line 2951 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+  yy_constructor< set<string> >(std::addressof(yymsp[0].minor.yy232), std::move(A));
+}
+        break;
+      case 96: /* term_list ::= term_list COMMA term */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+  auto &A=yy_cast< vector<Bytes> >(std::addressof(yymsp[-2].minor.yy129));
+  auto &X=yy_cast< Bytes >(std::addressof(yymsp[0].minor.yy130));
+#line 444 "/root/repo/src/sql_parser.y"
+{ A.push_back(move(X)); }
+#line 2963 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+}
+        break;
+      case 97: /* term_list ::= term */
+{
+   vector<Bytes>  A;
+  auto &X=yy_cast< Bytes >(std::addressof(yymsp[0].minor.yy130));
+#line 445 "/root/repo/src/sql_parser.y"
+{ A = vector<Bytes>{move(X)}; }
+#line 2973 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+  yy_constructor< vector<Bytes> >(std::addressof(yymsp[0].minor.yy129), std::move(A));
+}
+        break;
+      case 98: /* multi_cond ::= LP multi_cond RP */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &A=yy_constructor< shared_ptr<MultiCondition> >(std::addressof(yymsp[-2].minor.yy203));
+  auto &X=yy_cast< shared_ptr<MultiCondition> >(std::addressof(yymsp[-1].minor.yy203));
+#line 456 "/root/repo/src/sql_parser.y"
+{ A = X; }
+#line 2986 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+}
+        break;
+      case 99: /* multi_cond ::= multi_cond AND multi_cond */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   shared_ptr<MultiCondition>  A;
+  auto &X=yy_cast< shared_ptr<MultiCondition> >(std::addressof(yymsp[-2].minor.yy203));
+  auto &Y=yy_cast< shared_ptr<MultiCondition> >(std::addressof(yymsp[0].minor.yy203));
+#line 457 "/root/repo/src/sql_parser.y"
+{ A = make_shared<MultiCondition>(*X && *Y); }
+#line 2998 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+  yy_destructor(Y);
+  yy_constructor< shared_ptr<MultiCondition> >(std::addressof(yymsp[-2].minor.yy203), std::move(A));
+}
+        break;
+      case 100: /* multi_cond ::= multi_cond OR multi_cond */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   shared_ptr<MultiCondition>  A;
+  auto &X=yy_cast< shared_ptr<MultiCondition> >(std::addressof(yymsp[-2].minor.yy203));
+  auto &Y=yy_cast< shared_ptr<MultiCondition> >(std::addressof(yymsp[0].minor.yy203));
+#line 458 "/root/repo/src/sql_parser.y"
+{ A = make_shared<MultiCondition>(*X || *Y); }
+#line 3012 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+  yy_destructor(Y);
+  yy_constructor< shared_ptr<MultiCondition> >(std::addressof(yymsp[-2].minor.yy203), std::move(A));
+}
+        break;
+      case 101: /* multi_cond ::= multi_cond AND cond */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   shared_ptr<MultiCondition>  A;
+  auto &X=yy_cast< shared_ptr<MultiCondition> >(std::addressof(yymsp[-2].minor.yy203));
+  auto &Y=yy_cast< Condition >(std::addressof(yymsp[0].minor.yy12));
+#line 459 "/root/repo/src/sql_parser.y"
+{ A = make_shared<MultiCondition>(*X && Y); }
+#line 3026 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+  yy_destructor(Y);
+  yy_constructor< shared_ptr<MultiCondition> >(std::addressof(yymsp[-2].minor.yy203), std::move(A));
+}
+        break;
+      case 102: /* multi_cond ::= multi_cond OR cond */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   shared_ptr<MultiCondition>  A;
+  auto &X=yy_cast< shared_ptr<MultiCondition> >(std::addressof(yymsp[-2].minor.yy203));
+  auto &Y=yy_cast< Condition >(std::addressof(yymsp[0].minor.yy12));
+#line 460 "/root/repo/src/sql_parser.y"
+{ A = make_shared<MultiCondition>(*X || Y); }
+#line 3040 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+  yy_destructor(Y);
+  yy_constructor< shared_ptr<MultiCondition> >(std::addressof(yymsp[-2].minor.yy203), std::move(A));
+}
+        break;
+      case 103: /* multi_cond ::= cond AND multi_cond */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   shared_ptr<MultiCondition>  A;
+  auto &X=yy_cast< Condition >(std::addressof(yymsp[-2].minor.yy12));
+  auto &Y=yy_cast< shared_ptr<MultiCondition> >(std::addressof(yymsp[0].minor.yy203));
+#line 461 "/root/repo/src/sql_parser.y"
+{ A = make_shared<MultiCondition>(X && *Y); }
+#line 3054 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+  yy_destructor(Y);
+  yy_constructor< shared_ptr<MultiCondition> >(std::addressof(yymsp[-2].minor.yy203), std::move(A));
+}
+        break;
+      case 104: /* multi_cond ::= cond OR multi_cond */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   shared_ptr<MultiCondition>  A;
+  auto &X=yy_cast< Condition >(std::addressof(yymsp[-2].minor.yy12));
+  auto &Y=yy_cast< shared_ptr<MultiCondition> >(std::addressof(yymsp[0].minor.yy203));
+#line 462 "/root/repo/src/sql_parser.y"
+{ A = make_shared<MultiCondition>(X || *Y); }
+#line 3068 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+  yy_destructor(Y);
+  yy_constructor< shared_ptr<MultiCondition> >(std::addressof(yymsp[-2].minor.yy203), std::move(A));
+}
+        break;
+      case 105: /* multi_cond ::= cond AND cond */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   shared_ptr<MultiCondition>  A;
+  auto &X=yy_cast< Condition >(std::addressof(yymsp[-2].minor.yy12));
+  auto &Y=yy_cast< Condition >(std::addressof(yymsp[0].minor.yy12));
+#line 463 "/root/repo/src/sql_parser.y"
+{ A = make_shared<MultiCondition>(X && Y); }
+#line 3082 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+  yy_destructor(Y);
+  yy_constructor< shared_ptr<MultiCondition> >(std::addressof(yymsp[-2].minor.yy203), std::move(A));
+}
+        break;
+      case 106: /* multi_cond ::= cond OR cond */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   shared_ptr<MultiCondition>  A;
+  auto &X=yy_cast< Condition >(std::addressof(yymsp[-2].minor.yy12));
+  auto &Y=yy_cast< Condition >(std::addressof(yymsp[0].minor.yy12));
+#line 464 "/root/repo/src/sql_parser.y"
+{ A = make_shared<MultiCondition>(X || Y); }
+#line 3096 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+  yy_destructor(Y);
+  yy_constructor< shared_ptr<MultiCondition> >(std::addressof(yymsp[-2].minor.yy203), std::move(A));
+}
+        break;
+      case 107: /* multi_cond ::= NOT multi_cond */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+  auto &A=yy_constructor< shared_ptr<MultiCondition> >(std::addressof(yymsp[-1].minor.yy203));
+  auto &X=yy_cast< shared_ptr<MultiCondition> >(std::addressof(yymsp[0].minor.yy203));
+#line 465 "/root/repo/src/sql_parser.y"
+{ A = make_shared<MultiCondition>(!(*X)); }
+#line 3109 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+}
+        break;
+      case 108: /* cond ::= LP cond RP */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  auto &A=yy_constructor< Condition >(std::addressof(yymsp[-2].minor.yy12));
+  auto &X=yy_cast< Condition >(std::addressof(yymsp[-1].minor.yy12));
+#line 468 "/root/repo/src/sql_parser.y"
+{ A = move(X); }
+#line 3121 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+}
+        break;
+      case 109: /* cond ::= NOT cond */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+  auto &A=yy_constructor< Condition >(std::addressof(yymsp[-1].minor.yy12));
+  auto &X=yy_cast< Condition >(std::addressof(yymsp[0].minor.yy12));
+#line 469 "/root/repo/src/sql_parser.y"
+{ A = !X; }
+#line 3132 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+}
+        break;
+      case 110: /* cond ::= prop_name EQ term */
+      case 116: /* cond ::= prop_name IS term */ yytestcase(yyruleno==116);
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   Condition  A;
+  auto &prop=yy_cast< string >(std::addressof(yymsp[-2].minor.yy32));
+  auto &value=yy_cast< Bytes >(std::addressof(yymsp[0].minor.yy130));
+#line 470 "/root/repo/src/sql_parser.y"
+{ A = Condition(prop).eq(value); }
+#line 3145 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(prop);
+  yy_destructor(value);
+  yy_constructor< Condition >(std::addressof(yymsp[-2].minor.yy12), std::move(A));
+}
+        break;
+      case 111: /* cond ::= prop_name NE term */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   Condition  A;
+  auto &prop=yy_cast< string >(std::addressof(yymsp[-2].minor.yy32));
+  auto &value=yy_cast< Bytes >(std::addressof(yymsp[0].minor.yy130));
+#line 471 "/root/repo/src/sql_parser.y"
+{ A = !Condition(prop).eq(value); }
+#line 3159 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(prop);
+  yy_destructor(value);
+  yy_constructor< Condition >(std::addressof(yymsp[-2].minor.yy12), std::move(A));
+}
+        break;
+      case 112: /* cond ::= prop_name GT term */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   Condition  A;
+  auto &prop=yy_cast< string >(std::addressof(yymsp[-2].minor.yy32));
+  auto &value=yy_cast< Bytes >(std::addressof(yymsp[0].minor.yy130));
+#line 472 "/root/repo/src/sql_parser.y"
+{ A = Condition(prop).gt(value.getBase()); }
+#line 3173 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(prop);
+  yy_destructor(value);
+  yy_constructor< Condition >(std::addressof(yymsp[-2].minor.yy12), std::move(A));
+}
+        break;
+      case 113: /* cond ::= prop_name LT term */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   Condition  A;
+  auto &prop=yy_cast< string >(std::addressof(yymsp[-2].minor.yy32));
+  auto &value=yy_cast< Bytes >(std::addressof(yymsp[0].minor.yy130));
+#line 473 "/root/repo/src/sql_parser.y"
+{ A = Condition(prop).lt(value.getBase()); }
+#line 3187 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(prop);
+  yy_destructor(value);
+  yy_constructor< Condition >(std::addressof(yymsp[-2].minor.yy12), std::move(A));
+}
+        break;
+      case 114: /* cond ::= prop_name GE term */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   Condition  A;
+  auto &prop=yy_cast< string >(std::addressof(yymsp[-2].minor.yy32));
+  auto &value=yy_cast< Bytes >(std::addressof(yymsp[0].minor.yy130));
+#line 474 "/root/repo/src/sql_parser.y"
+{ A = Condition(prop).ge(value.getBase()); }
+#line 3201 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(prop);
+  yy_destructor(value);
+  yy_constructor< Condition >(std::addressof(yymsp[-2].minor.yy12), std::move(A));
+}
+        break;
+      case 115: /* cond ::= prop_name LE term */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   Condition  A;
+  auto &prop=yy_cast< string >(std::addressof(yymsp[-2].minor.yy32));
+  auto &value=yy_cast< Bytes >(std::addressof(yymsp[0].minor.yy130));
+#line 475 "/root/repo/src/sql_parser.y"
+{ A = Condition(prop).le(value.getBase()); }
+#line 3215 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(prop);
+  yy_destructor(value);
+  yy_constructor< Condition >(std::addressof(yymsp[-2].minor.yy12), std::move(A));
+}
+        break;
+      case 117: /* cond ::= prop_name IS NOT term */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   Condition  A;
+  auto &prop=yy_cast< string >(std::addressof(yymsp[-3].minor.yy32));
+  auto &value=yy_cast< Bytes >(std::addressof(yymsp[0].minor.yy130));
+#line 477 "/root/repo/src/sql_parser.y"
+{ A = !Condition(prop).eq(value); }
+#line 3230 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(prop);
+  yy_destructor(value);
+  yy_constructor< Condition >(std::addressof(yymsp[-3].minor.yy12), std::move(A));
+}
+        break;
+      case 118: /* cond ::= prop_name CONTAIN CASE term */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   Condition  A;
+  auto &prop=yy_cast< string >(std::addressof(yymsp[-3].minor.yy32));
+  auto &value=yy_cast< Bytes >(std::addressof(yymsp[0].minor.yy130));
+#line 478 "/root/repo/src/sql_parser.y"
+{ A = Condition(prop).contain(value.getBase()); }
+#line 3245 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(prop);
+  yy_destructor(value);
+  yy_constructor< Condition >(std::addressof(yymsp[-3].minor.yy12), std::move(A));
+}
+        break;
+      case 119: /* cond ::= prop_name CONTAIN term */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   Condition  A;
+  auto &prop=yy_cast< string >(std::addressof(yymsp[-2].minor.yy32));
+  auto &value=yy_cast< Bytes >(std::addressof(yymsp[0].minor.yy130));
+#line 479 "/root/repo/src/sql_parser.y"
+{ A = Condition(prop).contain(value.getBase()).ignoreCase(); }
+#line 3259 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(prop);
+  yy_destructor(value);
+  yy_constructor< Condition >(std::addressof(yymsp[-2].minor.yy12), std::move(A));
+}
+        break;
+      case 120: /* cond ::= prop_name BEGIN WITH CASE term */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-3].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   Condition  A;
+  auto &prop=yy_cast< string >(std::addressof(yymsp[-4].minor.yy32));
+  auto &value=yy_cast< Bytes >(std::addressof(yymsp[0].minor.yy130));
+#line 480 "/root/repo/src/sql_parser.y"
+{ A = Condition(prop).beginWith(value.getBase()); }
+#line 3275 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(prop);
+  yy_destructor(value);
+  yy_constructor< Condition >(std::addressof(yymsp[-4].minor.yy12), std::move(A));
+}
+        break;
+      case 121: /* cond ::= prop_name BEGIN WITH term */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   Condition  A;
+  auto &prop=yy_cast< string >(std::addressof(yymsp[-3].minor.yy32));
+  auto &value=yy_cast< Bytes >(std::addressof(yymsp[0].minor.yy130));
+#line 481 "/root/repo/src/sql_parser.y"
+{ A = Condition(prop).beginWith(value.getBase()).ignoreCase(); }
+#line 3290 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(prop);
+  yy_destructor(value);
+  yy_constructor< Condition >(std::addressof(yymsp[-3].minor.yy12), std::move(A));
+}
+        break;
+      case 122: /* cond ::= prop_name END WITH CASE term */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-3].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   Condition  A;
+  auto &prop=yy_cast< string >(std::addressof(yymsp[-4].minor.yy32));
+  auto &value=yy_cast< Bytes >(std::addressof(yymsp[0].minor.yy130));
+#line 482 "/root/repo/src/sql_parser.y"
+{ A = Condition(prop).endWith(value.getBase()); }
+#line 3306 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(prop);
+  yy_destructor(value);
+  yy_constructor< Condition >(std::addressof(yymsp[-4].minor.yy12), std::move(A));
+}
+        break;
+      case 123: /* cond ::= prop_name END WITH term */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   Condition  A;
+  auto &prop=yy_cast< string >(std::addressof(yymsp[-3].minor.yy32));
+  auto &value=yy_cast< Bytes >(std::addressof(yymsp[0].minor.yy130));
+#line 483 "/root/repo/src/sql_parser.y"
+{ A = Condition(prop).endWith(value.getBase()).ignoreCase(); }
+#line 3321 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(prop);
+  yy_destructor(value);
+  yy_constructor< Condition >(std::addressof(yymsp[-3].minor.yy12), std::move(A));
+}
+        break;
+      case 124: /* cond ::= prop_name LIKE CASE term */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   Condition  A;
+  auto &prop=yy_cast< string >(std::addressof(yymsp[-3].minor.yy32));
+  auto &value=yy_cast< Bytes >(std::addressof(yymsp[0].minor.yy130));
+#line 484 "/root/repo/src/sql_parser.y"
+{ A = Condition(prop).like(value.getBase()); }
+#line 3336 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(prop);
+  yy_destructor(value);
+  yy_constructor< Condition >(std::addressof(yymsp[-3].minor.yy12), std::move(A));
+}
+        break;
+      case 125: /* cond ::= prop_name LIKE term */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   Condition  A;
+  auto &prop=yy_cast< string >(std::addressof(yymsp[-2].minor.yy32));
+  auto &value=yy_cast< Bytes >(std::addressof(yymsp[0].minor.yy130));
+#line 485 "/root/repo/src/sql_parser.y"
+{ A = Condition(prop).like(value.getBase()).ignoreCase(); }
+#line 3350 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(prop);
+  yy_destructor(value);
+  yy_constructor< Condition >(std::addressof(yymsp[-2].minor.yy12), std::move(A));
+}
+        break;
+      case 126: /* cond ::= prop_name REGEX CASE term */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   Condition  A;
+  auto &prop=yy_cast< string >(std::addressof(yymsp[-3].minor.yy32));
+  auto &value=yy_cast< Bytes >(std::addressof(yymsp[0].minor.yy130));
+#line 486 "/root/repo/src/sql_parser.y"
+{ A = Condition(prop).regex(value.getBase()); }
+#line 3365 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(prop);
+  yy_destructor(value);
+  yy_constructor< Condition >(std::addressof(yymsp[-3].minor.yy12), std::move(A));
+}
+        break;
+      case 127: /* cond ::= prop_name REGEX term */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   Condition  A;
+  auto &prop=yy_cast< string >(std::addressof(yymsp[-2].minor.yy32));
+  auto &value=yy_cast< Bytes >(std::addressof(yymsp[0].minor.yy130));
+#line 487 "/root/repo/src/sql_parser.y"
+{ A = Condition(prop).regex(value.getBase()).ignoreCase(); }
+#line 3379 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(prop);
+  yy_destructor(value);
+  yy_constructor< Condition >(std::addressof(yymsp[-2].minor.yy12), std::move(A));
+}
+        break;
+      case 128: /* cond ::= prop_name BETWEEN term AND term */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-3].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-1].minor.yy0));
+   Condition  A;
+  auto &prop=yy_cast< string >(std::addressof(yymsp[-4].minor.yy32));
+  auto &value1=yy_cast< Bytes >(std::addressof(yymsp[-2].minor.yy130));
+  auto &value2=yy_cast< Bytes >(std::addressof(yymsp[0].minor.yy130));
+#line 488 "/root/repo/src/sql_parser.y"
+{ A = Condition(prop).between(value1.getBase(), value2.getBase()); }
+#line 3395 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(prop);
+  yy_destructor(value1);
+  yy_destructor(value2);
+  yy_constructor< Condition >(std::addressof(yymsp[-4].minor.yy12), std::move(A));
+}
+        break;
+      case 129: /* cond ::= prop_name IDENTITY LB term_list RB */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+   Condition  A;
+  auto &prop=yy_cast< string >(std::addressof(yymsp[-4].minor.yy32));
+  auto &cmp=yy_cast< Token >(std::addressof(yymsp[-3].minor.yy0));
+  auto &values=yy_cast< vector<Bytes> >(std::addressof(yymsp[-1].minor.yy129));
+#line 489 "/root/repo/src/sql_parser.y"
+{
+    if (strncasecmp(cmp.z, "IN", cmp.n) == 0) {
+        vector<nogdb::Bytes> baseValues(values.size());
+        transform(values.begin(), values.end(), baseValues.begin(), [](const Bytes& v){ return v.getBase(); });
+        A = Condition(prop).in(baseValues);
+    } else {
+        this->syntax_error(-1, cmp);
+    }
+}
+#line 3420 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(prop);
+  yy_destructor(cmp);
+  yy_destructor(values);
+  yy_constructor< Condition >(std::addressof(yymsp[-4].minor.yy12), std::move(A));
+}
+        break;
+      case 130: /* term ::= term_token */
+{
+   Bytes  A;
+  auto &X=yy_cast< Token >(std::addressof(yymsp[0].minor.yy0));
+#line 501 "/root/repo/src/sql_parser.y"
+{ A = X.toBytes(); }
+#line 3433 "/root/repo/src/sql_parser.cpp"
+  yy_destructor(X);
+  yy_constructor< Bytes >(std::addressof(yymsp[0].minor.yy130), std::move(A));
+}
+        break;
+      case 132: /* input ::= cmd */
+      case 137: /* sort_order ::= ASC */ yytestcase(yyruleno==137);
+      case 138: /* sort_order ::= DESC */ yytestcase(yyruleno==138);
+{
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  yy_constructor< Token >(std::addressof(yymsp[0].minor.yy0));
+}
+        break;
+      case 134: /* order_by ::= */
+  yy_constructor< void * >(std::addressof(yymsp[1].minor.yy61));
+        break;
+      case 135: /* order_by ::= ORDER BY name_set sort_order */
+{
+  yy_destructor< Token >(std::addressof(yymsp[-3].minor.yy0));
+  yy_destructor< Token >(std::addressof(yymsp[-2].minor.yy0));
+  yy_destructor< set<string> >(std::addressof(yymsp[-1].minor.yy232));
+  yy_destructor< Token >(std::addressof(yymsp[0].minor.yy0));
+  yy_constructor< void * >(std::addressof(yymsp[-3].minor.yy61));
+}
+        break;
+      case 136: /* sort_order ::= */
+      case 139: /* index_type ::= */ yytestcase(yyruleno==139);
+  yy_constructor< Token >(std::addressof(yymsp[1].minor.yy0));
+        break;
+      default:
+      /* (133) proj_alias ::= proj_item */ yytestcase(yyruleno==133);
+        break;
+/********** End reduce actions ************************************************/
+  };
+  assert( yyruleno<sizeof(yyRuleInfo)/sizeof(yyRuleInfo[0]) );
+  yygoto = yyRuleInfo[yyruleno].lhs;
+  yysize = yyRuleInfo[yyruleno].nrhs;
+  yyact = yy_find_reduce_action(yymsp[yysize].stateno,(YYCODETYPE)yygoto);
+
+  /* There are no SHIFTREDUCE actions on nonterminals because the table
+  ** generator has simplified them to pure REDUCE actions. */
+  assert( !(yyact>YY_MAX_SHIFT && yyact<=YY_MAX_SHIFTREDUCE) );
+
+  /* It is not possible for a REDUCE to be followed by an error */
+  assert( yyact!=YY_ERROR_ACTION );
+
+  if( yyact==YY_ACCEPT_ACTION ){
+    yytos += yysize;
+    yy_accept();
+  }else{
+    yymsp += yysize+1;
+    yytos = yymsp;
+    yymsp->stateno = (YYACTIONTYPE)yyact;
+    yymsp->major = (YYCODETYPE)yygoto;
+    yyTraceShift(yyact);
+  }
+}
+
+/*
+** The following code executes when the parse fails
+*/
+#ifndef YYNOERRORRECOVERY
+void yypParser::yy_parse_failed(){
+#ifndef NDEBUG
+  if( yyTraceFILE ){
+    fprintf(yyTraceFILE,"%sFail!\n",yyTracePrompt);
+  }
+#endif
+  while( yytos>yystack ) yy_pop_parser_stack();
+  /* Here code is inserted which will be executed whenever the
+  ** parser fails */
+/************ Begin %parse_failure code ***************************************/
+/************ End %parse_failure code *****************************************/
+  LEMON_SUPER::parse_failure();
+}
+#endif /* YYNOERRORRECOVERY */
+
+/*
+** The following code executes when a syntax error first occurs.
+*/
+void yypParser::yy_syntax_error(
+  int yymajor,                   /* The major type of the error token */
+  ParseTOKENTYPE &yyminor        /* The minor type of the error token */
+){
+//#define TOKEN yyminor
+  auto &TOKEN = yyminor;
+/************ Begin %syntax_error code ****************************************/
+/************ End %syntax_error code ******************************************/
+  LEMON_SUPER::syntax_error(yymajor, TOKEN);
+}
+
+/*
+** The following is executed when the parser accepts
+*/
+void yypParser::yy_accept(){
+#ifndef NDEBUG
+  if( yyTraceFILE ){
+    fprintf(yyTraceFILE,"%sAccept!\n",yyTracePrompt);
+  }
+#endif
+#ifndef YYNOERRORRECOVERY
+  yyerrcnt = -1;
+#endif
+  assert( yytos==yystack );
+  /* Here code is inserted which will be executed whenever the
+  ** parser accepts */
+/*********** Begin %parse_accept code *****************************************/
+/*********** End %parse_accept code *******************************************/
+  LEMON_SUPER::parse_accept();
+}
+
+/* The main parser program.
+** The first argument is a pointer to a structure obtained from
+** "ParseAlloc" which describes the current state of the parser.
+** The second argument is the major token number.  The third is
+** the minor token.  The fourth optional argument is whatever the
+** user wants (and specified in the grammar) and is available for
+** use by the action routines.
+**
+** Inputs:
+** <ul>
+** <li> A pointer to the parser (an opaque structure.)
+** <li> The major token number.
+** <li> The minor token number.
+** <li> An option argument of a grammar-specified type.
+** </ul>
+**
+** Outputs:
+** None.
+*/
+
+
+
+void yypParser::parse(
+  int yymajor,                 /* The major token code number */
+  ParseTOKENTYPE &&yyminor       /* The value for the token */
+){
+  //YYMINORTYPE yyminorunion;
+  unsigned int yyact;            /* The parser action. */
+#if !defined(YYERRORSYMBOL) && !defined(YYNOERRORRECOVERY)
+  int yyendofinput;     /* True if we are at the end of input */
+#endif
+#ifdef YYERRORSYMBOL
+  int yyerrorhit = 0;   /* True if yymajor has invoked an error */
+#endif
+
+  assert( yytos!=0 );
+
+#if !defined(YYERRORSYMBOL) && !defined(YYNOERRORRECOVERY)
+  yyendofinput = (yymajor==0);
+#endif
+
+#ifndef NDEBUG
+  if( yyTraceFILE ){
+    fprintf(yyTraceFILE,"%sInput '%s'\n",yyTracePrompt,yyTokenName[yymajor]);
+  }
+#endif
+
+  do{
+    yyact = yy_find_shift_action(yytos->stateno, (YYCODETYPE)yymajor);
+    if( yyact <= YY_MAX_SHIFTREDUCE ){
+      yy_shift(yyact,yymajor,std::move(yyminor));
+#ifndef YYNOERRORRECOVERY
+      yyerrcnt--;
+#endif
+      yymajor = YYNOCODE;
+    }else if( yyact <= YY_MAX_REDUCE ){
+      yy_reduce(yyact-YY_MIN_REDUCE);
+    }else{
+      assert( yyact == YY_ERROR_ACTION );
+#ifdef YYERRORSYMBOL
+      int yymx;
+#endif
+#ifndef NDEBUG
+      if( yyTraceFILE ){
+        fprintf(yyTraceFILE,"%sSyntax Error!\n",yyTracePrompt);
+      }
+#endif
+#ifdef YYERRORSYMBOL
+      /* A syntax error has occurred.
+      ** The response to an error depends upon whether or not the
+      ** grammar defines an error token "ERROR".  
+      **
+      ** This is what we do if the grammar does define ERROR:
+      **
+      **  * Call the %syntax_error function.
+      **
+      **  * Begin popping the stack until we enter a state where
+      **    it is legal to shift the error symbol, then shift
+      **    the error symbol.
+      **
+      **  * Set the error count to three.
+      **
+      **  * Begin accepting and shifting new tokens.  No new error
+      **    processing will occur until three tokens have been
+      **    shifted successfully.
+      **
+      */
+      if( yyerrcnt<0 ){
+        yy_syntax_error(yymajor,yyminor);
+      }
+      yymx = yytos->major;
+      if( yymx==YYERRORSYMBOL || yyerrorhit ){
+#ifndef NDEBUG
+        if( yyTraceFILE ){
+          fprintf(yyTraceFILE,"%sDiscard input token %s\n",
+             yyTracePrompt,yyTokenName[yymajor]);
+        }
+#endif
+        //yy_destructor(yyminor);
+        yymajor = YYNOCODE;
+      }else{
+        while( yytos >= yystack
+            && yymx != YYERRORSYMBOL
+            && (yyact = yy_find_reduce_action(
+                        yytos->stateno,
+                        YYERRORSYMBOL)) >= YY_MIN_REDUCE
+        ){
+          yy_pop_parser_stack();
+        }
+        if( yytos < yystack || yymajor==0 ){
+          //yy_destructor(yyminor);
+          yy_parse_failed();
+#ifndef YYNOERRORRECOVERY
+          yyerrcnt = -1;
+#endif
+          yymajor = YYNOCODE;
+        }else if( yymx!=YYERRORSYMBOL ){
+          yy_shift(yyact,YYERRORSYMBOL,std::move(yyminor));
+        }
+      }
+      yyerrcnt = 3;
+      yyerrorhit = 1;
+#elif defined(YYNOERRORRECOVERY)
+      /* If the YYNOERRORRECOVERY macro is defined, then do not attempt to
+      ** do any kind of error recovery.  Instead, simply invoke the syntax
+      ** error routine and continue going as if nothing had happened.
+      **
+      ** Applications can set this macro (for example inside %include) if
+      ** they intend to abandon the parse upon the first syntax error seen.
+      */
+      yy_syntax_error(yymajor,yyminor);
+      //yy_destructor(yyminor);
+      yymajor = YYNOCODE;
+      
+#else  /* YYERRORSYMBOL is not defined */
+      /* This is what we do if the grammar does not define ERROR:
+      **
+      **  * Report an error message, and throw away the input token.
+      **
+      **  * If the input token is $, then fail the parse.
+      **
+      ** As before, subsequent error messages are suppressed until
+      ** three input tokens have been successfully shifted.
+      */
+      if( yyerrcnt<=0 ){
+        yy_syntax_error(yymajor,yyminor);
+      }
+      yyerrcnt = 3;
+      //yy_destructor(yyminor);
+      if( yyendofinput ){
+        yy_parse_failed();
+#ifndef YYNOERRORRECOVERY
+        yyerrcnt = -1;
+#endif
+      }
+      yymajor = YYNOCODE;
+#endif
+    }
+  }while( yymajor!=YYNOCODE && yytos>yystack );
+#ifndef NDEBUG
+  if( yyTraceFILE ){
+    yyStackEntry *i;
+    char cDiv = '[';
+    fprintf(yyTraceFILE,"%sReturn. Stack=",yyTracePrompt);
+    for(i=&yystack[1]; i<=yytos; i++){
+      fprintf(yyTraceFILE,"%c%s", cDiv, yyTokenName[i->major]);
+      cDiv = ' ';
+    }
+    if (cDiv == '[') fprintf(yyTraceFILE,"[");
+    fprintf(yyTraceFILE,"]\n");
+  }
+#endif
+  return;
+}
+
+
+bool yypParser::will_accept() const {
+
+
+  struct stack_entry {
+    int stateno;
+    int major;
+  };
+
+  int yyact;
+  const int yymajor = 0;
+  std::vector<stack_entry> stack;
+
+
+  // copy stack to stack.
+  stack.reserve(yyidx()+1);
+  std::transform(begin(), end(), std::back_inserter(stack), [](const yyStackEntry &e){
+    return stack_entry({e.stateno, e.major});
+  });
+
+  do {
+    yyact = yy_find_shift_action(stack.back().stateno, yymajor);
+    if (yyact <= YY_MAX_SHIFTREDUCE) {
+      // shift
+      return false;
+      //stack.push_back({yyact, yymajor});
+      //yymajor = YYNOCODE;
+    }
+    else if (yyact <= YY_MAX_REDUCE) {
+      // reduce...
+      unsigned yyruleno = yyact - YY_MIN_REDUCE;
+
+      int yygoto = yyRuleInfo[yyruleno].lhs;
+      int yysize = -yyRuleInfo[yyruleno].nrhs; /* stored as negative value */
+
+      while (yysize--) stack.pop_back();
+
+      yyact = yy_find_reduce_action(stack.back().stateno,(YYCODETYPE)yygoto);
+
+
+      if (yyact == YY_ACCEPT_ACTION) return true;
+
+      if( yyact>YY_MAX_SHIFT ){
+        yyact += YY_MIN_REDUCE - YY_MIN_SHIFTREDUCE;
+      }
+
+      stack.push_back({yyact, yygoto});
+    }
+    else {
+      return false;
+    }
+
+  } while (!stack.empty());
+
+  return false;
+
+
+}
+
+
+
+
+} // namespace
+#line 56 "/root/repo/src/sql_parser.y"
+
+unique_ptr<Context> Context::create(Transaction &txn) {
+    return unique_ptr<yypParser>(new yypParser(txn));
+}
+
+#line 3788 "/root/repo/src/sql_parser.cpp"
@@ -0,0 +1,71 @@
+#define TK_ANY                              1
+#define TK_IDENTITY                         2
+#define TK_STRING                           3
+#define TK_SIGNED                           4
+#define TK_UNSIGNED                         5
+#define TK_CREATE                           6
+#define TK_CLASS                            7
+#define TK_EXTENDS                          8
+#define TK_VERTEX                           9
+#define TK_EDGE                            10
+#define TK_SEMI                            11
+#define TK_ALTER                           12
+#define TK_DROP                            13
+#define TK_PROPERTY                        14
+#define TK_DOT                             15
+#define TK_VALUES                          16
+#define TK_LP                              17
+#define TK_RP                              18
+#define TK_COMMA                           19
+#define TK_FROM                            20
+#define TK_TO                              21
+#define TK_SELECT                          22
+#define TK_STAR                            23
+#define TK_AS                              24
+#define TK_AT                              25
+#define TK_LB                              26
+#define TK_RB                              27
+#define TK_WHERE                           28
+#define TK_GROUP                           29
+#define TK_BY                              30
+#define TK_ORDER                           31
+#define TK_ASC                             32
+#define TK_DESC                            33
+#define TK_SKIP                            34
+#define TK_LIMIT                           35
+#define TK_UPDATE                          36
+#define TK_DELETE                          37
+#define TK_TRAVERSE                        38
+#define TK_MINDEPTH                        39
+#define TK_MAXDEPTH                        40
+#define TK_STRATEGY                        41
+#define TK_INDEX                           42
+#define TK_ANALYZE                         43
+#define TK_EXPLAIN                         44
+#define TK_PROFILE                         45
+#define TK_IF                              46
+#define TK_NOT                             47
+#define TK_EXISTS                          48
+#define TK_SET                             49
+#define TK_EQ                              50
+#define TK_SHARP                           51
+#define TK_COLON                           52
+#define TK_OR                              53
+#define TK_AND                             54
+#define TK_LT                              55
+#define TK_GT                              56
+#define TK_GE                              57
+#define TK_LE                              58
+#define TK_NE                              59
+#define TK_IS                              60
+#define TK_CONTAIN                         61
+#define TK_CASE                            62
+#define TK_BEGIN                           63
+#define TK_WITH                            64
+#define TK_END                             65
+#define TK_LIKE                            66
+#define TK_REGEX                           67
+#define TK_BETWEEN                         68
+#define TK_NULL                            69
+#define TK_FLOAT                           70
+#define TK_BLOB                            71
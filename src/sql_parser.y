@@ -39,6 +39,7 @@
 #include <stdio.h>
 #include <assert.h>
 #include <set>
+#include "constant.hpp"
 #include "sql.hpp"
 #include "sql_context.hpp"
 
@@ -113,6 +114,21 @@ cmd ::= CREATE VERTEX name(name) props_opt(prop) SEMI. {
     this->createVertex(name, prop);
 }
 
+// a class may still have a property named values
+%fallback IDENTITY VALUES.
+
+cmd ::= CREATE VERTEX name(name) LP prop_names(props) RP VALUES value_rows(rows) SEMI. {
+    this->createVertices(name, props, rows);
+}
+
+%type prop_names { vector<string> }
+prop_names(A) ::= prop_names(A) COMMA prop_name(X). { A.push_back(move(X)); }
+prop_names(A) ::= prop_name(X). { A = vector<string>{X}; }
+
+%type value_rows { vector<vector<Bytes>> }
+value_rows(A) ::= value_rows(A) COMMA LP term_list(X) RP. { A.push_back(move(X)); }
+value_rows(A) ::= LP term_list(X) RP. { A = vector<vector<Bytes>>{move(X)}; }
+
 
 //////////////////// The CREATE EDGE command ////////////////////
 cmd ::= create_edge_stmt(s) SEMI. {
@@ -233,9 +249,13 @@ where_opt(A) ::= WHERE cond(X). {
 }
 
 // gropu_by
-%type group_by { string }
-group_by(A) ::= . { A = string(); }
-group_by(A) ::= GROUP BY prop_name(X). { A = X; }
+%type group_by { vector<string> }
+group_by(A) ::= . { A = vector<string>(); }
+group_by(A) ::= GROUP BY group_keys(X). { A = move(X); }
+
+%type group_keys { vector<string> }
+group_keys(A) ::= group_keys(A) COMMA prop_name(X). { A.push_back(move(X)); }
+group_keys(A) ::= prop_name(X). { A = vector<string>{X}; }
 
 // order_by
 %type order_by { void * }
@@ -330,7 +350,8 @@ max_depth_opt(A) ::= . { A = UINT_MAX; }
 max_depth_opt(A) ::= MAXDEPTH integer(X). { A = stoll(string(X.z, X.n)); }
 
 %type strategy_opt { string }
-strategy_opt(A) ::= . { A = "DEPTH_FIRST"; }
+// traversals have always been breadth-first unless a strategy is given
+strategy_opt(A) ::= . { A = "BREADTH_FIRST"; }
 strategy_opt(A) ::= STRATEGY IDENTITY(X). { A = X.toString(); }
 
 //////////////////// The INDEX command ////////////////////
@@ -348,6 +369,29 @@ cmd ::= DROP INDEX name(className) DOT name(propName) SEMI. {
 index_type ::= .
 index_type(A) ::= IDENTITY(X). { A = X; }
 
+//////////////////// The ANALYZE command ////////////////////
+cmd ::= ANALYZE name(className) SEMI. {
+    this->analyze(className);
+}
+
+
+//////////////////// The EXPLAIN and PROFILE commands ////////////////////
+// both words are names anywhere else
+%fallback IDENTITY EXPLAIN PROFILE.
+
+cmd ::= EXPLAIN select_stmt(stmt) SEMI. {
+    this->explain(stmt);
+}
+cmd ::= EXPLAIN traverse_stmt(stmt) SEMI. {
+    this->explain(stmt);
+}
+cmd ::= PROFILE select_stmt(stmt) SEMI. {
+    this->profile(stmt);
+}
+cmd ::= PROFILE traverse_stmt(stmt) SEMI. {
+    this->profile(stmt);
+}
+
 
 //////////////////// Other options ////////////////////
 // if (not) exists
@@ -372,7 +416,10 @@ props_list(A) ::= prop_name(prop) EQ term(value). {
 
 %type prop_name { string }
 prop_name(A) ::= name(X). { A = X.toString(); }
-prop_name(A) ::= AT(X) IDENTITY(Y). { A = string(X.z, (Y.z + Y.n) - X.z); }
+prop_name(A) ::= AT(X) IDENTITY(Y). {
+    A = string(X.z, (Y.z + Y.n) - X.z);
+    this->hasDepthProperty |= (A == nogdb::DEPTH_PROPERTY);
+}
 
 // RID
 %type rid { RecordDescriptor }
@@ -38,12 +38,22 @@ namespace adapter {
             bool numericKey = false,
             bool unique = true,
             bool append = false,
-            bool overwrite = true)
+            bool overwrite = true,
+            bool numericDup = false)
             : _txn { txn }
             , _append { append }
             , _overwrite { overwrite }
         {
-            _dbi = txn->openDBi(dbName, numericKey, unique);
+            _dbi = txn->openDBi(dbName, numericKey, unique, numericDup);
+        }
+
+        // the table already opened by another access, read through another transaction without opening it again
+        LMDBKeyValAccess(const LMDBTxn* txn, const LMDBKeyValAccess& other)
+            : _txn { txn }
+            , _dbi { txn->handle(), other._dbi.handle() }
+            , _append { other._append }
+            , _overwrite { other._overwrite }
+        {
         }
 
         virtual ~LMDBKeyValAccess() noexcept = default;
@@ -75,6 +85,15 @@ namespace adapter {
             _dbi.put(key, val, _append, _overwrite);
         }
 
+        template <typename K, typename V>
+        void append(const K& key, const V& val, bool duplicate = false)
+        {
+            if (_dbi == 0) {
+                throw NOGDB_INTERNAL_ERROR(NOGDB_INTERNAL_EMPTY_DBI);
+            }
+            _dbi.append(key, val, duplicate);
+        }
+
         template <typename K>
         lmdb::Result get(const K& key) const
         {
@@ -110,6 +129,14 @@ namespace adapter {
             _dbi.drop(del);
         }
 
+        size_t size() const
+        {
+            if (_dbi == 0) {
+                throw NOGDB_INTERNAL_ERROR(NOGDB_INTERNAL_EMPTY_DBI);
+            }
+            return _dbi.size();
+        }
+
         lmdb::Cursor cursor() const
         {
             if (_txn == nullptr) {
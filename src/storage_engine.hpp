@@ -96,6 +96,12 @@ namespace storage_engine {
             _txn = lmdb::Transaction::begin(env->handle(), txnMode);
         }
 
+        // a transaction on the environment of another one, so that another thread has a transaction of its own
+        LMDBTxn(const LMDBTxn& txn, const unsigned int txnMode)
+        {
+            _txn = lmdb::Transaction::begin(txn._txn.env(), txnMode);
+        }
+
         ~LMDBTxn() noexcept
         {
             if (_txn.handle()) {
@@ -122,10 +128,13 @@ namespace storage_engine {
             return *this;
         }
 
-        lmdb::DBi openDBi(const std::string& dbName, bool numericKey = false, bool unique = true) const
+        lmdb::DBi openDBi(const std::string& dbName,
+            bool numericKey = false,
+            bool unique = true,
+            bool numericDup = false) const
         {
             if (_txn.handle()) {
-                return lmdb::DBi::open(_txn.handle(), dbName, numericKey, unique);
+                return lmdb::DBi::open(_txn.handle(), dbName, numericKey, unique, numericDup);
             } else {
                 throw NOGDB_STORAGE_ERROR(MDB_BAD_TXN);
             }
@@ -159,6 +168,12 @@ namespace storage_engine {
             return _txn.handle();
         }
 
+        // the snapshot of a read-only transaction, which is shared by all readers that begin before the next commit
+        size_t id() const noexcept
+        {
+            return _txn.id();
+        }
+
     private:
         lmdb::Transaction _txn { nullptr };
     };
@@ -21,6 +21,7 @@
 
 #include <memory>
 
+#include "algorithm.hpp"
 #include "datarecord.hpp"
 #include "dbinfo_adapter.hpp"
 #include "index.hpp"
@@ -107,6 +108,8 @@ Transaction::Transaction(Transaction&& txn) noexcept
     , _txnBase { txn._txnBase }
     , _adapter { txn._adapter }
     , _graph { txn._graph }
+    , _adjacencySnapshot { std::move(txn._adjacencySnapshot) }
+    , _isAdjacencySnapshotResolved { txn._isAdjacencySnapshotResolved }
 {
     txn._txnCtx = nullptr;
     txn._txnBase = nullptr;
@@ -126,6 +129,8 @@ Transaction& Transaction::operator=(Transaction&& txn) noexcept
         _txnBase = txn._txnBase;
         _adapter = txn._adapter;
         _graph = txn._graph;
+        _adjacencySnapshot = std::move(txn._adjacencySnapshot);
+        _isAdjacencySnapshotResolved = txn._isAdjacencySnapshotResolved;
 
         txn._txnCtx = nullptr;
         txn._txnBase = nullptr;
@@ -142,6 +147,10 @@ void Transaction::commit()
             _txnBase->commit();
             delete _txnBase;
             _txnBase = nullptr;
+            // the cached adjacency can no longer serve any new transaction, so its memory is released early
+            if (_txnMode == TxnMode::READ_WRITE && _txnCtx->_adjacencyCache != nullptr) {
+                _txnCtx->_adjacencyCache->invalidate();
+            }
         } catch (const Error& err) {
             try {
                 rollback();
@@ -168,6 +177,26 @@ void Transaction::commit()
     }
 }
 
+const algorithm::AdjacencySnapshot* Transaction::getAdjacencySnapshot() const
+{
+    if (!_isAdjacencySnapshotResolved) {
+        if (_txnCtx->_adjacencyCache != nullptr) {
+            _adjacencySnapshot = _txnCtx->_adjacencyCache->get(*this);
+        }
+        _isAdjacencySnapshotResolved = true;
+    }
+    return _adjacencySnapshot.get();
+}
+
+const algorithm::AdjacencySnapshot* Transaction::findAdjacencySnapshot() const
+{
+    if (!_isAdjacencySnapshotResolved && _txnCtx->_adjacencyCache != nullptr) {
+        _adjacencySnapshot = _txnCtx->_adjacencyCache->find(*this);
+        _isAdjacencySnapshotResolved = _adjacencySnapshot != nullptr;
+    }
+    return _adjacencySnapshot.get();
+}
+
 void Transaction::rollback() noexcept
 {
     if (_txnBase) {
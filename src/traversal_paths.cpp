@@ -0,0 +1,74 @@
+/*
+ *  Copyright (C) 2019, NogDB <https://nogdb.org>
+ *  <nogdb at throughwave dot co dot th>
+ *
+ *  This file is part of libnogdb, the NogDB core library in C++.
+ *
+ *  libnogdb is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <algorithm>
+
+#include "nogdb/nogdb_types.h"
+
+namespace nogdb {
+
+constexpr size_t TraversalPaths::NO_PARENT;
+
+size_t TraversalPaths::size() const
+{
+    return nodes.size();
+}
+
+bool TraversalPaths::empty() const
+{
+    return nodes.empty();
+}
+
+RecordDescriptor TraversalPaths::getVertex(size_t index) const
+{
+    return RecordDescriptor { nodes.at(index).vertex };
+}
+
+RecordDescriptor TraversalPaths::getEdge(size_t index) const
+{
+    return RecordDescriptor { nodes.at(index).edge };
+}
+
+size_t TraversalPaths::getParent(size_t index) const
+{
+    return nodes.at(index).parent;
+}
+
+unsigned int TraversalPaths::getDepth(size_t index) const
+{
+    return nodes.at(index).depth;
+}
+
+std::vector<RecordDescriptor> TraversalPaths::getPath(size_t index) const
+{
+    auto path = std::vector<RecordDescriptor> {};
+    for (auto current = index; current != NO_PARENT; current = nodes.at(current).parent) {
+        path.emplace_back(RecordDescriptor { nodes.at(current).vertex });
+        if (nodes.at(current).parent != NO_PARENT) {
+            path.emplace_back(RecordDescriptor { nodes.at(current).edge });
+        }
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+}
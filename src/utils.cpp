@@ -64,6 +64,11 @@ namespace string {
         std::transform(str.begin(), str.end(), str.begin(), ::toupper);
     }
 
+    void toLowerCase(std::string& str)
+    {
+        std::transform(str.begin(), str.end(), str.begin(), ::tolower);
+    }
+
     std::string frontPadding(const std::string& str, const size_t length, const char paddingChar)
     {
         auto tmp(str);
@@ -106,6 +106,75 @@ namespace profiler {
         std::string name;
         std::chrono::high_resolution_clock::time_point start;
     };
+
+    // the number of reads from LMDB done by the current thread while a stopwatch of it is running
+    inline unsigned long long& readCount() noexcept
+    {
+        static thread_local unsigned long long count { 0 };
+        return count;
+    }
+
+    // the number of stopwatches of the current thread that are running, so reads are only counted inside a profile
+    inline unsigned int& runningStopwatches() noexcept
+    {
+        static thread_local unsigned int count { 0 };
+        return count;
+    }
+
+    inline void countRead() noexcept
+    {
+        if (runningStopwatches() != 0) {
+            ++readCount();
+        }
+    }
+
+    // the time and the LMDB reads spent while it runs, added up over each time it is started and stopped
+    struct Stopwatch {
+
+        using Duration = std::chrono::duration<double, std::milli>;
+
+        void start()
+        {
+            ++runningStopwatches();
+            startTime = std::chrono::high_resolution_clock::now();
+            startReads = readCount();
+        }
+
+        void stop() noexcept
+        {
+            elapsed += std::chrono::duration_cast<Duration>(std::chrono::high_resolution_clock::now() - startTime).count();
+            reads += readCount() - startReads;
+            --runningStopwatches();
+        }
+
+        double elapsed { 0.0 };
+        unsigned long long reads { 0 };
+
+    private:
+        std::chrono::high_resolution_clock::time_point startTime {};
+        unsigned long long startReads { 0 };
+    };
+
+    // runs a stopwatch until the end of the scope, even when the scope is left by an exception
+    struct StopwatchScope {
+
+        explicit StopwatchScope(Stopwatch& stopwatch_)
+            : stopwatch(stopwatch_)
+        {
+            stopwatch.start();
+        }
+
+        ~StopwatchScope() noexcept
+        {
+            stopwatch.stop();
+        }
+
+        StopwatchScope(const StopwatchScope&) = delete;
+
+        StopwatchScope& operator=(const StopwatchScope&) = delete;
+
+        Stopwatch& stopwatch;
+    };
 }
 
 // date & time
@@ -118,6 +187,7 @@ namespace string {
     std::vector<std::string> split(const std::string& str, char delimeter);
     void replaceAll(std::string& string, const std::string& from, const std::string& to);
     void toUpperCase(std::string& str);
+    void toLowerCase(std::string& str);
     std::string frontPadding(const std::string& str, const size_t length, const char paddingChar);
 }
 
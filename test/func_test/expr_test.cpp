@@ -22,6 +22,7 @@
 #include "func_test.h"
 #include <map>
 #include <string>
+#include <vector>
 
 void test_expression()
 {
@@ -425,3 +426,120 @@ void test_cmp_function_expression()
     }
 
 }
+
+void test_compiled_expression()
+{
+    nogdb::PropertyMapType propTypes;
+    propTypes.emplace("firstname", nogdb::PropertyType::TEXT);
+    propTypes.emplace("lastname", nogdb::PropertyType::TEXT);
+    propTypes.emplace("age", nogdb::PropertyType::UNSIGNED_INTEGER);
+    propTypes.emplace("gpa", nogdb::PropertyType::REAL);
+    propTypes.emplace("status", nogdb::PropertyType::TEXT);
+
+    nogdb::Record r1 {}, r2 {}, r3 {};
+    r1.set("firstname", "Jonathan").set("lastname", "Potter").set("age", 26U).set("gpa", 3.67);
+    r2.set("firstname", "Hermione").set("lastname", "PoLYsister").set("age", 56U).set("gpa", 2.89);
+    r3.set("firstname", "Hermes").set("lastname", "Apolly").set("age", 18U).set("status", "active");
+
+    auto conditions = std::vector<std::pair<std::string, nogdb::Condition>> {
+        { "firstname", nogdb::Condition("firstname").like("Herm%e%") },
+        { "lastname", nogdb::Condition("lastname").like("pO%ter").ignoreCase() },
+        { "firstname", nogdb::Condition("firstname").like("herm__").ignoreCase() },
+        { "firstname", nogdb::Condition("firstname").regex("Herm(.*)e(.*)") },
+        { "lastname", nogdb::Condition("lastname").regex("pO(.*)ter").ignoreCase() },
+        { "lastname", nogdb::Condition("lastname").endWith("ly") },
+        { "lastname", nogdb::Condition("lastname").endWith("TER").ignoreCase() },
+        { "lastname", nogdb::Condition("lastname").beginWith("po").ignoreCase() },
+        { "lastname", nogdb::Condition("lastname").contain("oll") },
+        { "firstname", !nogdb::Condition("firstname").contain("her").ignoreCase() },
+        { "firstname", nogdb::Condition("firstname").in("Hermes", "Jonathan") },
+        { "firstname", !nogdb::Condition("firstname").in("Hermes", "Jonathan") },
+        { "firstname", nogdb::Condition("firstname").between("Hermes", "Hermione", { false, true }) },
+        { "age", nogdb::Condition("age").in(18U, 56U) },
+        { "age", nogdb::Condition("age").between(20U, 56U, { true, false }) },
+        { "age", nogdb::Condition("age").ge(26U) },
+        { "gpa", !nogdb::Condition("gpa").lt(3.0) },
+        { "gpa", nogdb::Condition("gpa").null() },
+        { "status", nogdb::Condition("status").null() },
+        { "status", !nogdb::Condition("status").null() }
+    };
+
+    try {
+        for (const auto& propertyCondition : conditions) {
+            const auto& propName = propertyCondition.first;
+            const auto& condition = propertyCondition.second;
+            auto compiledCondition = condition.compile(propTypes.at(propName));
+            for (const auto& record : { r1, r2, r3 }) {
+                auto expected = (!nogdb::Condition("age").null() && condition).execute(record, propTypes);
+                assert(compiledCondition(record) == expected);
+                assert(compiledCondition(record.get(propName)) == expected);
+            }
+        }
+
+        auto like = nogdb::Condition("lastname").like("%ly%").compile(nogdb::PropertyType::TEXT);
+        assert(like(r1) == false);
+        assert(like(r2) == false);
+        assert(like(r3) == true);
+        auto regex = nogdb::Condition("firstname").regex("herm(.)(.)").ignoreCase().compile(nogdb::PropertyType::TEXT);
+        assert(regex(r1) == false);
+        assert(regex(r2) == false);
+        assert(regex(r3) == true);
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+}
+
+void test_compiled_numeric_expression()
+{
+    nogdb::PropertyMapType propTypes;
+    propTypes.emplace("level", nogdb::PropertyType::TINYINT);
+    propTypes.emplace("rank", nogdb::PropertyType::UNSIGNED_SMALLINT);
+    propTypes.emplace("score", nogdb::PropertyType::BIGINT);
+    propTypes.emplace("id", nogdb::PropertyType::UNSIGNED_BIGINT);
+    propTypes.emplace("ratio", nogdb::PropertyType::REAL);
+
+    nogdb::Record r1 {}, r2 {}, r3 {};
+    r1.set("level", int8_t { -5 }).set("rank", uint16_t { 300 }).set("score", int64_t { -10000000000 });
+    r1.set("id", uint64_t { 18000000000000000000ULL }).set("ratio", -0.5);
+    r2.set("level", int8_t { 0 }).set("rank", uint16_t { 7 }).set("score", int64_t { 42 }).set("ratio", 0.0);
+    r3.set("level", int8_t { 100 }).set("score", int64_t { 10000000000 }).set("id", uint64_t { 1 });
+
+    auto conditions = std::vector<std::pair<std::string, nogdb::Condition>> {
+        { "level", nogdb::Condition("level").lt(int8_t { 0 }) },
+        { "level", nogdb::Condition("level").between(int8_t { -5 }, int8_t { 0 }, { false, true }) },
+        { "level", !nogdb::Condition("level").eq(int8_t { 0 }) },
+        { "rank", nogdb::Condition("rank").ge(uint16_t { 7 }) },
+        { "rank", nogdb::Condition("rank").in(uint16_t { 1 }, uint16_t { 300 }) },
+        { "score", nogdb::Condition("score").gt(int64_t { 0 }) },
+        { "score", nogdb::Condition("score").between(int64_t { -10000000000 }, int64_t { 42 }, { true, false }) },
+        { "id", nogdb::Condition("id").gt(uint64_t { 9000000000000000000ULL }) },
+        { "id", !nogdb::Condition("id").le(uint64_t { 1 }) },
+        { "ratio", nogdb::Condition("ratio").le(0.0) },
+        { "ratio", nogdb::Condition("ratio").between(-1.0, 0.0, { true, false }) }
+    };
+
+    try {
+        for (const auto& propertyCondition : conditions) {
+            const auto& propName = propertyCondition.first;
+            const auto& condition = propertyCondition.second;
+            auto compiledCondition = condition.compile(propTypes.at(propName));
+            for (const auto& record : { r1, r2, r3 }) {
+                auto expected = (!nogdb::Condition("level").null() && condition).execute(record, propTypes);
+                assert(compiledCondition(record) == expected);
+            }
+        }
+
+        auto range = nogdb::Condition("score").between(int64_t { -10000000000 }, int64_t { 42 }).compile(nogdb::PropertyType::BIGINT);
+        assert(range(r1) == true);
+        assert(range(r2) == true);
+        assert(range(r3) == false);
+        auto negative = nogdb::Condition("level").lt(int8_t { 0 }).compile(nogdb::PropertyType::TINYINT);
+        assert(negative(r1) == true);
+        assert(negative(r2) == false);
+        assert(negative(r3) == false);
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+}
@@ -218,14 +218,24 @@ int main()
     exec(test_invalid_shortest_path, "finding the shortest path with invalid parameters");
     exec(test_shortest_path_cursor, "finding a cursor of the shortest path in a graph");
     exec(test_invalid_shortest_path_cursor, "finding a cursor of the shortest path with invalid parameters");
-    // exec(test_shortest_path_dijkstra, "finding the shortest path with dijkstra's algorithm");
+    exec(test_shortest_path_dijkstra, "finding the shortest path with dijkstra's algorithm");
     exec(test_bfs_traverse_with_condition, "traversing a graph using bfs algorithm with conditional functions");
     exec(test_shortest_path_with_condition, "finding the shortest path in a graph with conditional functions");
+    exec(test_shortest_path_with_depth, "finding the shortest path in a graph within a range of depths");
     exec(test_bfs_traverse_cursor_with_condition, "traversing a graph and returning a cursor using bfs algorithm with conditional functions");
+    exec(test_bfs_traverse_cursor_with_class_filter, "traversing a graph and returning a cursor using bfs algorithm with class filters only");
     exec(test_shortest_path_cursor_with_condition, "finding a cursor of the shortest path in a graph with conditional functions");
     exec(test_bfs_traverse_multi_edges_with_condition, "traversing a graph using bfs algorithm with conditional functions for multi-edge vertices");
     exec(test_bfs_traverse_multi_vertices, "traversing a graph using bfs algorithm with multi-vertex sources");
     exec(test_bfs_traverse_multi_vertices_with_condition, "traversing a graph using bfs algorithm with multi-vertex sources and conditions");
+    exec(test_bfs_traverse_wide_frontier, "traversing a graph using bfs algorithm with a wide frontier");
+    exec(test_dfs_traverse, "traversing a graph using dfs algorithm");
+    exec(test_dfs_traverse_shallower_path, "traversing a graph using dfs algorithm with a shorter path found later");
+    exec(test_traverse_stream, "traversing a graph and returning a stream of vertices");
+    exec(test_traverse_paths, "traversing a graph and returning a tree of paths");
+    exec(test_traverse_and_edge_count, "counting traversed vertices and incident edges");
+    exec(test_graph_analytics, "running graph analytics over all vertices and edges");
+    exec(test_traverse_with_adjacency_cache, "traversing a graph with a cached adjacency");
     exec(destroy_test_graph, "destroying the graph for testing graph operations");
 #endif
     // find
@@ -236,6 +246,8 @@ int main()
     exec(test_extra_string_expression, "constructing condition with additional comparators for string type correctly");
     exec(test_negative_expression, "constructing negative condition/expression and filtering a record correctly");
     exec(test_cmp_function_expression, "constructing expression with conditional comparing functions correctly");
+    exec(test_compiled_expression, "compiling a condition once and filtering records with it correctly");
+    exec(test_compiled_numeric_expression, "comparing numeric values with conditions compiled for their types correctly");
     exec(init_test_find, "initiating a graph for testing find operations");
     exec(test_create_informative_graph, "creating an informative graph");
     exec(test_find_vertex, "finding records from a vertex class with a given condition");
@@ -331,6 +343,8 @@ int main()
         "finding a cursor of incoming and outgoing edges from a vertex with a given expression");
     exec(test_find_invalid_edge_all_cursor_with_expression,
         "finding a cursor of incoming and outgoing edges from an invalid vertex or with an invalid expression");
+    exec(test_find_vertex_batch_scan, "finding records with numeric conditions over several batches of a class scan");
+    exec(test_find_vertex_with_flattened_expression, "finding records with nested expressions evaluated cheapest first");
     exec(destroy_test_find, "destroying a graph for testing find operations");
 #endif
     // inheritance
@@ -384,6 +398,11 @@ int main()
     exec(test_drop_invalid_index_with_records, "dropping invalid indexes with existing records");
     exec(test_search_by_index_unique_condition, "getting records from unique indexing with condition");
     exec(test_search_by_index_non_unique_condition, "getting records from non-unique indexing with condition");
+    exec(test_search_by_index_non_unique_condition_with_records, "getting records from non-unique indexing built over existing records");
+    exec(test_search_by_fulltext_index_condition, "getting records from full-text indexing");
+    exec(test_search_by_hash_index_condition, "getting records from hash indexing");
+    exec(test_search_by_index_query_plan, "choosing query plans from index statistics");
+    exec(test_search_by_index_in_condition, "getting records from indexing with a list of values");
 //    exec(test_search_by_index_unique_multicondition, "getting records from unique indexing with multi-condition");
 //    exec(test_search_by_index_non_unique_multicondition, "getting records from non-unique indexing with multi-condition");
     exec(test_search_by_index_unique_cursor_condition, "getting cursor from unique indexing with condition");
@@ -508,6 +527,7 @@ int main()
     exec(test_sql_select_nested_condition, "finding records from vertex class by nested condition with sql command");
     exec(test_sql_select_skip_limit, "retrieving data with specific length with sql command");
     exec(test_sql_select_group_by, "retrieving data with 'group by' sql command");
+    exec(test_sql_select_group_by_aggregate, "aggregating groups of several keys with sql command");
     exec(test_sql_update_vertex_with_rid, "updating a vertex by rid with sql command");
     exec(test_sql_update_vertex_with_condition, "updating a vertex by condition with sql command");
     exec(test_sql_delete_vertex_with_rid, "deleting a vertex and edge around vertex by rid with sql command");
@@ -519,6 +539,13 @@ int main()
     exec(test_sql_create_index, "creating index with sql command");
     exec(test_sql_create_index_unique, "creating unique index with sql command");
     exec(test_sql_drop_index, "droping index with sql command");
+    exec(test_sql_prepared_statement, "executing prepared sql statements with bound parameters");
+    exec(test_sql_stream, "streaming rows of select and traverse sql commands");
+    exec(test_sql_select_nested_pushdown, "pushing conditions and limits into nested sql commands");
+    exec(test_sql_explain_profile, "explaining and profiling sql commands and operation builders");
+    exec(test_sql_stream_after_execute, "reading streamed sql results after the statement has returned");
+    exec(test_sql_batch_dml, "batching sql inserts, updates and deletes");
+    exec(test_sql_create_index_type, "creating an index of a given type with sql command");
 #endif
 
     destroy_context();
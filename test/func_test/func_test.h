@@ -181,12 +181,22 @@ extern void test_shortest_path_cursor();
 extern void test_invalid_shortest_path_cursor();
 extern void test_bfs_traverse_with_condition();
 extern void test_shortest_path_with_condition();
+extern void test_shortest_path_with_depth();
 extern void test_bfs_traverse_cursor_with_condition();
+extern void test_bfs_traverse_cursor_with_class_filter();
 extern void test_shortest_path_cursor_with_condition();
 extern void test_bfs_traverse_multi_edges_with_condition();
 extern void test_bfs_traverse_multi_vertices();
 extern void test_bfs_traverse_multi_vertices_with_condition();
-// extern void test_shortest_path_dijkstra();
+extern void test_bfs_traverse_wide_frontier();
+extern void test_dfs_traverse();
+extern void test_dfs_traverse_shallower_path();
+extern void test_traverse_stream();
+extern void test_traverse_paths();
+extern void test_traverse_and_edge_count();
+extern void test_graph_analytics();
+extern void test_traverse_with_adjacency_cache();
+extern void test_shortest_path_dijkstra();
 #endif
 
 // find operations testing
@@ -196,6 +206,8 @@ extern void test_range_expression();
 extern void test_extra_string_expression();
 extern void test_negative_expression();
 extern void test_cmp_function_expression();
+extern void test_compiled_expression();
+extern void test_compiled_numeric_expression();
 extern void init_test_find();
 extern void test_create_informative_graph();
 extern void test_find_vertex();
@@ -258,6 +270,8 @@ extern void test_find_edge_all_cursor_with_expression();
 extern void test_find_invalid_edge_in_cursor_with_expression();
 extern void test_find_invalid_edge_out_cursor_with_expression();
 extern void test_find_invalid_edge_all_cursor_with_expression();
+extern void test_find_vertex_batch_scan();
+extern void test_find_vertex_with_flattened_expression();
 extern void destroy_test_find();
 #endif
 
@@ -300,6 +314,11 @@ extern void test_create_invalid_index_with_records();
 extern void test_drop_invalid_index_with_records();
 extern void test_search_by_index_unique_condition();
 extern void test_search_by_index_non_unique_condition();
+extern void test_search_by_index_non_unique_condition_with_records();
+extern void test_search_by_fulltext_index_condition();
+extern void test_search_by_hash_index_condition();
+extern void test_search_by_index_query_plan();
+extern void test_search_by_index_in_condition();
 extern void test_search_by_index_unique_multicondition();
 extern void test_search_by_index_non_unique_multicondition();
 extern void test_search_by_index_unique_cursor_condition();
@@ -415,6 +434,7 @@ extern void test_sql_select_vertex_with_multi_condition();
 extern void test_sql_select_nested_condition();
 extern void test_sql_select_skip_limit();
 extern void test_sql_select_group_by();
+extern void test_sql_select_group_by_aggregate();
 extern void test_sql_update_vertex_with_rid();
 extern void test_sql_update_vertex_with_condition();
 extern void test_sql_delete_vertex_with_rid();
@@ -426,4 +446,11 @@ extern void test_sql_traverse();
 extern void test_sql_create_index();
 extern void test_sql_create_index_unique();
 extern void test_sql_drop_index();
+extern void test_sql_prepared_statement();
+extern void test_sql_stream();
+extern void test_sql_select_nested_pushdown();
+extern void test_sql_explain_profile();
+extern void test_sql_stream_after_execute();
+extern void test_sql_batch_dml();
+extern void test_sql_create_index_type();
 #endif
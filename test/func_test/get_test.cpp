@@ -22,6 +22,7 @@
 #include "func_test.h"
 #include "setup_cleanup.h"
 #include <algorithm>
+#include <functional>
 #include <set>
 
 struct Coordinates {
@@ -3616,3 +3617,148 @@ void test_find_invalid_edge_all_cursor_with_expression()
         REQUIRE(ex, NOGDB_GRAPH_NOEXST_VERTEX, "NOGDB_GRAPH_NOEXST_VERTEX");
     }
 }
+
+void test_find_vertex_batch_scan()
+{
+    // enough records to fill several scan batches, with the last batch only partly filled
+    const auto numRecords = 1000;
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addClass("batch_scan", nogdb::ClassType::VERTEX);
+        txn.addProperty("batch_scan", "value", nogdb::PropertyType::INTEGER);
+        txn.addProperty("batch_scan", "ratio", nogdb::PropertyType::REAL);
+        txn.addProperty("batch_scan", "seq", nogdb::PropertyType::UNSIGNED_INTEGER);
+        for (auto i = 0; i < numRecords; ++i) {
+            auto record = nogdb::Record {}.set("seq", static_cast<unsigned int>(i)).set("ratio", i * 0.5);
+            if (i % 7 != 0) {
+                record.set("value", i - 500);
+            }
+            txn.addVertex("batch_scan", record);
+        }
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    auto countIf = [&](std::function<bool(int)> predicate) {
+        auto count = 0UL;
+        for (auto i = 0; i < numRecords; ++i) {
+            count += predicate(i) ? 1UL : 0UL;
+        }
+        return count;
+    };
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        auto res = txn.find("batch_scan").where(nogdb::Condition("value").ge(0)).get();
+        ASSERT_EQ(res.size(), countIf([](int i) { return i % 7 != 0 && i >= 500; }));
+        for (const auto& r : res) {
+            assert(r.record.getInt("value") >= 0);
+            assert(r.record.getInt("value") == static_cast<int>(r.record.getIntU("seq")) - 500);
+        }
+        // records without the property never satisfy a negative comparison either
+        ASSERT_EQ(txn.find("batch_scan").where(!nogdb::Condition("value").ge(0)).count(),
+            countIf([](int i) { return i % 7 != 0 && i < 500; }));
+        ASSERT_EQ(txn.find("batch_scan").where(nogdb::Condition("value").between(-10, 10, { false, true })).count(),
+            countIf([](int i) { return i % 7 != 0 && i > 490 && i <= 510; }));
+        ASSERT_EQ(txn.find("batch_scan").where(nogdb::Condition("value").in(-500, -499, 0, 499)).count(),
+            countIf([](int i) { return i % 7 != 0 && (i == 0 || i == 1 || i == 500 || i == 999); }));
+        ASSERT_EQ(txn.find("batch_scan").where(nogdb::Condition("value").null()).count(),
+            countIf([](int i) { return i % 7 == 0; }));
+        ASSERT_EQ(txn.find("batch_scan").where(nogdb::Condition("ratio").lt(100.0)).count(),
+            countIf([](int i) { return i * 0.5 < 100.0; }));
+
+        auto cursor = txn.find("batch_scan").where(nogdb::Condition("seq").gt(995U)).getCursor();
+        ASSERT_SIZE(cursor, 4);
+        while (cursor.next()) {
+            assert(cursor->record.getIntU("seq") > 995U);
+        }
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropClass("batch_scan");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+}
+
+static unsigned int flatExpressionCalls = 0;
+
+bool countFlatExpressionCall(const nogdb::Record& record)
+{
+    ++flatExpressionCalls;
+    return record.getInt("value") % 2 == 0;
+}
+
+void test_find_vertex_with_flattened_expression()
+{
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addClass("flat_expr", nogdb::ClassType::VERTEX);
+        txn.addProperty("flat_expr", "value", nogdb::PropertyType::INTEGER);
+        txn.addProperty("flat_expr", "name", nogdb::PropertyType::TEXT);
+        for (auto i = 0; i < 100; ++i) {
+            txn.addVertex("flat_expr", nogdb::Record {}.set("value", i).set("name", "n" + std::to_string(i)));
+        }
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        // the function is the most expensive check, so it only sees the records which pass the others
+        flatExpressionCalls = 0;
+        auto res = txn.find("flat_expr")
+                       .where(nogdb::Condition("name").like("n9%") && nogdb::Condition("value").ge(90)
+                           && countFlatExpressionCall)
+                       .get();
+        ASSERT_SIZE(res, 5);
+        ASSERT_EQ(flatExpressionCalls, 10U);
+
+        res = txn.find("flat_expr")
+                  .where((nogdb::Condition("value").eq(1) || nogdb::Condition("value").eq(2))
+                      || (nogdb::Condition("value").eq(3) || nogdb::Condition("name").eq("n4")))
+                  .get();
+        ASSERT_SIZE(res, 4);
+
+        res = txn.find("flat_expr")
+                  .where(!(nogdb::Condition("value").lt(50) || nogdb::Condition("name").endWith("9")))
+                  .get();
+        ASSERT_SIZE(res, 45);
+        for (const auto& r : res) {
+            assert(r.record.getInt("value") >= 50 && r.record.getInt("value") % 10 != 9);
+        }
+
+        ASSERT_EQ(txn.find("flat_expr")
+                      .where((nogdb::Condition("value").lt(10) || nogdb::Condition("value").ge(95))
+                          && !nogdb::Condition("name").eq("n0") && !nogdb::Condition("name").null())
+                      .count(),
+            14UL);
+        ASSERT_EQ(txn.find("flat_expr")
+                      .where(!((nogdb::Condition("value").ge(10) && nogdb::Condition("value").lt(20))
+                          && (nogdb::Condition("name").regex("n1[0-4]") && nogdb::Condition("value").ge(0))))
+                      .count(),
+            95UL);
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropClass("flat_expr");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+}
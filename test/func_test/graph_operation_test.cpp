@@ -19,7 +19,9 @@
  *
  */
 
+#include <cmath>
 #include <list>
+#include <map>
 #include <set>
 #include <vector>
 
@@ -1422,6 +1424,147 @@ void test_shortest_path_with_condition()
     txn.commit();
 }
 
+void test_shortest_path_with_depth()
+{
+    auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+    nogdb::RecordDescriptor a, f, z;
+    try {
+        for (const auto& res : txn.find("country").get()) {
+            switch (res.record.get("name").toText().c_str()[0]) {
+            case 'A':
+                a = res.descriptor;
+                break;
+            case 'F':
+                f = res.descriptor;
+                break;
+            case 'Z':
+                z = res.descriptor;
+                break;
+            }
+        }
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto res = txn.shortestPath(z, f).get();
+        ASSERT_SIZE(res, 4);
+        assert(res[0].record.get("name").toText() == "Z");
+        assert(res[1].record.get("name").toText() == "A");
+        assert(res[2].record.get("name").toText() == "C");
+        assert(res[3].record.get("name").toText() == "F");
+        assert(res[3].record.getDepth() == 3);
+
+        res = txn.shortestPath(z, f).depth(3, 3).get();
+        ASSERT_SIZE(res, 4);
+
+        res = txn.shortestPath(z, f).maxDepth(2).get();
+        assert(res.empty());
+
+        res = txn.shortestPath(z, f).minDepth(4).get();
+        assert(res.empty());
+
+        res = txn.shortestPath(a, a).minDepth(1).get();
+        assert(res.empty());
+
+        res = txn.shortestPath(f, z).get();
+        assert(res.empty());
+
+        auto vertexFilter = nogdb::GraphFilter(
+            [](const nogdb::Record& record) { return (record.get("population").toBigIntU() < 1500ULL); });
+        res = txn.shortestPath(z, f).whereV(vertexFilter).get();
+        assert(res.empty());
+
+        auto cursor = txn.shortestPath(z, f).maxDepth(3).getCursor();
+        ASSERT_SIZE(cursor, 4);
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    txn.commit();
+}
+
+void test_shortest_path_dijkstra()
+{
+    auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+    nogdb::RecordDescriptor a, d, f, z;
+    try {
+        for (const auto& res : txn.find("country").get()) {
+            switch (res.record.get("name").toText().c_str()[0]) {
+            case 'A':
+                a = res.descriptor;
+                break;
+            case 'D':
+                d = res.descriptor;
+                break;
+            case 'F':
+                f = res.descriptor;
+                break;
+            case 'Z':
+                z = res.descriptor;
+                break;
+            }
+        }
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto res = txn.shortestPath(z, f).weightedBy("distance").get();
+        ASSERT_SIZE(res, 5);
+        assert(res[0].record.get("name").toText() == "Z");
+        assert(res[1].record.get("name").toText() == "A");
+        assert(res[2].record.get("name").toText() == "B");
+        assert(res[3].record.get("name").toText() == "C");
+        assert(res[4].record.get("name").toText() == "F");
+        assert(res[4].record.getDepth() == 4);
+
+        res = txn.shortestPath(a, d).weightedBy("distance").get();
+        ASSERT_SIZE(res, 4);
+        assert(res[1].record.get("name").toText() == "B");
+        assert(res[2].record.get("name").toText() == "C");
+
+        res = txn.shortestPath(z, f)
+                  .weightedBy("distance")
+                  .whereE(nogdb::GraphFilter(
+                      [](const nogdb::Record& record) { return record.get("distance").toIntU() != 150U; }))
+                  .get();
+        ASSERT_SIZE(res, 6);
+        assert(res[4].record.get("name").toText() == "D");
+        assert(res[5].record.get("name").toText() == "F");
+
+        res = txn.shortestPath(z, f)
+                  .weightedBy("distance")
+                  .heuristic([](const nogdb::Record& vertex, const nogdb::Record& destination) { return 10.0; })
+                  .get();
+        ASSERT_SIZE(res, 5);
+        assert(res[2].record.get("name").toText() == "B");
+
+        auto cursor = txn.shortestPath(z, f).weightedBy("distance").getCursor();
+        ASSERT_SIZE(cursor, 5);
+
+        res = txn.shortestPath(z, f).weightedBy("distance").maxDepth(3).get();
+        assert(res.empty());
+
+        res = txn.shortestPath(z, f).weightedBy("distance").maxDepth(4).get();
+        ASSERT_SIZE(res, 5);
+
+        res = txn.shortestPath(z, f).weightedBy("distance").maxDepth(0).get();
+        assert(res.empty());
+
+        res = txn.shortestPath(z, f).weightedBy("population").get();
+        assert(res.empty());
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    txn.commit();
+}
+
 void test_bfs_traverse_in_cursor()
 {
     auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
@@ -2647,6 +2790,56 @@ void test_bfs_traverse_cursor_with_condition()
     txn.commit();
 }
 
+void test_bfs_traverse_cursor_with_class_filter()
+{
+    auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+    nogdb::RecordDescriptor a;
+    try {
+        auto res = txn.find("country").where(nogdb::Condition("name").eq("A")).get();
+        ASSERT_SIZE(res, 1);
+        a = res[0].descriptor;
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto res = txn.traverseOut(a).depth(0, 4).getCursor();
+        ASSERT_SIZE(res, 6);
+        cursorContains(res, std::set<std::string> { "A", "B", "C", "D", "E", "F" }, "name");
+
+        res = txn.traverseOut(a).depth(0, 4).whereE(nogdb::GraphFilter {}.only("path")).getCursor();
+        ASSERT_SIZE(res, 6);
+        cursorContains(res, std::set<std::string> { "A", "B", "C", "D", "E", "F" }, "name");
+
+        res = txn.traverseOut(a).depth(1, 4).whereV(nogdb::GraphFilter {}.only("country")).getCursor();
+        ASSERT_SIZE(res, 5);
+        cursorContains(res, std::set<std::string> { "B", "C", "D", "E", "F" }, "name");
+
+        res = txn.traverseOut(a).depth(0, 4).whereE(nogdb::GraphFilter {}.exclude("path")).getCursor();
+        ASSERT_SIZE(res, 1);
+        res.first();
+        assert(res->record.get("name").toText() == "A");
+
+        res = txn.traverseOut(a).depth(0, 4).whereE(nogdb::GraphFilter {}.only("no_such_edge")).getCursor();
+        ASSERT_SIZE(res, 1);
+        res.first();
+        assert(res->record.get("name").toText() == "A");
+
+        auto result = txn.traverseOut(a).depth(1, 1).whereV(nogdb::GraphFilter {}.only("no_such_vertex")).get();
+        ASSERT_SIZE(result, 0);
+
+        res = txn.traverseOut(a).depth(0, 4).whereE(nogdb::GraphFilter {}.onlySubClassOf("no_such_edge")).getCursor();
+        ASSERT_SIZE(res, 6);
+        cursorContains(res, std::set<std::string> { "A", "B", "C", "D", "E", "F" }, "name");
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    txn.commit();
+}
+
 void test_shortest_path_cursor_with_condition()
 {
     auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
@@ -3027,3 +3220,587 @@ void test_bfs_traverse_multi_vertices_with_condition() {
 
     txn.commit();
 }
+
+void test_bfs_traverse_wide_frontier()
+{
+    const auto numChildren = 3000U;
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addClass("wide_vertex", nogdb::ClassType::VERTEX);
+        txn.addProperty("wide_vertex", "value", nogdb::PropertyType::UNSIGNED_INTEGER);
+        txn.addClass("wide_edge", nogdb::ClassType::EDGE);
+        txn.addProperty("wide_edge", "level", nogdb::PropertyType::UNSIGNED_INTEGER);
+        auto root = txn.addVertex("wide_vertex", nogdb::Record {}.set("value", 0U));
+        for (auto i = 1U; i <= numChildren; ++i) {
+            auto child = txn.addVertex("wide_vertex", nogdb::Record {}.set("value", i));
+            auto grandChild = txn.addVertex("wide_vertex", nogdb::Record {}.set("value", numChildren + i));
+            txn.addEdge("wide_edge", root, child, nogdb::Record {}.set("level", 1U));
+            txn.addEdge("wide_edge", child, grandChild, nogdb::Record {}.set("level", 2U));
+            txn.addEdge("wide_edge", grandChild, root, nogdb::Record {}.set("level", 3U));
+        }
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        auto root = txn.find("wide_vertex").where(nogdb::Condition("value").eq(0U)).get()[0].descriptor;
+
+        auto res = txn.traverseOut(root).depth(1, 2).getCursor();
+        ASSERT_SIZE(res, 2 * numChildren);
+        auto values = std::set<unsigned int> {};
+        auto currentDepth = 1U;
+        while (res.next()) {
+            auto value = res->record.getIntU("value");
+            values.insert(value);
+            ASSERT_EQ(res->record.getDepth(), (value <= numChildren) ? 1U : 2U);
+            ASSERT_TRUE(res->record.getDepth() >= currentDepth);
+            currentDepth = res->record.getDepth();
+        }
+        ASSERT_EQ(values.size(), size_t { 2 * numChildren });
+        ASSERT_EQ(*values.cbegin(), 1U);
+        ASSERT_EQ(*values.crbegin(), 2 * numChildren);
+
+        auto vertexFilter = nogdb::GraphFilter { nogdb::Condition("value").le(numChildren / 2) };
+        res = txn.traverseOut(root).depth(0, 3).whereV(vertexFilter).getCursor();
+        ASSERT_SIZE(res, numChildren / 2 + 1);
+
+        res = txn.traverseIn(root).depth(2, 2).getCursor();
+        ASSERT_SIZE(res, numChildren);
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    // a frontier of 3000 vertices is split between two workers, however many cores the machine has, which read
+    // either their own read-only transactions or the cached adjacency, and gives the same vertices in the same
+    // order as a serial traversal; edges filtered by their records are only filtered on the calling thread
+    try {
+        auto toDescriptors = [](nogdb::ResultSetCursor& cursor) {
+            auto descriptors = std::vector<nogdb::RecordDescriptor> {};
+            while (cursor.next()) {
+                descriptors.emplace_back(cursor->descriptor);
+            }
+            return descriptors;
+        };
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        auto root = txn.find("wide_vertex").where(nogdb::Condition("value").eq(0U)).get()[0].descriptor;
+        auto edgeFilter = nogdb::GraphFilter {}.only("wide_edge");
+        auto levelFilter = nogdb::GraphFilter { nogdb::Condition("level").le(2U) };
+        auto vertexFilter = nogdb::GraphFilter { nogdb::Condition("value").le(numChildren / 2) };
+        auto cursor = txn.traverseOut(root).depth(0, 3).whereE(edgeFilter).getCursor();
+        auto expectedOut = toDescriptors(cursor);
+        cursor = txn.traverseIn(root).depth(1, 2).getCursor();
+        auto expectedIn = toDescriptors(cursor);
+        cursor = txn.traverse(root).depth(1, 3).whereE(levelFilter).getCursor();
+        auto expectedLevel = toDescriptors(cursor);
+        txn.commit();
+
+        ctx->setTraversalThreads(4);
+        for (auto isCached : { false, true }) {
+            if (isCached) {
+                ctx->enableAdjacencyCache();
+            }
+            txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+            auto res = txn.traverseOut(root).depth(0, 3).whereE(edgeFilter).getCursor();
+            ASSERT_SIZE(res, 2 * numChildren + 1);
+            assert(toDescriptors(res) == expectedOut);
+            res = txn.traverseIn(root).depth(1, 2).getCursor();
+            ASSERT_SIZE(res, 2 * numChildren);
+            assert(toDescriptors(res) == expectedIn);
+            res = txn.traverse(root).depth(1, 3).whereE(levelFilter).getCursor();
+            ASSERT_SIZE(res, 2 * numChildren);
+            assert(toDescriptors(res) == expectedLevel);
+            res = txn.traverseOut(root).depth(0, 3).whereV(vertexFilter).getCursor();
+            ASSERT_SIZE(res, numChildren / 2 + 1);
+            txn.commit();
+        }
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    ctx->setTraversalThreads(0).disableAdjacencyCache();
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropClass("wide_edge");
+        txn.dropClass("wide_vertex");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+}
+
+void test_dfs_traverse()
+{
+    auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+    nogdb::RecordDescriptor a, z;
+    try {
+        for (const auto& res : txn.find("country").get()) {
+            switch (res.record.get("name").toText().c_str()[0]) {
+            case 'A':
+                a = res.descriptor;
+                break;
+            case 'Z':
+                z = res.descriptor;
+                break;
+            }
+        }
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto res = txn.traverseOut(a).depthFirst().get();
+        ASSERT_SIZE(res, 6);
+        assert(res[0].descriptor == a);
+        assert(res[0].record.getDepth() == 0);
+        // the same vertices as a breadth-first search, each at its depth in the depth-first tree,
+        // which is never shallower than the shortest path
+        auto depths = std::map<nogdb::RecordId, unsigned int> {};
+        for (const auto& r : txn.traverseOut(a).get()) {
+            depths.emplace(r.descriptor.rid, r.record.getDepth());
+        }
+        ASSERT_EQ(depths.size(), res.size());
+        for (const auto& r : res) {
+            assert(depths.find(r.descriptor.rid) != depths.end());
+            assert(r.record.getDepth() >= depths[r.descriptor.rid]);
+        }
+        auto names = std::set<std::string> {};
+        for (const auto& r : res) {
+            names.insert(r.record.getText("name"));
+        }
+        assert((names == std::set<std::string> { "A", "B", "C", "D", "E", "F" }));
+
+        auto cursor = txn.traverseOut(z).depth(2, 2).depthFirst().getCursor();
+        while (cursor.next()) {
+            ASSERT_EQ(cursor->record.getDepth(), 2U);
+        }
+
+        res = txn.traverseOut(z).maxDepth(1).depthFirst().get();
+        ASSERT_SIZE(res, 2);
+        assert(res[1].record.get("name").toText() == "A");
+
+        res = txn.traverseOut(a)
+                  .depthFirst()
+                  .whereV(nogdb::GraphFilter(
+                      [](const nogdb::Record& record) { return record.get("population").toBigIntU() < 2000ULL; }))
+                  .get();
+        ASSERT_SIZE(res, 3);
+        names.clear();
+        for (const auto& r : res) {
+            names.insert(r.record.getText("name"));
+        }
+        assert((names == std::set<std::string> { "A", "B", "E" }));
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    txn.commit();
+}
+
+void test_dfs_traverse_shallower_path()
+{
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addClass("dfs_vertex", nogdb::ClassType::VERTEX);
+        txn.addProperty("dfs_vertex", "name", nogdb::PropertyType::TEXT);
+        txn.addClass("dfs_edge", nogdb::ClassType::EDGE);
+        auto a = txn.addVertex("dfs_vertex", nogdb::Record {}.set("name", "A"));
+        auto b = txn.addVertex("dfs_vertex", nogdb::Record {}.set("name", "B"));
+        auto c = txn.addVertex("dfs_vertex", nogdb::Record {}.set("name", "C"));
+        auto d = txn.addVertex("dfs_vertex", nogdb::Record {}.set("name", "D"));
+        txn.addEdge("dfs_edge", a, b);
+        txn.addEdge("dfs_edge", b, c);
+        txn.addEdge("dfs_edge", c, d);
+        txn.addEdge("dfs_edge", a, c);
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        auto a = txn.find("dfs_vertex").where(nogdb::Condition("name").eq("A")).get()[0].descriptor;
+
+        // C is found through B before the shorter edge from A, so it keeps the depth of its first path
+        // and D lies beyond the maximum depth
+        auto res = txn.traverseOut(a).maxDepth(2).depthFirst().get();
+        ASSERT_SIZE(res, 3);
+        auto depths = std::map<std::string, unsigned int> {};
+        for (const auto& r : res) {
+            depths.emplace(r.record.getText("name"), r.record.getDepth());
+        }
+        assert((depths == std::map<std::string, unsigned int> { { "A", 0 }, { "B", 1 }, { "C", 2 } }));
+        ASSERT_EQ(txn.traverseOut(a).maxDepth(2).depthFirst().count(), 3UL);
+
+        res = txn.traverseOut(a).depthFirst().get();
+        ASSERT_SIZE(res, 4);
+        assert(res[3].record.getText("name") == "D");
+        ASSERT_EQ(res[3].record.getDepth(), 3U);
+
+        res = txn.traverseOut(a).depth(2, 2).depthFirst().get();
+        ASSERT_SIZE(res, 1);
+        assert(res[0].record.getText("name") == "C");
+
+        // vertices come in the order they are found, so a stream stops as soon as it finds what it looks for
+        auto stream = txn.traverseOut(a).depth(1, 3).depthFirst().getStream();
+        auto names = std::vector<std::string> {};
+        while (stream.next()) {
+            names.emplace_back(stream->record.getText("name"));
+            ASSERT_EQ(stream->record.getDepth(), static_cast<unsigned int>(names.size()));
+            if (names.back() == "C") {
+                break;
+            }
+        }
+        assert((names == std::vector<std::string> { "B", "C" }));
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropClass("dfs_edge");
+        txn.dropClass("dfs_vertex");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+}
+
+void test_traverse_stream()
+{
+    auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+    nogdb::RecordDescriptor a;
+    try {
+        auto res = txn.find("country").where(nogdb::Condition("name").eq("A")).get();
+        ASSERT_SIZE(res, 1);
+        a = res[0].descriptor;
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto expected = txn.traverseOut(a).depth(0, 4).get();
+        auto stream = txn.traverseOut(a).depth(0, 4).getStream();
+        auto count = size_t { 0 };
+        while (stream.next()) {
+            assert(stream->descriptor == expected[count].descriptor);
+            ASSERT_EQ(stream->record.getDepth(), expected[count].record.getDepth());
+            ++count;
+        }
+        ASSERT_EQ(count, expected.size());
+        assert(!stream.next());
+
+        expected = txn.traverseOut(a).depthFirst().get();
+        stream = txn.traverseOut(a).depthFirst().getStream();
+        count = 0;
+        while (stream.next()) {
+            assert(stream->descriptor == expected[count].descriptor);
+            ++count;
+        }
+        ASSERT_EQ(count, expected.size());
+
+        // stop as soon as a vertex of interest is found
+        stream = txn.traverseOut(a).minDepth(1).getStream();
+        auto found = false;
+        count = 0;
+        while (!found && stream.next()) {
+            found = stream->record.getBigIntU("population") > 1000ULL;
+            ++count;
+        }
+        assert(found);
+        ASSERT_TRUE(count < expected.size());
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    txn.commit();
+}
+
+void test_traverse_paths()
+{
+    auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+    nogdb::RecordDescriptor z;
+    try {
+        auto res = txn.find("country").where(nogdb::Condition("name").eq("Z")).get();
+        ASSERT_SIZE(res, 1);
+        z = res[0].descriptor;
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto expected = txn.traverseOut(z).get();
+        auto paths = txn.traverseOut(z).getPaths();
+        ASSERT_EQ(paths.size(), expected.size());
+        assert(paths.getVertex(0) == z);
+        ASSERT_EQ(paths.getParent(0), nogdb::TraversalPaths::NO_PARENT);
+        ASSERT_EQ(paths.getDepth(0), 0U);
+        for (auto i = size_t { 1 }; i < paths.size(); ++i) {
+            auto parent = paths.getParent(i);
+            ASSERT_TRUE(parent < i);
+            ASSERT_EQ(paths.getDepth(i), paths.getDepth(parent) + 1);
+            assert(txn.fetchSrc(paths.getEdge(i)).descriptor == paths.getVertex(parent));
+            assert(txn.fetchDst(paths.getEdge(i)).descriptor == paths.getVertex(i));
+
+            auto path = paths.getPath(i);
+            ASSERT_EQ(path.size(), size_t { 2 * paths.getDepth(i) + 1 });
+            assert(path.front() == z);
+            assert(path.back() == paths.getVertex(i));
+            for (auto j = size_t { 1 }; j < path.size(); j += 2) {
+                assert(txn.fetchSrc(path[j]).descriptor == path[j - 1]);
+                assert(txn.fetchDst(path[j]).descriptor == path[j + 1]);
+            }
+        }
+
+        // vertices above the minimum depth are still kept as the ancestors of the others
+        paths = txn.traverseOut(z).depth(2, 2).depthFirst().getPaths();
+        expected = txn.traverseOut(z).depth(0, 2).depthFirst().get();
+        ASSERT_EQ(paths.size(), expected.size());
+        for (auto i = size_t { 0 }; i < paths.size(); ++i) {
+            assert(paths.getVertex(i) == expected[i].descriptor);
+            ASSERT_EQ(paths.getDepth(i), expected[i].record.getDepth());
+        }
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    txn.commit();
+}
+
+void test_traverse_and_edge_count()
+{
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addClass("count_vertex", nogdb::ClassType::VERTEX);
+        txn.addProperty("count_vertex", "value", nogdb::PropertyType::UNSIGNED_INTEGER);
+        txn.addClass("count_edge", nogdb::ClassType::EDGE);
+        txn.addProperty("count_edge", "weight", nogdb::PropertyType::UNSIGNED_INTEGER);
+        txn.addClass("count_other_edge", nogdb::ClassType::EDGE);
+        auto v0 = txn.addVertex("count_vertex", nogdb::Record {}.set("value", 0U));
+        auto v1 = txn.addVertex("count_vertex", nogdb::Record {}.set("value", 1U));
+        auto v2 = txn.addVertex("count_vertex", nogdb::Record {}.set("value", 2U));
+        auto v3 = txn.addVertex("count_vertex", nogdb::Record {}.set("value", 3U));
+        txn.addEdge("count_edge", v0, v1, nogdb::Record {}.set("weight", 1U));
+        txn.addEdge("count_edge", v0, v1, nogdb::Record {}.set("weight", 2U));
+        txn.addEdge("count_edge", v0, v2, nogdb::Record {}.set("weight", 3U));
+        txn.addEdge("count_edge", v0, v0, nogdb::Record {}.set("weight", 4U));
+        txn.addEdge("count_other_edge", v2, v0);
+        txn.addEdge("count_other_edge", v1, v3);
+        txn.addEdge("count_other_edge", v2, v3);
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        auto v0 = txn.find("count_vertex").where(nogdb::Condition("value").eq(0U)).get()[0].descriptor;
+
+        ASSERT_EQ(txn.findOutEdge(v0).count(), 4UL);
+        ASSERT_EQ(txn.findInEdge(v0).count(), 2UL);
+        // the loop edge is counted once among all edges of the vertex
+        ASSERT_EQ(txn.findEdge(v0).count(), 5UL);
+        ASSERT_EQ(txn.findEdge(v0).count(), static_cast<unsigned long>(txn.findEdge(v0).get().size()));
+        ASSERT_EQ(txn.findEdge(v0).where(nogdb::GraphFilter {}.only("count_edge")).count(), 4UL);
+        ASSERT_EQ(txn.findEdge(v0).where(nogdb::GraphFilter { nogdb::Condition("weight").ge(2U) }).count(), 3UL);
+        ASSERT_EQ(txn.findInEdge(v0).where(nogdb::GraphFilter {}.exclude("count_edge")).count(), 1UL);
+
+        ASSERT_EQ(txn.traverseOut(v0).count(), 4UL);
+        ASSERT_EQ(txn.traverseOut(v0).depth(2, 2).count(), 1UL);
+        ASSERT_EQ(txn.traverse(v0).minDepth(1).count(), 3UL);
+        ASSERT_EQ(txn.traverseOut(v0).whereE(nogdb::GraphFilter {}.only("count_edge")).count(), 3UL);
+        ASSERT_EQ(txn.traverseOut(v0).depthFirst().count(),
+            static_cast<unsigned long>(txn.traverseOut(v0).depthFirst().get().size()));
+        ASSERT_EQ(txn.traverseIn(v0).minDepth(1).whereV(nogdb::GraphFilter { nogdb::Condition("value").gt(0U) }).count(), 1UL);
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropClass("count_other_edge");
+        txn.dropClass("count_edge");
+        txn.dropClass("count_vertex");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+}
+
+void test_graph_analytics()
+{
+    auto numTriangles = 0UL;
+    auto numVertices = size_t { 0 };
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        auto analytics = txn.analytics();
+        numTriangles = analytics.countTriangles();
+        numVertices = analytics.getNumVertices();
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addClass("analytics_vertex", nogdb::ClassType::VERTEX);
+        txn.addProperty("analytics_vertex", "name", nogdb::PropertyType::TEXT);
+        txn.addClass("analytics_edge", nogdb::ClassType::EDGE);
+        auto a = txn.addVertex("analytics_vertex", nogdb::Record {}.set("name", "a"));
+        auto b = txn.addVertex("analytics_vertex", nogdb::Record {}.set("name", "b"));
+        auto c = txn.addVertex("analytics_vertex", nogdb::Record {}.set("name", "c"));
+        auto d = txn.addVertex("analytics_vertex", nogdb::Record {}.set("name", "d"));
+        auto e = txn.addVertex("analytics_vertex", nogdb::Record {}.set("name", "e"));
+        txn.addVertex("analytics_vertex", nogdb::Record {}.set("name", "f"));
+        txn.addEdge("analytics_edge", a, b);
+        txn.addEdge("analytics_edge", a, c);
+        txn.addEdge("analytics_edge", b, c);
+        txn.addEdge("analytics_edge", c, a);
+        txn.addEdge("analytics_edge", b, a);
+        txn.addEdge("analytics_edge", a, a);
+        txn.addEdge("analytics_edge", d, e);
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        auto names = std::map<nogdb::RecordDescriptor, std::string> {};
+        for (const auto& res : txn.find("analytics_vertex").get()) {
+            names[res.descriptor] = res.record.getText("name");
+        }
+
+        auto analytics = txn.analytics();
+        ASSERT_EQ(analytics.getNumVertices(), numVertices + 6);
+        // parallel edges and loop edges never make more triangles
+        ASSERT_EQ(analytics.countTriangles(), numTriangles + 1);
+
+        auto components = std::map<std::string, size_t> {};
+        for (const auto& component : analytics.getConnectedComponents()) {
+            if (names.find(component.first) != names.cend()) {
+                components[names[component.first]] = component.second;
+            }
+        }
+        ASSERT_EQ(components.size(), size_t { 6 });
+        ASSERT_EQ(components["a"], components["b"]);
+        ASSERT_EQ(components["a"], components["c"]);
+        ASSERT_EQ(components["d"], components["e"]);
+        ASSERT_NE(components["a"], components["d"]);
+        ASSERT_NE(components["a"], components["f"]);
+        ASSERT_NE(components["d"], components["f"]);
+
+        auto ranks = std::map<std::string, double> {};
+        auto totalRank = 0.0;
+        for (const auto& rank : analytics.pageRank()) {
+            totalRank += rank.second;
+            if (names.find(rank.first) != names.cend()) {
+                ranks[names[rank.first]] = rank.second;
+            }
+        }
+        ASSERT_TRUE(std::fabs(totalRank - 1.0) < 1e-6);
+        ASSERT_TRUE(ranks["e"] > ranks["d"]);
+        ASSERT_TRUE(ranks["a"] > ranks["f"]);
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropClass("analytics_edge");
+        txn.dropClass("analytics_vertex");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+}
+
+void test_traverse_with_adjacency_cache()
+{
+    auto toDescriptors = [](const nogdb::ResultSet& res) {
+        auto descriptors = std::vector<nogdb::RecordDescriptor> {};
+        for (const auto& r : res) {
+            descriptors.emplace_back(r.descriptor);
+        }
+        return descriptors;
+    };
+
+    nogdb::RecordDescriptor a, z;
+    auto expectedBfs = std::vector<nogdb::RecordDescriptor> {};
+    auto expectedDfs = std::vector<nogdb::RecordDescriptor> {};
+    auto expectedPath = std::vector<nogdb::RecordDescriptor> {};
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        a = txn.find("country").where(nogdb::Condition("name").eq("A")).get()[0].descriptor;
+        z = txn.find("country").where(nogdb::Condition("name").eq("Z")).get()[0].descriptor;
+        expectedBfs = toDescriptors(txn.traverse(z).get());
+        expectedDfs = toDescriptors(txn.traverseIn(a).depthFirst().get());
+        expectedPath = toDescriptors(txn.shortestPath(z, a).get());
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    ctx->enableAdjacencyCache();
+    assert(ctx->isAdjacencyCacheEnabled());
+    try {
+        // the cached adjacency gives the same vertices in the same order as the relation tables
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        assert(toDescriptors(txn.traverse(z).get()) == expectedBfs);
+        assert(toDescriptors(txn.traverseIn(a).depthFirst().get()) == expectedDfs);
+        assert(toDescriptors(txn.shortestPath(z, a).get()) == expectedPath);
+        txn.commit();
+
+        auto oldTxn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        auto writeTxn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        auto vertex = writeTxn.addVertex("country", nogdb::Record {}.set("name", "cached"));
+        writeTxn.addEdge("path", z, vertex);
+        // a read-write transaction reads its own changes from the relation tables
+        ASSERT_SIZE(writeTxn.traverse(z).get(), expectedBfs.size() + 1);
+        writeTxn.commit();
+
+        ASSERT_SIZE(oldTxn.traverse(z).get(), expectedBfs.size());
+        oldTxn.commit();
+        txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        ASSERT_SIZE(txn.traverse(z).get(), expectedBfs.size() + 1);
+        txn.commit();
+
+        writeTxn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        writeTxn.remove(vertex);
+        writeTxn.commit();
+        txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        assert(toDescriptors(txn.traverse(z).get()) == expectedBfs);
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    ctx->disableAdjacencyCache();
+    assert(!ctx->isAdjacencyCacheEnabled());
+}
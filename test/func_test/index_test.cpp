@@ -1203,6 +1203,525 @@ void test_search_by_index_non_unique_condition()
     destroy_vertex_index_test();
 }
 
+void test_search_by_index_non_unique_condition_with_records()
+{
+    init_vertex_index_test();
+
+    // enough records to have position ids spanning several bytes and many duplicates per key
+    const auto numOfRecords = 1000U;
+    auto expectedInts = std::map<int32_t, std::vector<nogdb::RecordDescriptor>> {};
+    auto expectedReals = std::map<double, std::vector<nogdb::RecordDescriptor>> {};
+    auto expectedTexts = std::map<std::string, std::vector<nogdb::RecordDescriptor>> {};
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        for (auto i = 0U; i < numOfRecords; ++i) {
+            auto intValue = static_cast<int32_t>(i % 7) - 3;
+            auto realValue = static_cast<double>(i % 5) - 2.5;
+            auto textValue = "text" + std::to_string(i % 11);
+            auto rdesc = txn.addVertex("index_test",
+                nogdb::Record {}
+                    .set("index_int", intValue)
+                    .set("index_real", realValue)
+                    .set("index_text", textValue));
+            expectedInts[intValue].emplace_back(rdesc);
+            expectedReals[realValue].emplace_back(rdesc);
+            expectedTexts[textValue].emplace_back(rdesc);
+        }
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addIndex("index_test", "index_int", false);
+        txn.addIndex("index_test", "index_real", false);
+        txn.addIndex("index_test", "index_text", false);
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        for (const auto& expected : expectedInts) {
+            auto res = txn.find("index_test").indexed().where(nogdb::Condition("index_int").eq(expected.first)).get();
+            assert(rdescCompare("index_int", res, expected.second));
+        }
+        for (const auto& expected : expectedReals) {
+            auto res = txn.find("index_test").indexed().where(nogdb::Condition("index_real").eq(expected.first)).get();
+            assert(rdescCompare("index_real", res, expected.second));
+        }
+        for (const auto& expected : expectedTexts) {
+            auto res = txn.find("index_test").indexed().where(nogdb::Condition("index_text").eq(expected.first)).get();
+            assert(rdescCompare("index_text", res, expected.second));
+        }
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropIndex("index_test", "index_int");
+        txn.dropIndex("index_test", "index_real");
+        txn.dropIndex("index_test", "index_text");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    destroy_vertex_index_test();
+}
+
+void test_search_by_fulltext_index_condition()
+{
+    init_vertex_index_test();
+
+    const auto words = std::vector<std::string> { "Alpha", "bravo", "CHARLIE", "delta", "echo", "foxtrot", "golf" };
+    const auto numOfRecords = 200U;
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        for (auto i = 0U; i < numOfRecords; ++i) {
+            auto textValue = words[i % words.size()] + " " + words[(i / words.size()) % words.size()] + std::to_string(i);
+            txn.addVertex("index_test", nogdb::Record {}.set("index_text", textValue));
+        }
+        txn.addVertex("index_test", nogdb::Record {}.set("index_int", 1));
+        txn.addIndex("index_test", "index_text", nogdb::IndexType::FULLTEXT);
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    auto conditions = std::vector<nogdb::Condition> {
+        nogdb::Condition("index_text").contain("rav"),
+        nogdb::Condition("index_text").contain("charlie").ignoreCase(),
+        nogdb::Condition("index_text").contain("charlie"),
+        nogdb::Condition("index_text").contain("ho golf1"),
+        nogdb::Condition("index_text").contain("zulu"),
+        nogdb::Condition("index_text").beginWith("delta"),
+        nogdb::Condition("index_text").endWith("lf19"),
+        nogdb::Condition("index_text").like("%lph%cho%"),
+        nogdb::Condition("index_text").like("ALP_A%").ignoreCase()
+    };
+    auto verify = [&](const nogdb::Transaction& txn) {
+        for (const auto& condition : conditions) {
+            auto expected = std::vector<nogdb::RecordDescriptor> {};
+            for (const auto& res : txn.find("index_test").where(condition).get()) {
+                expected.emplace_back(res.descriptor);
+            }
+            auto res = txn.find("index_test").indexed().where(condition).get();
+            assert(rdescCompare("index_text", res, expected));
+            assert(txn.find("index_test").indexed().where(condition).count() == expected.size());
+        }
+    };
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        verify(txn);
+        // too short to be tokenized or negated, hence not answered by the index
+        assert(txn.find("index_test").indexed().where(nogdb::Condition("index_text").contain("al")).get().empty());
+        assert(txn.find("index_test").indexed().where(!nogdb::Condition("index_text").contain("alpha")).get().empty());
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        auto res = txn.find("index_test").where(nogdb::Condition("index_text").contain("bravo")).get();
+        for (const auto& r : res) {
+            if (r.descriptor.rid.second % 2 == 0) {
+                txn.update(r.descriptor, nogdb::Record {}.set("index_text", "Charlie zulu"));
+            } else {
+                txn.remove(r.descriptor);
+            }
+        }
+        txn.addVertex("index_test", nogdb::Record {}.set("index_text", "delta zulu"));
+        verify(txn);
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addIndex("index_test", "index_int", nogdb::IndexType::FULLTEXT);
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_INVALID_PROPTYPE_INDEX, "NOGDB_CTX_INVALID_PROPTYPE_INDEX");
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropIndex("index_test", "index_text");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    destroy_vertex_index_test();
+}
+
+void test_search_by_hash_index_condition()
+{
+    init_vertex_index_test();
+
+    const auto numOfRecords = 500U;
+    auto expectedTexts = std::map<std::string, std::vector<nogdb::RecordDescriptor>> {};
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        for (auto i = 0U; i < numOfRecords; ++i) {
+            auto email = "user" + std::to_string(i) + "@nogdb.org";
+            auto rdesc = txn.addVertex("index_test", nogdb::Record {}
+                .set("index_text", email)
+                .set("index_int", static_cast<int32_t>(i % 3)));
+            expectedTexts[email].emplace_back(rdesc);
+        }
+        // unique text indexes are hashed unless an ordered one is asked for
+        auto index = txn.addIndex("index_test", "index_text", true, nogdb::IndexType::ORDERED);
+        assert(index.type == nogdb::IndexType::ORDERED && index.unique);
+        txn.dropIndex("index_test", "index_text");
+        index = txn.addIndex("index_test", "index_text", true);
+        assert(index.type == nogdb::IndexType::HASH && index.unique);
+        assert(txn.getIndex("index_test", "index_text").type == nogdb::IndexType::HASH);
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        for (const auto& expected : expectedTexts) {
+            auto res = txn.find("index_test").indexed().where(nogdb::Condition("index_text").eq(expected.first)).get();
+            assert(rdescCompare("index_text", res, expected.second));
+        }
+        assert(txn.find("index_test").indexed().where(nogdb::Condition("index_text").eq("nobody@nogdb.org")).get().empty());
+        // case-insensitive and negated lookups are not answered by hashes
+        assert(txn.find("index_test").indexed()
+                   .where(nogdb::Condition("index_text").eq("USER1@NOGDB.ORG").ignoreCase()).get().empty());
+        assert(txn.find("index_test").indexed().where(!nogdb::Condition("index_text").eq("user1@nogdb.org")).get().empty());
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        auto rdesc = expectedTexts["user7@nogdb.org"].front();
+        txn.update(rdesc, nogdb::Record {}.set("index_text", "user7@example.com"));
+        txn.remove(expectedTexts["user8@nogdb.org"].front());
+        auto res = txn.find("index_test").indexed().where(nogdb::Condition("index_text").eq("user7@example.com")).get();
+        assert(rdescCompare("index_text", res, { rdesc }));
+        assert(txn.find("index_test").indexed().where(nogdb::Condition("index_text").eq("user7@nogdb.org")).get().empty());
+        assert(txn.find("index_test").indexed().where(nogdb::Condition("index_text").eq("user8@nogdb.org")).get().empty());
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    auto isViolated = false;
+    try {
+        // a unique constraint violation aborts the transaction
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addVertex("index_test", nogdb::Record {}.set("index_text", "user9@nogdb.org"));
+    } catch (const nogdb::FatalError& ex) {
+        isViolated = true;
+    }
+    assert(isViolated);
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addIndex("index_test", "index_int", nogdb::IndexType::HASH);
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_INVALID_PROPTYPE_INDEX, "NOGDB_CTX_INVALID_PROPTYPE_INDEX");
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addIndex("index_test", "index_text", true, nogdb::IndexType::FULLTEXT);
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_INVALID_INDEX_CONSTRAINT, "NOGDB_CTX_INVALID_INDEX_CONSTRAINT");
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropIndex("index_test", "index_text");
+        for (auto i = 0U; i < 10U; ++i) {
+            txn.addVertex("index_test", nogdb::Record {}.set("index_text", "user9@nogdb.org"));
+        }
+        // a hash index of an explicit type accepts duplicated values
+        auto index = txn.addIndex("index_test", "index_text", nogdb::IndexType::HASH);
+        assert(index.type == nogdb::IndexType::HASH && !index.unique);
+        auto res = txn.find("index_test").indexed().where(nogdb::Condition("index_text").eq("user9@nogdb.org")).get();
+        assert(res.size() == 11);
+        txn.dropIndex("index_test", "index_text");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    destroy_vertex_index_test();
+}
+
+void test_search_by_index_query_plan()
+{
+    init_vertex_index_test();
+
+    const auto numOfRecords = 1000U;
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        for (auto i = 0U; i < numOfRecords; ++i) {
+            txn.addVertex("index_test", nogdb::Record {}
+                .set("index_text", "name" + std::to_string(i % 10))
+                .set("index_int", static_cast<int32_t>((i % 10 == 0) ? 1 : 0))
+                .set("index_bigint", static_cast<int64_t>(i)));
+        }
+        txn.addIndex("index_test", "index_int");
+        txn.addIndex("index_test", "index_bigint");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    // every plan must return the same records as a full scan
+    auto assertPlan = [](const nogdb::Transaction& txn,
+                          const nogdb::MultiCondition& conditions,
+                          bool (*cmpFunction)(const nogdb::Record&),
+                          nogdb::QueryPlan::Strategy strategy) {
+        auto plans = txn.find("index_test").where(conditions).explain();
+        assert(plans.size() == 1);
+        assert(plans.front().className == "index_test");
+        assert(plans.front().strategy == strategy);
+        auto res = txn.find("index_test").where(conditions).get();
+        auto expected = std::vector<nogdb::RecordDescriptor> {};
+        for (const auto& result : txn.find("index_test").where(cmpFunction).get()) {
+            expected.emplace_back(result.descriptor);
+        }
+        assert(rdescCompare("index_test", res, expected));
+        assert(txn.find("index_test").where(conditions).count() == expected.size());
+        auto cursor = txn.find("index_test").where(conditions).getCursor();
+        assert(cursor.count() == expected.size());
+    };
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        auto plans = txn.find("index_test").where(nogdb::Condition("index_bigint").eq(int64_t { 7 })).explain();
+        assert(plans.size() == 1);
+        assert(plans.front().strategy == nogdb::QueryPlan::Strategy::INDEX_SCAN);
+        assert(plans.front().indexedProperties == std::vector<std::string> { "index_bigint" });
+        assert(plans.front().estimatedRecords == 1.0);
+
+        plans = txn.find("index_test").where(nogdb::Condition("index_int").eq(int32_t { 1 })).explain();
+        assert(plans.front().strategy == nogdb::QueryPlan::Strategy::INDEX_SCAN);
+        assert(plans.front().estimatedRecords == 100.0);
+
+        // fetching most of the records by their position ids costs more than reading the whole class
+        plans = txn.find("index_test").where(nogdb::Condition("index_int").eq(int32_t { 0 })).explain();
+        assert(plans.front().strategy == nogdb::QueryPlan::Strategy::FULL_SCAN);
+        assert(plans.front().estimatedRecords == 900.0);
+        assert(txn.find("index_test").where(nogdb::Condition("index_int").eq(int32_t { 0 })).count() == 900);
+        plans = txn.find("index_test").indexed().where(nogdb::Condition("index_int").eq(int32_t { 0 })).explain();
+        assert(plans.front().strategy == nogdb::QueryPlan::Strategy::INDEX_SCAN);
+        assert(txn.find("index_test").indexed().where(nogdb::Condition("index_int").eq(int32_t { 0 })).count() == 900);
+
+        assertPlan(txn,
+            nogdb::Condition("index_bigint").eq(int64_t { 7 }) && nogdb::Condition("index_int").eq(int32_t { 0 }),
+            [](const nogdb::Record& record) {
+                return record.getBigInt("index_bigint") == 7 && record.getInt("index_int") == 0;
+            },
+            nogdb::QueryPlan::Strategy::INDEX_WITH_FILTER);
+        assertPlan(txn,
+            nogdb::Condition("index_bigint").eq(int64_t { 17 }) && nogdb::Condition("index_text").eq("name7"),
+            [](const nogdb::Record& record) {
+                return record.getBigInt("index_bigint") == 17 && record.getText("index_text") == "name7";
+            },
+            nogdb::QueryPlan::Strategy::INDEX_WITH_FILTER);
+        assertPlan(txn,
+            nogdb::Condition("index_bigint").eq(int64_t { 7 }) || nogdb::Condition("index_int").eq(int32_t { 1 }),
+            [](const nogdb::Record& record) {
+                return record.getBigInt("index_bigint") == 7 || record.getInt("index_int") == 1;
+            },
+            nogdb::QueryPlan::Strategy::INDEX_INTERSECTION);
+        assertPlan(txn,
+            nogdb::Condition("index_bigint").eq(int64_t { 7 }) || nogdb::Condition("index_int").eq(int32_t { 0 }),
+            [](const nogdb::Record& record) {
+                return record.getBigInt("index_bigint") == 7 || record.getInt("index_int") == 0;
+            },
+            nogdb::QueryPlan::Strategy::FULL_SCAN);
+        assertPlan(txn,
+            nogdb::Condition("index_bigint").eq(int64_t { 7 }) || nogdb::Condition("index_text").eq("name7"),
+            [](const nogdb::Record& record) {
+                return record.getBigInt("index_bigint") == 7 || record.getText("index_text") == "name7";
+            },
+            nogdb::QueryPlan::Strategy::FULL_SCAN);
+
+        // searching indexes only never reads records which are not found in indexes
+        auto multiCondition =
+            nogdb::Condition("index_bigint").eq(int64_t { 17 }) && nogdb::Condition("index_text").eq("name7");
+        plans = txn.find("index_test").indexed().where(multiCondition).explain();
+        assert(plans.front().strategy == nogdb::QueryPlan::Strategy::FULL_SCAN);
+        assert(txn.find("index_test").indexed().where(multiCondition).get().empty());
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        for (auto i = 0U; i < numOfRecords; ++i) {
+            txn.addVertex("index_test", nogdb::Record {}
+                .set("index_int", int32_t { 1 })
+                .set("index_bigint", static_cast<int64_t>(numOfRecords + i)));
+        }
+        // statistics are scaled to the number of entries until the index is analyzed again
+        auto plans = txn.find("index_test").where(nogdb::Condition("index_int").eq(int32_t { 1 })).explain();
+        assert(plans.front().estimatedRecords == 200.0);
+        txn.analyze("index_test");
+        plans = txn.find("index_test").where(nogdb::Condition("index_int").eq(int32_t { 1 })).explain();
+        assert(plans.front().estimatedRecords == 1100.0);
+        assert(plans.front().strategy == nogdb::QueryPlan::Strategy::INDEX_SCAN);
+        plans = txn.find("index_test").where(nogdb::Condition("index_int").eq(int32_t { 0 })).explain();
+        assert(plans.front().estimatedRecords == 900.0);
+
+        auto result = nogdb::SQL::execute(txn, "ANALYZE index_test;");
+        assert(result.type() == nogdb::SQL::Result::NO_RESULT);
+        assert(txn.find("index_test").where(nogdb::Condition("index_int").eq(int32_t { 1 })).count() == 1100);
+
+        txn.dropIndex("index_test", "index_int");
+        txn.dropIndex("index_test", "index_bigint");
+        plans = txn.find("index_test").where(nogdb::Condition("index_bigint").eq(int64_t { 7 })).explain();
+        assert(plans.front().strategy == nogdb::QueryPlan::Strategy::FULL_SCAN);
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    destroy_vertex_index_test();
+}
+
+void test_search_by_index_in_condition()
+{
+    init_vertex_index_test();
+
+    const auto numOfRecords = 2000;
+    auto expectedIds = std::vector<nogdb::RecordDescriptor> {};
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        for (auto i = 0; i < numOfRecords; ++i) {
+            auto rdesc = txn.addVertex("index_test", nogdb::Record {}
+                .set("index_text", "name" + std::to_string(i % 50))
+                .set("index_int", static_cast<int32_t>(i % 100 - 50))
+                .set("index_int_u", static_cast<uint32_t>(i % 100))
+                .set("index_real", static_cast<double>(i % 100 - 50) / 4.0)
+                .set("index_bigint", static_cast<int64_t>(i)));
+            expectedIds.emplace_back(rdesc);
+        }
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    auto conditions = std::vector<nogdb::Condition> {
+        nogdb::Condition("index_int").in(int32_t { -50 }, int32_t { -1 }, int32_t { 0 }, int32_t { 7 }, int32_t { 7 }, int32_t { 99 }),
+        nogdb::Condition("index_int_u").in(uint32_t { 99 }, uint32_t { 0 }, uint32_t { 42 }, uint32_t { 1000 }),
+        nogdb::Condition("index_real").in(-12.5, -0.25, 0.0, 3.75, 100.0),
+        nogdb::Condition("index_text").in(std::string { "name7" }, std::string { "name10" }, std::string { "name70" })
+    };
+    auto expectedResults = std::vector<nogdb::ResultSet> {};
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        for (const auto& condition : conditions) {
+            expectedResults.emplace_back(txn.find("index_test").where(condition).get());
+            assert(!expectedResults.back().empty());
+        }
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addIndex("index_test", "index_int");
+        txn.addIndex("index_test", "index_int_u");
+        txn.addIndex("index_test", "index_real");
+        txn.addIndex("index_test", "index_text");
+        txn.addIndex("index_test", "index_bigint", true);
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        for (auto i = 0U; i < conditions.size(); ++i) {
+            auto expected = std::vector<nogdb::RecordDescriptor> {};
+            for (const auto& result : expectedResults[i]) {
+                expected.emplace_back(result.descriptor);
+            }
+            auto res = txn.find("index_test").indexed().where(conditions[i]).get();
+            assert(rdescCompare("index_test", res, expected));
+            assert(txn.find("index_test").indexed().where(conditions[i]).count() == expected.size());
+        }
+        // a case-insensitive list cannot be answered by exact keys
+        assert(txn.find("index_test").indexed()
+                   .where(nogdb::Condition("index_text").in(std::string { "NAME7" }).ignoreCase()).get().empty());
+
+        // a batch of keys is found with a single pass over the index
+        auto ids = std::vector<int64_t> {};
+        for (auto i = numOfRecords * 2 - 1; i >= 0; i -= 2) {
+            ids.emplace_back(i);
+        }
+        auto res = txn.find("index_test").indexed().where(nogdb::Condition("index_bigint").in(ids)).get();
+        auto expected = std::vector<nogdb::RecordDescriptor> {};
+        for (auto i = 1; i < numOfRecords; i += 2) {
+            expected.emplace_back(expectedIds[i]);
+        }
+        assert(rdescCompare("index_bigint", res, expected));
+        auto plans = txn.find("index_test").where(nogdb::Condition("index_bigint").in(ids)).explain();
+        assert(plans.front().strategy == nogdb::QueryPlan::Strategy::INDEX_SCAN);
+
+        auto multiCondition = nogdb::Condition("index_bigint").in(ids)
+            && nogdb::Condition("index_int").in(int32_t { -49 }, int32_t { 1 });
+        res = txn.find("index_test").where(multiCondition).get();
+        expected.clear();
+        for (auto i = 1; i < numOfRecords; i += 2) {
+            if (i % 100 == 1 || i % 100 == 51) {
+                expected.emplace_back(expectedIds[i]);
+            }
+        }
+        assert(rdescCompare("index_bigint", res, expected));
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropIndex("index_test", "index_int");
+        txn.dropIndex("index_test", "index_int_u");
+        txn.dropIndex("index_test", "index_real");
+        txn.dropIndex("index_test", "index_text");
+        txn.dropIndex("index_test", "index_bigint");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    destroy_vertex_index_test();
+}
+
 void test_search_by_index_unique_cursor_condition()
 {
     init_vertex_index_test();
@@ -1685,6 +1685,10 @@ void test_sql_traverse()
         assert(result.type() == result.RESULT_SET);
         assert(result.get<ResultSet>() == txn.traverse(v21).depth(1, 1).whereE(nogdb::GraphFilter {}.only("EL")).get());
 
+        result = SQL::execute(txn, "TRAVERSE out() FROM " + to_string(v1) + " STRATEGY DEPTH_FIRST");
+        assert(result.type() == result.RESULT_SET);
+        assert(result.get<ResultSet>() == txn.traverseOut(v1).depth(0, UINT_MAX).depthFirst().get());
+
         result = SQL::execute(txn, "SELECT p FROM (TRAVERSE out() FROM " + to_string(v1) + ") WHERE p = 'v22'");
         assert(result.type() == result.RESULT_SET);
         {
@@ -1785,3 +1789,654 @@ void test_sql_drop_index()
     txn.dropClass("V");
     txn.commit();
 }
+
+void test_sql_prepared_statement()
+{
+    auto txn = ctx->beginTxn(TxnMode::READ_WRITE);
+    txn.addClass("v", ClassType::VERTEX);
+    txn.addProperty("v", "text", nogdb::PropertyType::TEXT);
+    txn.addProperty("v", "int", nogdb::PropertyType::INTEGER);
+    txn.addProperty("v", "real", nogdb::PropertyType::REAL);
+
+    try {
+        auto insert = SQL::prepare("CREATE VERTEX v SET text = ?, int = ?, real = :real");
+        auto v1 = insert.bind(0, "it's").bind(1, -5).bind("real", 1.5).execute(txn).get<vector<RecordDescriptor>>();
+        auto v2 = insert.bind(0, "back\\slash").bind(1, 20).bind(":real", 0.1).execute(txn).get<vector<RecordDescriptor>>();
+        auto v3 = insert.bind(0, "C").bind(1, 30u).bind("real", 2.0).execute(txn).get<vector<RecordDescriptor>>();
+        assert(v1.size() == 1 && v2.size() == 1 && v3.size() == 1);
+
+        auto record = txn.fetchRecord(v1[0]);
+        assert(record.getText("text") == "it's");
+        assert(record.getInt("int") == -5);
+        assert(record.getReal("real") == 1.5);
+        record = txn.fetchRecord(v2[0]);
+        assert(record.getText("text") == "back\\slash");
+        assert(record.getReal("real") == 0.1);
+
+        // the same shape is served from the token cache and sees the values bound to each statement
+        auto select = SQL::prepare("SELECT FROM v WHERE int >= :low AND int <= :high");
+        auto result = select.bind("low", 0).bind("high", 25).execute(txn);
+        assert(result.type() == result.RESULT_SET);
+        assert(result.get<ResultSet>() == txn.find("v").where(Condition("int").ge(0) && Condition("int").le(25)).get());
+        result = SQL::prepare("SELECT FROM v WHERE int >= :low AND int <= :high").bind("low", -10).bind("high", 100).execute(txn);
+        assert(result.get<ResultSet>().size() == 3);
+
+        // a record id placeholder, next to a literal record id which keeps its ':'
+        result = SQL::prepare("SELECT FROM ?").bind(0, v3[0]).execute(txn);
+        assert(result.get<ResultSet>().size() == 1);
+        assert(result.get<ResultSet>()[0].descriptor == v3[0]);
+        result = SQL::execute(txn, "SELECT FROM " + to_string(v3[0]));
+        assert(result.get<ResultSet>().size() == 1);
+
+        auto update = SQL::prepare("UPDATE v SET text = ? WHERE text = ?");
+        update.bind(0, nullptr).bind(1, "C").execute(txn);
+        assert(txn.fetchRecord(v3[0]).get("text").empty());
+    } catch (const Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        SQL::prepare("SELECT FROM v WHERE int = ?").execute(txn);
+        assert(false);
+    } catch (const Error& ex) {
+        REQUIRE(ex, NOGDB_SQL_UNBOUND_PARAMETER, "NOGDB_SQL_UNBOUND_PARAMETER");
+    }
+
+    try {
+        SQL::prepare("SELECT FROM v WHERE int = ?").bind(1, 10);
+        assert(false);
+    } catch (const Error& ex) {
+        REQUIRE(ex, NOGDB_SQL_INVALID_PARAMETER, "NOGDB_SQL_INVALID_PARAMETER");
+    }
+
+    try {
+        SQL::prepare("SELECT FROM v WHERE int = :value").bind("other", 10);
+        assert(false);
+    } catch (const Error& ex) {
+        REQUIRE(ex, NOGDB_SQL_INVALID_PARAMETER, "NOGDB_SQL_INVALID_PARAMETER");
+    }
+
+    txn.dropClass("v");
+    txn.commit();
+}
+
+void test_sql_stream()
+{
+    auto txn = ctx->beginTxn(TxnMode::READ_WRITE);
+    txn.addClass("S", ClassType::VERTEX);
+    txn.addProperty("S", "n", PropertyType::INTEGER);
+    txn.addProperty("S", "g", PropertyType::INTEGER);
+    txn.addClass("SE", ClassType::EDGE);
+
+    auto drain = [](const SQL::Result& result) {
+        assert(result.type() == result.RESULT_CURSOR);
+        auto& cursor = result.get<SQL::Cursor>();
+        ResultSet rows {};
+        while (cursor.next()) {
+            rows.push_back(*cursor);
+        }
+        assert(!cursor.next());
+        return rows;
+    };
+
+    try {
+        vector<RecordDescriptor> vertices {};
+        for (int i = 0; i < 30; ++i) {
+            auto record = Record {}.set("g", i % 4);
+            if (i % 5 != 0) {
+                record.set("n", i);
+            }
+            vertices.push_back(txn.addVertex("S", record));
+        }
+        for (size_t i = 1; i < vertices.size(); ++i) {
+            txn.addEdge("SE", vertices[(i - 1) / 2], vertices[i]);
+        }
+
+        auto queries = vector<string> {
+            "SELECT FROM S",
+            "SELECT FROM S WHERE n >= 10",
+            "SELECT FROM S SKIP 3 LIMIT 4",
+            "SELECT FROM S WHERE n < 20 SKIP 40",
+            "SELECT n, g FROM S WHERE g = 1 LIMIT 5",
+            "SELECT n FROM S",
+            "SELECT FROM (SELECT FROM S WHERE n > 5) WHERE n < 15 SKIP 1 LIMIT 3",
+            "SELECT * FROM (SELECT n, g FROM S) WHERE g > 2",
+            "SELECT FROM (" + to_string(vertices[1]) + ", " + to_string(vertices[2]) + ") WHERE n = 2",
+            "TRAVERSE out() FROM " + to_string(vertices[0]),
+            "TRAVERSE all('SE') FROM " + to_string(vertices[1]) + " MAXDEPTH 2 STRATEGY BREADTH_FIRST",
+            "SELECT n FROM (TRAVERSE out() FROM " + to_string(vertices[1]) + ") WHERE n > 1 LIMIT 4",
+            // grouped and aggregated rows are computed together before they are pulled
+            "SELECT count(*) FROM S",
+            "SELECT FROM S GROUP BY g",
+        };
+        for (const auto& query : queries) {
+            auto expected = SQL::execute(txn, query);
+            assert(expected.type() == expected.RESULT_SET);
+            assert(drain(SQL::stream(txn, query)) == expected.get<ResultSet>());
+        }
+
+        // a limit stops the scan as soon as enough rows have been pulled
+        auto result = SQL::prepare("SELECT FROM S WHERE n > ? LIMIT 2").bind(0, 3).stream(txn);
+        auto& cursor = result.get<SQL::Cursor>();
+        assert(cursor.next());
+        assert(cursor->descriptor == vertices[4]);
+        assert(cursor.next());
+        assert(cursor->record.getInt("n") == 6);
+        assert(!cursor.next());
+
+        // other statements return the same results as they are executed
+        result = SQL::stream(txn, "CREATE VERTEX S SET n = 100");
+        assert(result.type() == result.RECORD_DESCRIPTORS);
+    } catch (const Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        SQL::stream(txn, "TRAVERSE sideways() FROM #1:1");
+        assert(false);
+    } catch (const Error& ex) {
+        REQUIRE(ex, NOGDB_SQL_INVALID_TRAVERSE_DIRECTION, "NOGDB_SQL_INVALID_TRAVERSE_DIRECTION");
+    }
+
+    txn.dropClass("SE");
+    txn.dropClass("S");
+    txn.commit();
+}
+
+void test_sql_select_group_by_aggregate()
+{
+    auto txn = ctx->beginTxn(TxnMode::READ_WRITE);
+    txn.addClass("sales", ClassType::VERTEX);
+    txn.addProperty("sales", "region", PropertyType::TEXT);
+    txn.addProperty("sales", "product", PropertyType::TEXT);
+    txn.addProperty("sales", "qty", PropertyType::INTEGER);
+    txn.addProperty("sales", "price", PropertyType::REAL);
+    txn.addProperty("sales", "code", PropertyType::UNSIGNED_INTEGER);
+
+    auto addSale = [&txn](const string& region, const string& product, int qty, double price, unsigned int code) {
+        txn.addVertex("sales",
+            Record {}.set("region", region).set("product", product).set("qty", qty).set("price", price).set("code", code));
+    };
+    addSale("north", "pen", 10, 1.5, 7U);
+    addSale("south", "pen", -4, 2.0, 3U);
+    addSale("north", "ink", 5, 9.25, 12U);
+    addSale("north", "pen", 1, 1.25, 9U);
+    addSale("south", "ink", 8, 8.5, 1U);
+    txn.addVertex("sales", Record {}.set("region", "west").set("product", "pen"));
+
+    auto byText = [](const ResultSet& rows, const string& propName, const string& value) {
+        auto found = find_if(rows.cbegin(), rows.cend(),
+            [&](const Result& row) { return row.record.getText(propName) == value; });
+        assert(found != rows.cend());
+        return found->record;
+    };
+
+    try {
+        auto result = SQL::execute(txn,
+            "SELECT region, count(*), count(qty), sum(qty), min(price), max(price), avg(qty), max(code) FROM sales GROUP BY region");
+        assert(result.type() == result.RESULT_SET);
+        auto rows = result.get<ResultSet>();
+        ASSERT_SIZE(rows, 3);
+        auto north = byText(rows, "region", "north");
+        assert(north.getBigIntU("count") == 3);
+        assert(north.getBigIntU("count2") == 3);
+        assert(north.getBigInt("sum") == 16);
+        assert(north.getReal("min") == 1.25);
+        assert(north.getReal("max") == 9.25);
+        assert(north.getReal("avg") == 16.0 / 3);
+        assert(north.getIntU("max2") == 12U);
+        auto south = byText(rows, "region", "south");
+        assert(south.getBigIntU("count") == 2);
+        assert(south.getBigInt("sum") == 4);
+        assert(south.getReal("avg") == 2.0);
+        auto west = byText(rows, "region", "west");
+        assert(west.getBigIntU("count") == 1);
+        assert(west.getBigIntU("count2") == 0);
+        assert(west.get("sum").empty());
+        assert(west.get("min").empty());
+        assert(west.get("avg").empty());
+
+        // groups of several keys, with an aliased aggregate
+        result = SQL::execute(txn, "SELECT region, product, sum(qty) AS total FROM sales GROUP BY region, product");
+        rows = result.get<ResultSet>();
+        ASSERT_SIZE(rows, 5);
+        auto total = 0LL;
+        for (const auto& row : rows) {
+            if (row.record.getText("region") == "north" && row.record.getText("product") == "pen") {
+                assert(row.record.getBigInt("total") == 11);
+            }
+            if (!row.record.get("total").empty()) {
+                total += row.record.getBigInt("total");
+            }
+        }
+        assert(total == 20);
+
+        // a group key may name an aliased projection
+        result = SQL::execute(txn, "SELECT product AS item, max(qty) FROM sales GROUP BY item");
+        rows = result.get<ResultSet>();
+        ASSERT_SIZE(rows, 2);
+        assert(byText(rows, "item", "pen").getInt("max") == 10);
+        assert(byText(rows, "item", "ink").getInt("max") == 8);
+
+        // aggregates without GROUP BY make one row, even from no rows
+        result = SQL::execute(txn, "SELECT sum(price), min(qty), min(code), sum(code) FROM sales");
+        rows = result.get<ResultSet>();
+        ASSERT_SIZE(rows, 1);
+        assert(rows[0].record.getReal("sum") == 22.5);
+        assert(rows[0].record.getInt("min") == -4);
+        assert(rows[0].record.getIntU("min2") == 1U);
+        assert(rows[0].record.getBigIntU("sum2") == 32U);
+
+        result = SQL::execute(txn, "SELECT count(*), sum(qty) FROM sales WHERE region = 'east'");
+        rows = result.get<ResultSet>();
+        ASSERT_SIZE(rows, 1);
+        assert(rows[0].record.getBigIntU("count") == 0);
+        assert(rows[0].record.get("sum").empty());
+
+        // the same rows are returned by a streamed select
+        result = SQL::stream(txn, "SELECT region, sum(qty) FROM sales GROUP BY region");
+        auto& cursor = result.get<SQL::Cursor>();
+        auto numRows = 0;
+        while (cursor.next()) {
+            ++numRows;
+        }
+        assert(numRows == 3);
+    } catch (const Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        SQL::execute(txn, "SELECT sum(product) FROM sales");
+        assert(false);
+    } catch (const Error& ex) {
+        REQUIRE(ex, NOGDB_SQL_INVALID_FUNCTION_ARGS, "NOGDB_SQL_INVALID_FUNCTION_ARGS");
+    }
+
+    txn.dropClass("sales");
+    txn.commit();
+}
+
+void test_sql_select_nested_pushdown()
+{
+    auto txn = ctx->beginTxn(TxnMode::READ_WRITE);
+    txn.addClass("P", ClassType::VERTEX);
+    txn.addProperty("P", "n", PropertyType::INTEGER);
+    txn.addProperty("P", "g", PropertyType::INTEGER);
+    txn.addClass("PE", ClassType::EDGE);
+
+    auto filter = [](const ResultSet& rows, function<bool(const Record&)> pred) {
+        ResultSet result {};
+        copy_if(rows.cbegin(), rows.cend(), back_inserter(result), [&](const nogdb::Result& r) { return pred(r.record); });
+        return result;
+    };
+    auto select = [&txn](const string& query) {
+        auto result = SQL::execute(txn, query);
+        assert(result.type() == result.RESULT_SET);
+        return result.get<ResultSet>();
+    };
+
+    try {
+        vector<RecordDescriptor> vertices {};
+        for (int i = 0; i < 20; ++i) {
+            vertices.push_back(txn.addVertex("P", Record {}.set("n", i).set("g", i % 3)));
+        }
+        for (size_t i = 1; i < vertices.size(); ++i) {
+            txn.addEdge("PE", vertices[(i - 1) / 3], vertices[i]);
+        }
+
+        // nested selects of whole records return the same rows as the merged ones
+        auto queries = vector<pair<string, string>> {
+            { "SELECT FROM (SELECT FROM P WHERE n > 3) WHERE g = 1",
+                "SELECT FROM P WHERE n > 3 AND g = 1" },
+            { "SELECT n FROM (SELECT FROM (SELECT FROM P WHERE g = 2) WHERE n < 15) SKIP 1 LIMIT 3",
+                "SELECT n FROM P WHERE g = 2 AND n < 15 SKIP 1 LIMIT 3" },
+            { "SELECT FROM (SELECT FROM P SKIP 2 LIMIT 10) SKIP 3 LIMIT 4",
+                "SELECT FROM P SKIP 5 LIMIT 4" },
+            { "SELECT FROM (SELECT FROM P SKIP 2 LIMIT 5) SKIP 3 LIMIT 4",
+                "SELECT FROM P SKIP 5 LIMIT 2" },
+            { "SELECT FROM (SELECT FROM P LIMIT 3) SKIP 4",
+                "SELECT FROM P LIMIT 0" },
+            { "SELECT count(*) FROM (SELECT FROM P WHERE n >= 10) WHERE g = 0",
+                "SELECT count(*) FROM P WHERE n >= 10 AND g = 0" },
+        };
+        for (const auto& query : queries) {
+            assert(select(query.first) == select(query.second));
+        }
+
+        // a limit of the inner select is applied before the outer condition
+        auto result = select("SELECT FROM (SELECT FROM P LIMIT 6) WHERE g = 1");
+        assert(result == filter(select("SELECT FROM P LIMIT 6"), [](const Record& r) { return r.getInt("g") == 1; }));
+        assert(result.size() == 2);
+
+        // rows of a record id target are filtered as they are fetched
+        result = select("SELECT FROM (" + to_string(vertices[1]) + ", " + to_string(vertices[2]) + ", "
+            + to_string(vertices[4]) + ") WHERE g = 1 LIMIT 1");
+        assert(result.size() == 1);
+        assert(result[0].descriptor == vertices[1]);
+
+        // a condition on the first level of a traversal prunes it while keeping its result
+        auto traverse = "TRAVERSE out() FROM " + to_string(vertices[0]);
+        result = select("SELECT FROM (" + traverse + " MINDEPTH 1 MAXDEPTH 1) WHERE g = 1");
+        assert(result == filter(select(traverse + " MINDEPTH 1 MAXDEPTH 1"), [](const Record& r) { return r.getInt("g") == 1; }));
+        assert(result.size() == 1);
+        result = select("SELECT FROM (" + traverse + " MINDEPTH 1 MAXDEPTH 1) WHERE @depth = 1");
+        assert(result.size() == 3);
+
+        // deeper vertices are only reached through the ones of the first level, so they are filtered afterwards
+        result = select("SELECT FROM (" + traverse + ") WHERE g = 2");
+        assert(result == filter(select(traverse), [](const Record& r) { return r.getInt("g") == 2; }));
+        assert(result.size() == 6);
+    } catch (const Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    txn.dropClass("PE");
+    txn.dropClass("P");
+    txn.commit();
+}
+
+void test_sql_explain_profile()
+{
+    auto txn = ctx->beginTxn(TxnMode::READ_WRITE);
+    txn.addClass("X", ClassType::VERTEX);
+    txn.addProperty("X", "k", PropertyType::INTEGER);
+    txn.addProperty("X", "profile", PropertyType::INTEGER);
+    txn.addIndex("X", "k");
+    txn.addClass("XE", ClassType::EDGE);
+
+    auto plan = [&txn](const string& query) {
+        auto result = SQL::execute(txn, query);
+        assert(result.type() == result.QUERY_PLAN);
+        return result.get<QueryPlanNode>();
+    };
+
+    try {
+        vector<RecordDescriptor> vertices {};
+        for (int i = 0; i < 20; ++i) {
+            vertices.push_back(txn.addVertex("X", Record {}.set("k", i % 5).set("profile", i)));
+        }
+        for (size_t i = 1; i < vertices.size(); ++i) {
+            txn.addEdge("XE", vertices[i - 1], vertices[i]);
+        }
+
+        // an explained statement is planned without retrieving any record
+        auto node = plan("EXPLAIN SELECT FROM X WHERE k = 3");
+        assert(node.operation == "FIND");
+        assert(node.plans.size() == 1);
+        assert(node.plans[0].strategy == QueryPlan::Strategy::INDEX_SCAN);
+        assert(node.plans[0].indexedProperties == vector<string> { "k" });
+        assert(node.rows == 0 && node.reads == 0);
+        assert(node.children.empty());
+
+        node = plan("EXPLAIN SELECT count(*) FROM (SELECT FROM X WHERE profile > 4) WHERE k = 1");
+        assert(node.operation == "GROUP");
+        assert(node.children.size() == 1);
+        assert(node.children[0].operation == "FIND");
+        assert(node.children[0].plans[0].strategy == QueryPlan::Strategy::INDEX_WITH_FILTER);
+
+        // a profiled statement measures what every operator produced, including its inputs
+        node = plan("PROFILE SELECT profile FROM X WHERE k = 3 LIMIT 2");
+        assert(node.operation == "PROJECT");
+        assert(node.rows == 2);
+        assert(node.children.size() == 1 && node.children[0].operation == "LIMIT");
+        assert(node.children[0].rows == 2);
+        auto& find = node.children[0].children[0];
+        assert(find.operation == "FIND");
+        assert(find.rows == 2);
+        assert(find.reads > 0 && node.reads >= find.reads);
+        assert(find.elapsedTime >= 0.0 && node.elapsedTime >= find.elapsedTime);
+
+        node = plan("PROFILE SELECT FROM (" + to_string(vertices[0]) + ", " + to_string(vertices[1]) + ") WHERE profile = 1");
+        assert(node.operation == "FILTER" && node.rows == 1);
+        assert(node.children[0].operation == "FETCH" && node.children[0].rows == 2);
+
+        node = plan("PROFILE TRAVERSE out() FROM " + to_string(vertices[0]) + " MAXDEPTH 3");
+        assert(node.operation == "TRAVERSE");
+        assert(node.rows == 4);
+        assert(node.reads > 0);
+
+        // both words are still names of classes and properties
+        auto result = SQL::execute(txn, "SELECT FROM X WHERE profile = 7");
+        assert(result.type() == result.RESULT_SET);
+        assert(result.get<ResultSet>().size() == 1);
+
+        // operation builders are profiled the same way
+        node = txn.find("X").where(Condition("k").eq(1)).profile();
+        assert(node.operation == "FIND");
+        assert(node.plans.size() == 1 && node.plans[0].strategy == QueryPlan::Strategy::INDEX_SCAN);
+        assert(node.rows == 4);
+        assert(node.reads > 0);
+
+        auto traverse = txn.traverseOut(vertices[0]).maxDepth(2);
+        node = traverse.explain();
+        assert(node.operation == "TRAVERSE" && node.rows == 0);
+        node = traverse.profile();
+        assert(node.rows == traverse.get().size());
+        assert(node.reads > 0);
+    } catch (const Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    txn.dropIndex("X", "k");
+    txn.dropClass("XE");
+    txn.dropClass("X");
+    txn.commit();
+}
+
+void test_sql_stream_after_execute()
+{
+    auto txn = ctx->beginTxn(TxnMode::READ_WRITE);
+    txn.addClass("T", ClassType::VERTEX);
+    txn.addProperty("T", "g", PropertyType::INTEGER);
+    txn.addProperty("T", "n", PropertyType::INTEGER);
+    txn.addClass("TE", ClassType::EDGE);
+
+    try {
+        vector<RecordDescriptor> vertices {};
+        for (int i = 0; i < 12; ++i) {
+            vertices.push_back(txn.addVertex("T", Record {}.set("g", i % 3).set("n", i)));
+        }
+        for (size_t i = 1; i < vertices.size(); ++i) {
+            txn.addEdge("TE", vertices[0], vertices[i]);
+        }
+
+        // grouped, aggregated and expanded rows are only computed when the cursor is first pulled
+        auto queries = vector<string> {
+            "SELECT g, count(*), sum(n) FROM T GROUP BY g",
+            "SELECT max(n), avg(n) FROM T",
+            "SELECT expand(out()) FROM " + to_string(vertices[0]),
+        };
+        vector<SQL::Result> cursors {};
+        for (const auto& query : queries) {
+            cursors.push_back(SQL::stream(txn, query));
+        }
+        // other statements reuse the memory of the contexts the cursors were made in
+        for (const auto& query : queries) {
+            SQL::execute(txn, query);
+        }
+        for (size_t i = 0; i < queries.size(); ++i) {
+            assert(cursors[i].type() == cursors[i].RESULT_CURSOR);
+            auto& cursor = cursors[i].get<SQL::Cursor>();
+            ResultSet rows {};
+            while (cursor.next()) {
+                rows.push_back(*cursor);
+            }
+            assert(rows == SQL::execute(txn, queries[i]).get<ResultSet>());
+        }
+    } catch (const Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    txn.dropClass("TE");
+    txn.dropClass("T");
+    txn.commit();
+}
+
+void test_sql_batch_dml()
+{
+    auto txn = ctx->beginTxn(TxnMode::READ_WRITE);
+    txn.addClass("B", ClassType::VERTEX);
+    txn.addProperty("B", "name", PropertyType::TEXT);
+    txn.addProperty("B", "n", PropertyType::INTEGER);
+    txn.addProperty("B", "values", PropertyType::INTEGER);
+    txn.addIndex("B", "name", true);
+    txn.addIndex("B", "n");
+    txn.addClass("BE", ClassType::EDGE);
+    txn.addProperty("BE", "w", PropertyType::INTEGER);
+    txn.addIndex("BE", "w");
+
+    auto execute = [&txn](const string& query) {
+        auto result = SQL::execute(txn, query);
+        assert(result.type() == result.RECORD_DESCRIPTORS);
+        return result.get<vector<RecordDescriptor>>();
+    };
+    auto count = [&txn](const Condition& condition) {
+        return txn.find("B").where(condition).get().size();
+    };
+
+    try {
+        // every row becomes a vertex, including the negative keys of the index
+        auto vertices = execute("CREATE VERTEX B (name, n, values) VALUES ('a', 3, 30), ('b', -1, 10), ('c', 2, 20), ('d', 3, 40);");
+        assert(vertices.size() == 4);
+        assert(txn.fetchRecord(vertices[1]).getText("name") == "b");
+        assert(txn.fetchRecord(vertices[1]).getInt("n") == -1);
+        assert(txn.fetchRecord(vertices[3]).getInt("values") == 40);
+        assert(count(Condition("n").eq(3)) == 2);
+        assert(count(Condition("n").lt(0)) == 1);
+        assert(count(Condition("name").eq("c")) == 1);
+
+        // every source is joined to every destination
+        auto edges = execute("CREATE EDGE BE FROM (SELECT FROM B WHERE n = 3) TO (SELECT FROM B WHERE n < 3) SET w = 5;");
+        assert(edges.size() == 4);
+        assert(txn.find("BE").where(Condition("w").eq(5)).get().size() == 4);
+        assert(txn.findOutEdge(vertices[0]).get().size() == 2);
+        assert(txn.findInEdge(vertices[2]).get().size() == 2);
+
+        // only the given properties change, and only their indexes are rewritten
+        auto updated = execute("UPDATE B SET n = 7 WHERE n = 3;");
+        assert(updated.size() == 2);
+        assert(count(Condition("n").eq(3)) == 0);
+        assert(count(Condition("n").eq(7)) == 2);
+        assert(txn.fetchRecord(vertices[0]).getText("name") == "a");
+        assert(txn.fetchRecord(vertices[0]).getInt("values") == 30);
+        assert(count(Condition("name").eq("a")) == 1);
+
+        execute("UPDATE BE SET w = 6 WHERE w = 5;");
+        assert(txn.find("BE").where(Condition("w").eq(5)).get().empty());
+        assert(txn.find("BE").where(Condition("w").eq(6)).get().size() == 4);
+
+        // the edges of a removed vertex go with it
+        auto removed = execute("DELETE VERTEX B WHERE n = 7;");
+        assert(removed.size() == 2);
+        assert(count(Condition("n").eq(7)) == 0);
+        assert(txn.find("B").get().size() == 2);
+        assert(txn.find("BE").get().empty());
+        assert(txn.findInEdge(vertices[2]).get().empty());
+    } catch (const Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        SQL::execute(txn, "CREATE VERTEX B (name, n) VALUES ('e', 1), ('f');");
+        assert(false);
+    } catch (const Error& ex) {
+        REQUIRE(ex, NOGDB_SQL_INVALID_VALUES, "NOGDB_SQL_INVALID_VALUES");
+    }
+    assert(txn.find("B").get().size() == 2);
+
+    try {
+        // the same batches through the operations of a transaction
+        auto vertices = txn.addVertices("B", { Record {}.set("name", "x").set("n", 1), Record {}.set("name", "y").set("n", 1) });
+        assert(vertices.size() == 2);
+        auto edges = txn.addEdges("BE", { { vertices[0], vertices[1] }, { vertices[1], vertices[0] } }, Record {}.set("w", 1));
+        assert(edges.size() == 2);
+        assert(txn.fetchDst(edges[1]).descriptor == vertices[0]);
+
+        txn.updateProperties({ vertices[0], vertices[1], vertices[0] }, Record {}.set("n", 2));
+        assert(count(Condition("n").eq(1)) == 0);
+        assert(count(Condition("n").eq(2)) == 3);
+        assert(txn.fetchRecord(vertices[1]).getText("name") == "y");
+
+        txn.remove({ vertices[0], edges[0], vertices[1] });
+        assert(count(Condition("name").eq("x")) == 0);
+        assert(txn.find("BE").get().empty());
+        assert(txn.find("B").get().size() == 2);
+    } catch (const Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    // a missing record fails the batch before anything is written, and the transaction goes on
+    auto existing = txn.find("B").get();
+    auto missing = RecordDescriptor { txn.getClass("B").id, PositionId { 9999 } };
+    try {
+        txn.remove({ existing[0].descriptor, missing });
+        assert(false);
+    } catch (const Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_NOEXST_RECORD, "NOGDB_CTX_NOEXST_RECORD");
+    }
+    try {
+        txn.updateProperties({ existing[0].descriptor, missing }, Record {}.set("n", 9));
+        assert(false);
+    } catch (const Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_NOEXST_RECORD, "NOGDB_CTX_NOEXST_RECORD");
+    }
+    assert(txn.find("B").get() == existing);
+    assert(count(Condition("n").eq(9)) == 0);
+
+    try {
+        txn.addVertices("B", { Record {}.set("name", "z"), Record {}.set("unknown", 1) });
+        assert(false);
+    } catch (const Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_NOEXST_PROPERTY, "NOGDB_CTX_NOEXST_PROPERTY");
+    }
+    assert(txn.find("B").get().size() == 2);
+
+    txn.dropIndex("BE", "w");
+    txn.dropIndex("B", "n");
+    txn.dropIndex("B", "name");
+    txn.dropClass("BE");
+    txn.dropClass("B");
+    txn.commit();
+}
+
+void test_sql_create_index_type()
+{
+    auto txn = ctx->beginTxn(TxnMode::READ_WRITE);
+    txn.addClass("V", ClassType::VERTEX);
+    txn.addProperty("V", "p", PropertyType::TEXT);
+    txn.addProperty("V", "q", PropertyType::TEXT);
+    txn.addProperty("V", "r", PropertyType::TEXT);
+    txn.addProperty("V", "s", PropertyType::TEXT);
+
+    try {
+        // the index type is matched regardless of its case
+        SQL::execute(txn, "CREATE INDEX V.p fulltext");
+        assert(txn.getIndex("V", "p").type == IndexType::FULLTEXT);
+        SQL::execute(txn, "CREATE INDEX V.q Hash");
+        assert(txn.getIndex("V", "q").type == IndexType::HASH);
+        assert(txn.getIndex("V", "q").unique == false);
+        SQL::execute(txn, "CREATE INDEX V.r Unique");
+        assert(txn.getIndex("V", "r").unique == true);
+        // any other index type gives an index that is not unique
+        SQL::execute(txn, "CREATE INDEX V.s VALUE");
+        assert(txn.getIndex("V", "s").unique == false);
+    } catch (const Error& e) {
+        cout << "\nError: " << e.what() << endl;
+        assert(false);
+    }
+
+    txn.dropIndex("V", "p");
+    txn.dropIndex("V", "q");
+    txn.dropIndex("V", "r");
+    txn.dropIndex("V", "s");
+    txn.dropClass("V");
+    txn.commit();
+}